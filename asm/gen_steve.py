@@ -1,7 +1,8 @@
 #!/usr/bin/env python3
 """
 Generate Minecraft Steve model for C64 3D renderer.
-Outputs 6502 assembly data for vertices and face indices.
+Outputs 6502 assembly data for vertices and face indices,
+or a C header for the prototype renderer with --c-header.
 Supports walking animation with swinging arms and legs.
 """
 
@@ -338,5 +339,40 @@ def output_asm():
     print("steve_fcol_1")
 
 
+def output_c_header():
+    """Output as a C header for the prototype renderer (all animation frames)."""
+    all_frames = [generate_steve_frame(f) for f in range(NUM_FRAMES)]
+    num_vertices = len(all_frames[0])
+    faces, colors = generate_faces()
+
+    def signed(val):
+        b = to_signed_byte(val)
+        return b - 256 if b > 127 else b
+
+    print(f"// Generated by gen_steve.py --c-header: {num_vertices} vertices, "
+          f"{len(faces)} faces, {NUM_FRAMES} animation frames\n")
+    print(f"#define STEVE_NUM_VERTICES {num_vertices}")
+    print(f"#define STEVE_NUM_FACES {len(faces)}")
+    print(f"#define STEVE_NUM_FRAMES {NUM_FRAMES}\n")
+
+    for axis, name in enumerate("xyz"):
+        print(f"static int8_t steve_vertices_{name}[STEVE_NUM_FRAMES][STEVE_NUM_VERTICES] = {{")
+        for vertices in all_frames:
+            print("    { " + ", ".join(str(signed(v[axis])) for v in vertices) + " },")
+        print("};\n")
+
+    for idx, name in enumerate("ijk"):
+        print(f"static uint8_t steve_faces_{name}[] = {{")
+        print("    " + ", ".join(str(f[idx]) for f in faces))
+        print("};\n")
+
+    print("static uint8_t steve_faces_col[] = {")
+    print("    " + ", ".join(str(c) for c in colors))
+    print("};")
+
+
 if __name__ == "__main__":
-    output_asm()
+    if len(sys.argv) > 1 and sys.argv[1] == "--c-header":
+        output_c_header()
+    else:
+        output_asm()
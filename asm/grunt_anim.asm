@@ -6,6 +6,281 @@ GRUNT_NUM_VERTICES = 151
 GRUNT_NUM_FACES_0 = 147
 GRUNT_NUM_FACES_1 = 148
 
+.if ANIM_KEYFRAMES
+GRUNT_NUM_KEYS = 6
+GRUNT_KEY_SPACING = 4
+
+; Keyframe 0 (frame 0), biased by +128
+grunt_kx_0
+        .byte $72, $70, $6e, $71, $72, $71, $6d, $6e, $6f, $69, $6d, $6b, $88, $75, $76, $85
+        .byte $72, $72, $70, $72, $68, $6c, $6e, $73, $6b, $7c, $70, $6a, $7d, $70, $70, $75
+        .byte $6f, $74, $75, $79, $78, $7b, $7d, $79, $72, $7b, $94, $9c, $9a, $9c, $a0, $a9
+        .byte $b0, $a6, $ae, $a4, $90, $8c, $84, $b6, $b2, $a4, $a6, $81, $7f, $8e, $82, $8b
+        .byte $77, $7a, $8c, $90, $7d, $7c, $87, $88, $89, $7b, $79, $84, $91, $8c, $7d, $85
+        .byte $93, $80, $8c, $78, $83, $8b, $96, $8d, $9a, $7f, $81, $98, $9d, $94, $84, $88
+        .byte $88, $87, $94, $95, $8e, $a4, $a7, $a8, $9b, $9b, $89, $86, $7d, $74, $8a, $8b
+        .byte $93, $91, $92, $92, $9e, $a4, $7d, $80, $82, $95, $85, $a2, $a7, $92, $7f, $80
+        .byte $70, $5d, $5d, $66, $66, $91, $8b, $82, $8c, $97, $7f, $8e, $a2, $82, $7e, $86
+        .byte $7c, $8f, $78, $83, $96, $92, $80
+
+grunt_ky_0
+        .byte $9e, $98, $99, $a1, $9d, $9a, $a3, $a2, $a1, $9d, $9c, $9e, $9e, $a9, $bb, $96
+        .byte $9b, $a3, $97, $a8, $9d, $af, $b4, $a9, $9f, $a0, $92, $8e, $92, $8e, $98, $8a
+        .byte $8e, $91, $8a, $91, $94, $8a, $90, $90, $8f, $96, $a3, $a4, $aa, $9a, $9a, $b5
+        .byte $a3, $ba, $a1, $b6, $91, $9f, $96, $94, $94, $8d, $90, $9e, $d6, $d6, $d2, $d2
+        .byte $d5, $ce, $ce, $d4, $ce, $cd, $cc, $cd, $e8, $e9, $ec, $f2, $eb, $eb, $ec, $86
+        .byte $80, $97, $95, $7a, $88, $5c, $5f, $55, $59, $54, $5b, $3f, $3d, $3d, $77, $88
+        .byte $5d, $5b, $3d, $33, $34, $34, $3d, $43, $43, $3d, $96, $94, $80, $7e, $88, $78
+        .byte $5d, $61, $56, $5b, $5c, $55, $40, $42, $3f, $88, $75, $60, $5e, $40, $35, $35
+        .byte $36, $46, $3f, $46, $3f, $89, $d0, $9c, $9b, $9a, $ae, $b9, $b0, $90, $b9, $99
+        .byte $9d, $9a, $9c, $a9, $a1, $9a, $9c
+
+grunt_kz_0
+        .byte $c9, $cb, $c7, $cf, $bb, $be, $c8, $ce, $be, $c6, $ce, $c0, $70, $63, $65, $6e
+        .byte $5f, $7e, $78, $7c, $6c, $70, $72, $a8, $a2, $a5, $80, $6e, $83, $6f, $a2, $be
+        .byte $c4, $c0, $c5, $b7, $b8, $c1, $b9, $c6, $c6, $be, $73, $89, $88, $73, $89, $75
+        .byte $79, $75, $86, $84, $a1, $a8, $9c, $79, $85, $7c, $86, $a5, $85, $85, $81, $84
+        .byte $90, $87, $8c, $90, $97, $8d, $91, $98, $9e, $9d, $90, $91, $92, $85, $84, $9e
+        .byte $94, $85, $7b, $91, $85, $6c, $5f, $6b, $5c, $61, $67, $7a, $79, $7d, $8a, $71
+        .byte $57, $4f, $65, $7c, $87, $87, $a2, $a2, $a4, $a4, $87, $75, $96, $86, $87, $93
+        .byte $66, $56, $64, $53, $68, $64, $64, $6a, $70, $70, $85, $58, $52, $58, $79, $6b
+        .byte $6d, $82, $82, $8b, $8b, $73, $76, $6a, $6e, $72, $59, $6d, $68, $8d, $95, $82
+        .byte $7e, $84, $77, $89, $86, $7a, $73
+
+; Keyframe 1 (frame 4), biased by +128
+grunt_kx_1
+        .byte $9c, $98, $95, $a0, $93, $92, $9a, $9e, $94, $93, $9a, $91, $7a, $64, $68, $74
+        .byte $5d, $76, $6e, $76, $60, $6a, $6c, $8e, $81, $8e, $71, $5f, $79, $62, $81, $91
+        .byte $8b, $8e, $92, $91, $8f, $97, $96, $94, $8d, $92, $9b, $a1, $9f, $a5, $a6, $ad
+        .byte $b6, $a9, $b3, $a7, $a4, $9c, $97, $bf, $b9, $b0, $af, $92, $85, $94, $85, $8e
+        .byte $80, $81, $94, $99, $87, $86, $92, $93, $93, $83, $80, $8c, $98, $91, $82, $91
+        .byte $9a, $87, $8e, $7f, $87, $85, $8f, $85, $92, $77, $7b, $90, $96, $8d, $88, $85
+        .byte $81, $80, $8b, $8f, $88, $9f, $a2, $a3, $96, $96, $8f, $87, $85, $79, $8f, $93
+        .byte $91, $90, $90, $90, $9d, $a2, $7b, $7d, $80, $93, $8a, $a0, $a5, $8e, $7c, $7e
+        .byte $6d, $5b, $5b, $63, $63, $8f, $83, $7f, $89, $94, $6a, $84, $a1, $8a, $8f, $8c
+        .byte $80, $95, $7c, $8e, $9e, $93, $80
+
+grunt_ky_1
+        .byte $74, $6d, $71, $72, $7a, $76, $79, $73, $7c, $75, $6f, $79, $9d, $ad, $ba, $97
+        .byte $a1, $aa, $9e, $ae, $a6, $b5, $b9, $8e, $8a, $87, $92, $94, $8a, $90, $83, $7b
+        .byte $7b, $80, $7a, $83, $85, $7d, $83, $80, $7d, $87, $a2, $ad, $b2, $9c, $a5, $b6
+        .byte $aa, $b9, $ad, $bc, $8e, $98, $8e, $9c, $a1, $92, $99, $94, $db, $dc, $d6, $d6
+        .byte $d5, $d5, $d4, $d7, $cd, $d3, $d3, $cd, $e1, $e0, $e9, $ef, $e9, $ef, $ee, $8a
+        .byte $83, $9c, $98, $80, $8c, $60, $62, $58, $5b, $59, $60, $43, $41, $41, $7b, $8c
+        .byte $62, $5f, $41, $37, $38, $38, $41, $47, $47, $41, $97, $96, $7b, $7d, $8a, $75
+        .byte $65, $6d, $5f, $68, $63, $5e, $4b, $4d, $4a, $8c, $75, $6b, $6a, $4c, $3f, $3f
+        .byte $40, $50, $4a, $4f, $49, $8c, $cb, $9d, $9c, $9c, $a5, $b4, $a8, $93, $c9, $9e
+        .byte $a0, $a0, $a1, $b4, $a8, $9e, $9e
+
+grunt_kz_1
+        .byte $95, $96, $96, $9b, $8e, $8f, $9a, $9d, $93, $9b, $9b, $96, $5a, $5d, $59, $5d
+        .byte $5f, $73, $73, $70, $6e, $6a, $69, $86, $87, $7d, $78, $71, $6e, $6b, $81, $9c
+        .byte $a3, $9f, $a3, $96, $97, $9e, $97, $a4, $a4, $9d, $59, $6e, $6b, $5c, $72, $54
+        .byte $5f, $51, $6d, $61, $81, $8a, $7f, $64, $71, $69, $73, $86, $66, $60, $59, $57
+        .byte $72, $65, $61, $6d, $75, $6b, $68, $74, $84, $85, $7c, $7e, $7b, $70, $71, $8b
+        .byte $7e, $75, $66, $85, $73, $5b, $4e, $5a, $4b, $50, $57, $69, $69, $6c, $7a, $5f
+        .byte $47, $3f, $54, $6b, $77, $77, $92, $92, $94, $94, $74, $62, $7d, $6f, $71, $75
+        .byte $43, $34, $3f, $2f, $44, $3e, $40, $45, $4b, $58, $68, $35, $2e, $31, $56, $48
+        .byte $4b, $61, $61, $6a, $6a, $5d, $4b, $5c, $5a, $59, $53, $4e, $48, $7b, $72, $70
+        .byte $71, $6e, $6f, $6f, $68, $62, $65
+
+; Keyframe 2 (frame 8), biased by +128
+grunt_kx_2
+        .byte $56, $53, $51, $56, $57, $54, $53, $53, $55, $4d, $50, $4f, $6a, $60, $67, $61
+        .byte $56, $5e, $53, $63, $50, $5f, $62, $5c, $51, $62, $4d, $47, $59, $4c, $54, $aa
+        .byte $ab, $ad, $af, $aa, $aa, $b0, $ad, $b4, $ae, $b1, $9e, $a8, $a0, $ac, $b2, $a2
+        .byte $b2, $a0, $b5, $a2, $af, $b2, $a4, $c1, $c1, $bc, $bf, $a8, $80, $8f, $81, $8a
+        .byte $78, $7b, $8d, $90, $7d, $7e, $8a, $89, $88, $79, $79, $84, $90, $8d, $7e, $88
+        .byte $94, $7c, $84, $7b, $7e, $77, $80, $76, $82, $67, $6c, $80, $86, $7e, $85, $7e
+        .byte $72, $71, $7c, $80, $7a, $90, $93, $93, $87, $86, $84, $7c, $77, $6a, $83, $82
+        .byte $92, $90, $93, $93, $9e, $a5, $7f, $81, $84, $86, $79, $a1, $a7, $94, $80, $82
+        .byte $71, $5d, $5e, $66, $66, $84, $83, $75, $80, $8b, $67, $82, $9a, $7f, $82, $81
+        .byte $77, $89, $6c, $81, $94, $89, $77
+
+grunt_ky_2
+        .byte $81, $7c, $7e, $83, $82, $80, $87, $84, $86, $83, $80, $84, $89, $a2, $a8, $89
+        .byte $9e, $92, $90, $93, $9f, $a2, $a2, $91, $8d, $87, $8e, $95, $87, $91, $84, $70
+        .byte $73, $76, $6e, $78, $7b, $6f, $76, $73, $73, $7a, $8c, $96, $94, $8f, $95, $a6
+        .byte $a4, $a6, $a3, $a2, $7f, $88, $83, $9e, $9e, $8e, $92, $88, $b7, $b7, $b5, $b5
+        .byte $b6, $b0, $af, $b4, $ae, $ad, $ac, $ad, $c8, $c9, $cd, $d3, $cc, $cd, $ce, $84
+        .byte $7b, $85, $81, $74, $77, $45, $46, $3c, $3f, $3e, $46, $27, $25, $25, $6d, $72
+        .byte $47, $44, $25, $1b, $1c, $1b, $24, $2a, $2a, $24, $80, $7e, $72, $71, $74, $66
+        .byte $51, $5a, $4a, $55, $51, $4c, $35, $38, $34, $70, $63, $5b, $5c, $3b, $27, $28
+        .byte $27, $34, $2e, $35, $2f, $71, $b6, $83, $85, $84, $98, $a4, $97, $80, $99, $82
+        .byte $85, $85, $81, $8a, $83, $85, $84
+
+grunt_kz_2
+        .byte $ca, $cb, $c7, $d1, $bc, $be, $c9, $d0, $c0, $c7, $ce, $c1, $6d, $6c, $74, $69
+        .byte $65, $83, $7b, $82, $75, $7e, $80, $ac, $a4, $a8, $80, $71, $82, $70, $a3, $c1
+        .byte $c9, $c4, $c6, $ba, $bc, $be, $b8, $c3, $c9, $bd, $73, $87, $87, $70, $85, $71
+        .byte $71, $72, $80, $82, $9b, $a4, $a0, $6f, $7d, $77, $80, $a8, $8e, $8d, $8b, $8a
+        .byte $97, $91, $91, $98, $9e, $96, $96, $9f, $a8, $a5, $98, $9b, $9d, $8f, $8c, $9c
+        .byte $91, $80, $74, $9b, $85, $66, $58, $64, $55, $5a, $62, $73, $72, $75, $91, $70
+        .byte $51, $49, $5e, $75, $80, $80, $9c, $9c, $9e, $9e, $80, $71, $95, $89, $84, $91
+        .byte $48, $3a, $42, $34, $49, $42, $43, $48, $4f, $6a, $85, $3b, $34, $34, $5a, $4c
+        .byte $4f, $65, $65, $6e, $6e, $6e, $7c, $67, $66, $66, $64, $70, $65, $89, $98, $7c
+        .byte $7b, $7a, $7c, $88, $80, $6f, $70
+
+; Keyframe 3 (frame 12), biased by +128
+grunt_kx_3
+        .byte $3b, $35, $35, $38, $3f, $3b, $39, $37, $3d, $34, $33, $38, $6d, $60, $67, $64
+        .byte $56, $61, $56, $65, $51, $5f, $62, $4d, $43, $50, $4c, $47, $53, $4a, $44, $c2
+        .byte $c4, $c2, $c8, $be, $bd, $c8, $c1, $ca, $c6, $c3, $90, $a2, $9c, $9a, $a9, $9d
+        .byte $a8, $9b, $af, $a0, $b9, $b9, $ad, $b3, $b7, $ab, $b1, $b1, $7e, $8c, $80, $89
+        .byte $7a, $7a, $8b, $91, $80, $7d, $88, $8b, $92, $82, $7e, $8a, $95, $8d, $7e, $86
+        .byte $93, $7c, $85, $7a, $7f, $77, $80, $77, $83, $68, $6d, $82, $89, $80, $85, $7f
+        .byte $73, $71, $7d, $84, $7e, $94, $97, $97, $8a, $8a, $87, $7c, $7e, $6f, $85, $87
+        .byte $8c, $8a, $8b, $8b, $97, $9d, $77, $7a, $7d, $85, $7b, $9a, $a0, $8b, $79, $7b
+        .byte $6a, $56, $56, $5f, $5f, $84, $84, $75, $80, $8b, $6c, $82, $91, $80, $80, $82
+        .byte $78, $8a, $70, $80, $8f, $8a, $77
+
+grunt_ky_3
+        .byte $3d, $3c, $40, $38, $49, $47, $41, $3a, $48, $44, $3b, $49, $81, $91, $93, $82
+        .byte $92, $76, $7a, $78, $87, $86, $85, $5a, $62, $57, $74, $83, $6f, $83, $5e, $47
+        .byte $47, $4c, $46, $50, $52, $4a, $51, $4e, $49, $54, $77, $75, $76, $76, $71, $8e
+        .byte $85, $8f, $7f, $84, $60, $68, $5e, $7e, $78, $6e, $6e, $62, $94, $92, $93, $92
+        .byte $96, $8d, $8a, $91, $8e, $89, $88, $8b, $a9, $ac, $ae, $b2, $aa, $a9, $ac, $7b
+        .byte $71, $76, $72, $69, $67, $35, $36, $2b, $2e, $2e, $36, $15, $14, $13, $62, $62
+        .byte $37, $34, $14, $09, $09, $0a, $13, $19, $18, $12, $70, $6e, $64, $64, $64, $57
+        .byte $47, $51, $40, $4d, $45, $40, $2c, $2e, $29, $60, $55, $50, $51, $32, $1c, $1d
+        .byte $1c, $2b, $25, $2b, $25, $61, $9b, $75, $78, $77, $8d, $8f, $8b, $70, $75, $70
+        .byte $73, $74, $6e, $6f, $6d, $75, $74
+
+grunt_kz_3
+        .byte $a1, $9d, $9d, $a6, $9c, $9a, $a7, $a7, $a1, $a3, $a2, $a1, $7b, $8b, $92, $78
+        .byte $83, $90, $88, $92, $8d, $97, $98, $a0, $99, $95, $87, $82, $81, $7f, $91, $ba
+        .byte $c2, $bf, $bd, $b7, $b9, $b7, $b4, $bd, $c2, $bb, $83, $93, $95, $7c, $8d, $87
+        .byte $7f, $8a, $89, $95, $9c, $a9, $a3, $75, $80, $7a, $83, $ae, $af, $ac, $af, $ae
+        .byte $b9, $b2, $b1, $b2, $bd, $b5, $b5, $bb, $be, $c1, $b5, $b1, $b0, $a5, $a8, $af
+        .byte $a6, $8e, $85, $af, $97, $74, $66, $72, $63, $68, $70, $7f, $7e, $80, $a7, $81
+        .byte $60, $57, $6a, $80, $8b, $8b, $a7, $a7, $a9, $a9, $8f, $82, $aa, $a0, $95, $a4
+        .byte $51, $45, $4a, $3d, $52, $49, $4b, $50, $57, $7b, $9a, $45, $3d, $3b, $63, $55
+        .byte $58, $6e, $6e, $77, $77, $7f, $a2, $79, $78, $79, $7c, $8f, $7d, $99, $af, $8b
+        .byte $8a, $89, $85, $99, $8d, $80, $80
+
+; Keyframe 4 (frame 16), biased by +128
+grunt_kx_4
+        .byte $4a, $48, $47, $46, $50, $4e, $46, $44, $4c, $43, $43, $47, $80, $70, $75, $7a
+        .byte $6a, $6e, $67, $71, $61, $6b, $6e, $59, $53, $61, $5f, $5c, $69, $61, $58, $c1
+        .byte $c1, $c1, $c6, $bd, $bc, $c7, $c1, $c8, $c4, $c3, $99, $ac, $a7, $a3, $b2, $a8
+        .byte $b2, $a6, $b9, $ab, $bd, $bc, $b0, $bb, $c0, $b3, $b9, $b3, $87, $96, $89, $93
+        .byte $82, $81, $94, $9a, $86, $84, $90, $92, $9b, $8b, $88, $96, $a1, $99, $8a, $8d
+        .byte $9b, $85, $8f, $80, $88, $87, $91, $87, $94, $79, $7d, $92, $98, $8f, $8d, $89
+        .byte $82, $81, $8d, $92, $8a, $a1, $a4, $a4, $98, $98, $92, $86, $89, $7a, $8f, $92
+        .byte $96, $94, $95, $95, $a1, $a7, $80, $82, $85, $8f, $86, $a4, $aa, $94, $81, $82
+        .byte $72, $5f, $5f, $68, $68, $8e, $90, $80, $8b, $97, $79, $8f, $9f, $8a, $86, $8c
+        .byte $82, $94, $79, $88, $9b, $95, $81
+
+grunt_ky_4
+        .byte $3b, $3b, $3f, $36, $47, $46, $3e, $38, $46, $42, $39, $47, $7b, $8f, $97, $79
+        .byte $8a, $78, $76, $7b, $84, $89, $8a, $57, $5f, $55, $6b, $7a, $67, $79, $5d, $37
+        .byte $30, $37, $32, $40, $3f, $3a, $42, $37, $31, $3f, $7d, $78, $79, $7c, $74, $93
+        .byte $8a, $94, $82, $87, $5c, $5a, $57, $82, $7c, $72, $71, $54, $95, $92, $94, $91
+        .byte $96, $8e, $8a, $90, $8d, $8a, $87, $89, $a6, $aa, $ae, $b1, $a7, $a9, $ad, $80
+        .byte $76, $79, $75, $6e, $6b, $38, $39, $2e, $32, $2f, $38, $18, $16, $16, $67, $65
+        .byte $39, $36, $17, $0c, $0c, $0c, $16, $1c, $1b, $15, $74, $72, $68, $67, $68, $5a
+        .byte $47, $51, $40, $4c, $44, $3f, $2c, $2e, $2a, $63, $58, $4e, $4f, $31, $1d, $1d
+        .byte $1e, $2e, $27, $2d, $27, $64, $9c, $79, $7b, $78, $94, $92, $91, $74, $76, $73
+        .byte $78, $75, $73, $71, $70, $76, $78
+
+grunt_kz_4
+        .byte $76, $6f, $70, $78, $75, $72, $7a, $79, $79, $75, $73, $76, $79, $7d, $89, $73
+        .byte $72, $8c, $80, $8d, $7e, $8c, $8f, $81, $79, $7a, $79, $70, $71, $6b, $72, $80
+        .byte $86, $87, $81, $84, $87, $80, $83, $87, $87, $8a, $7e, $8c, $8f, $76, $85, $84
+        .byte $7a, $88, $83, $92, $7c, $8b, $80, $6e, $79, $6e, $79, $8a, $aa, $a9, $aa, $ab
+        .byte $b3, $ac, $ad, $b0, $b8, $b0, $b0, $b7, $bd, $be, $b2, $b1, $b0, $a4, $a5, $a8
+        .byte $a1, $87, $80, $a8, $90, $6f, $61, $6c, $5d, $62, $6a, $7b, $79, $7d, $a2, $7c
+        .byte $5a, $51, $65, $7c, $87, $87, $a3, $a3, $a5, $a5, $88, $7d, $a4, $9a, $8f, $9e
+        .byte $4e, $40, $46, $39, $4e, $45, $49, $4d, $54, $75, $95, $40, $39, $38, $61, $53
+        .byte $56, $6b, $6b, $75, $75, $79, $9e, $72, $72, $72, $77, $8a, $7b, $92, $a8, $85
+        .byte $84, $83, $80, $92, $87, $7a, $7a
+
+; Keyframe 5 (frame 20), biased by +128
+grunt_kx_5
+        .byte $80, $7c, $7a, $82, $7c, $79, $7e, $80, $7c, $77, $7c, $77, $7c, $6b, $70, $74
+        .byte $63, $6a, $62, $6d, $5c, $67, $69, $7c, $70, $7e, $64, $59, $70, $5f, $70, $86
+        .byte $80, $82, $85, $87, $84, $8b, $8b, $86, $80, $86, $9a, $9e, $9b, $a3, $a2, $ae
+        .byte $b4, $ab, $b0, $a5, $9d, $92, $91, $bc, $b5, $ac, $aa, $8a, $80, $8f, $84, $8d
+        .byte $79, $7d, $8e, $91, $7e, $7e, $89, $8a, $8b, $7c, $7a, $85, $92, $8d, $7e, $88
+        .byte $96, $83, $8e, $7a, $85, $8a, $95, $8b, $98, $7d, $80, $96, $9c, $93, $86, $89
+        .byte $87, $86, $92, $94, $8d, $a3, $a6, $a7, $9a, $9a, $8c, $88, $81, $77, $8e, $90
+        .byte $92, $90, $90, $91, $9d, $a3, $7d, $7f, $81, $96, $88, $a1, $a6, $90, $7f, $80
+        .byte $70, $5d, $5d, $66, $66, $92, $8d, $82, $8d, $98, $75, $8f, $a8, $85, $80, $89
+        .byte $7f, $92, $77, $85, $98, $94, $81
+
+grunt_ky_5
+        .byte $8d, $88, $8b, $8e, $90, $8d, $93, $90, $94, $91, $8b, $93, $9c, $ad, $bc, $97
+        .byte $a2, $aa, $a1, $ad, $a9, $b5, $b8, $9f, $9c, $95, $99, $99, $91, $95, $94, $7d
+        .byte $7d, $81, $7c, $85, $86, $80, $85, $83, $7f, $89, $a3, $ac, $af, $9c, $a4, $b7
+        .byte $a9, $bb, $ab, $bb, $8f, $9a, $8e, $9b, $9f, $90, $97, $95, $d8, $d8, $d5, $d4
+        .byte $d7, $d1, $d1, $d7, $d0, $cf, $cf, $cf, $ea, $ea, $ee, $f4, $ed, $ee, $ee, $8a
+        .byte $84, $9b, $98, $7f, $8c, $5e, $5f, $57, $59, $55, $5d, $40, $3e, $3e, $7a, $8c
+        .byte $5d, $5a, $3c, $34, $35, $35, $3e, $44, $44, $3e, $99, $97, $82, $80, $8b, $7b
+        .byte $5f, $64, $58, $5d, $5e, $57, $41, $44, $41, $8b, $78, $62, $60, $41, $38, $37
+        .byte $38, $48, $42, $48, $42, $8c, $d2, $9e, $9e, $9d, $ac, $bc, $af, $94, $bc, $9c
+        .byte $9f, $9e, $9c, $ab, $a2, $9d, $9f
+
+grunt_kz_5
+        .byte $c0, $c2, $bf, $c6, $b4, $b6, $c1, $c7, $b8, $c1, $c6, $bb, $6e, $62, $63, $6d
+        .byte $5f, $7e, $78, $7b, $6c, $70, $71, $a3, $a0, $9d, $80, $6f, $80, $6f, $9d, $ba
+        .byte $c0, $bc, $c1, $b4, $b5, $be, $b6, $c3, $c2, $bb, $77, $8d, $89, $7c, $91, $77
+        .byte $80, $76, $8e, $84, $a3, $a9, $9c, $86, $92, $89, $93, $a4, $80, $80, $7b, $7e
+        .byte $8a, $80, $85, $8a, $90, $86, $8a, $91, $99, $97, $8b, $8c, $8d, $80, $7f, $96
+        .byte $8b, $7e, $72, $8b, $7e, $6b, $5e, $6b, $5c, $61, $67, $7b, $79, $7d, $82, $68
+        .byte $57, $4f, $66, $7b, $85, $85, $a1, $a0, $a3, $a3, $7f, $6d, $8e, $80, $80, $8a
+        .byte $5e, $4e, $5c, $4b, $60, $5c, $5c, $62, $68, $67, $7e, $4f, $49, $50, $71, $63
+        .byte $66, $7b, $7b, $83, $83, $6a, $6e, $62, $65, $68, $58, $66, $67, $85, $8e, $7b
+        .byte $77, $7c, $77, $82, $81, $70, $6b
+
+grunt_kx_lo
+        .byte <grunt_kx_0
+        .byte <grunt_kx_1
+        .byte <grunt_kx_2
+        .byte <grunt_kx_3
+        .byte <grunt_kx_4
+        .byte <grunt_kx_5
+
+grunt_kx_hi
+        .byte >grunt_kx_0
+        .byte >grunt_kx_1
+        .byte >grunt_kx_2
+        .byte >grunt_kx_3
+        .byte >grunt_kx_4
+        .byte >grunt_kx_5
+
+grunt_ky_lo
+        .byte <grunt_ky_0
+        .byte <grunt_ky_1
+        .byte <grunt_ky_2
+        .byte <grunt_ky_3
+        .byte <grunt_ky_4
+        .byte <grunt_ky_5
+
+grunt_ky_hi
+        .byte >grunt_ky_0
+        .byte >grunt_ky_1
+        .byte >grunt_ky_2
+        .byte >grunt_ky_3
+        .byte >grunt_ky_4
+        .byte >grunt_ky_5
+
+grunt_kz_lo
+        .byte <grunt_kz_0
+        .byte <grunt_kz_1
+        .byte <grunt_kz_2
+        .byte <grunt_kz_3
+        .byte <grunt_kz_4
+        .byte <grunt_kz_5
+
+grunt_kz_hi
+        .byte >grunt_kz_0
+        .byte >grunt_kz_1
+        .byte >grunt_kz_2
+        .byte >grunt_kz_3
+        .byte >grunt_kz_4
+        .byte >grunt_kz_5
+
+.else
 ; Frame 0
 grunt_vx_0
         .byte $f2, $f0, $ee, $f1, $f2, $f1, $ed, $ee, $ef, $e9, $ed, $eb, $08, $f5, $f6, $05
@@ -43,6 +318,7 @@ grunt_vz_0
         .byte $ed, $02, $02, $0b, $0b, $f3, $f6, $ea, $ee, $f2, $d9, $ed, $e8, $0d, $15, $02
         .byte $fe, $04, $f7, $09, $06, $fa, $f3
 
+.if !ANIM_DELTA
 ; Frame 1
 grunt_vx_1
         .byte $f6, $f3, $f1, $f5, $f4, $f3, $f1, $f2, $f2, $ec, $f0, $ed, $07, $f4, $f5, $03
@@ -1050,6 +1326,589 @@ grunt_vz_hi
         .byte >grunt_vz_22
         .byte >grunt_vz_23
 
+.else
+; Frame deltas, see encode_frame_delta in bake_animation.py
+GRUNT_DELTA_GROUP = 7
+
+grunt_delta
+        ; Frame 0 -> 1
+        .byte $7f, $34, $43, $22, $04, $7f, $34, $33, $f2, $0f, $7b, $ef, $ee, $ff, $7f, $ff
+        .byte $13, $f1, $0f, $fb, $ff, $ff, $0b, $0c, $0b, $0b, $ff, $09, $08, $0b, $09, $0b
+        .byte $0b, $0a, $1a, $11, $02, $7a, $71, $66, $01, $7f, $22, $72, $ee, $0f, $7f, $fe
+        .byte $ef, $ee, $0f, $23, $ff, $01, $0b, $ff, $0f, $7f, $ef, $ee, $ee, $0f, $67, $ee
+        .byte $ef, $0e, $7f, $fe, $fe, $ef, $0f, $15, $fe, $0f, $7f, $ff, $ff, $ff, $0f, $7f
+        .byte $ff, $ff, $ff, $0e, $7f, $ff, $ff, $ff, $0f, $77, $ff, $ff, $ff, $6f, $ff, $ff
+        .byte $ff, $03, $ff, $7f, $bb, $ab, $bc, $0b, $5f, $ba, $ac, $1c, $5d, $11, $11, $01
+        .byte $5f, $11, $fd, $1c, $7d, $ef, $22, $22, $7f, $22, $23, $23, $02, $46, $ff, $01
+        .byte $7a, $21, $12, $01, $39, $11, $ff, $70, $ff, $0f, $6e, $ff, $ff, $0f, $40, $01
+        .byte $00, $10, $01, $09, $ff, $00, $00, $20, $01, $50, $11, $20, $01, $50, $1f, $02
+        .byte $0f, $7f, $ee, $fe, $ef, $0f, $5f, $ff, $ef, $ff, $7f, $ff, $ff, $ee, $0d, $7f
+        .byte $ef, $ff, $ff, $0d, $7f, $ee, $6e, $67, $06, $7f, $56, $55, $65, $05, $5d, $11
+        .byte $ff, $0e, $7f, $e1, $21, $43, $0d, $7f, $fe, $4f, $11, $01, $5b, $11, $11, $01
+        .byte $7e, $11, $11, $11, $03, $11, $00, $10, $0f, $00, $00, $7c, $ff, $ff, $0f, $73
+        .byte $ff, $ff, $0f, $7b, $ff, $ff, $ff, $11, $ff, $41, $f1, $04, $0f
+        ; Frame 1 -> 2
+        .byte $ff, $0c, $0d, $0c, $0f, $0c, $0b, $0f, $df, $0f, $0c, $0d, $0f, $0d, $01, $7f
+        .byte $e3, $1e, $2f, $0f, $ff, $02, $02, $0a, $08, $07, $01, $fe, $ff, $01, $ff, $07
+        .byte $0a, $09, $09, $0b, $ff, $0a, $0a, $0a, $0a, $0a, $09, $08, $ff, $07, $06, $04
+        .byte $08, $07, $05, $07, $ff, $05, $07, $03, $0a, $08, $09, $08, $ff, $08, $09, $09
+        .byte $08, $03, $03, $04, $7f, $44, $44, $44, $03, $7f, $33, $34, $33, $03, $7f, $43
+        .byte $44, $33, $03, $03, $13, $1d, $ff, $23, $24, $11, $7f, $31, $33, $33, $03, $7f
+        .byte $22, $22, $22, $03, $7f, $21, $33, $22, $03, $7f, $22, $22, $23, $02, $7f, $42
+        .byte $22, $23, $04, $7f, $47, $33, $33, $03, $0f, $23, $22, $ff, $f7, $f7, $f9, $f6
+        .byte $f9, $f9, $f8, $bf, $f7, $f9, $f9, $f8, $fa, $fe, $7f, $ff, $21, $22, $03, $7d
+        .byte $a1, $ad, $21, $7f, $1d, $cc, $cb, $0c, $7f, $cd, $dd, $cc, $0d, $7b, $1f, $11
+        .byte $31, $73, $2f, $df, $04, $7f, $23, $d2, $11, $01, $5d, $11, $11, $01, $01, $01
+        .byte $1e, $11, $11, $00, $38, $f1, $01, $01, $01, $40, $0f, $6f, $21, $21, $11, $73
+        .byte $11, $11, $01, $03, $11, $61, $ef, $0f, $77, $1d, $13, $f1, $01, $02, $7f, $88
+        .byte $89, $88, $09, $7f, $99, $8a, $a9, $0a, $7f, $b9, $bb, $bd, $0d, $ff, $fa, $fb
+        .byte $fa, $fb, $f7, $fc, $fe, $7f, $cb, $ca, $cc, $0c, $7f, $cc, $cc, $cc, $0c, $7f
+        .byte $dd, $dd, $de, $0d, $7f, $ed, $dd, $cc, $0e, $7f, $ee, $cd, $aa, $09, $7f, $a9
+        .byte $89, $a9, $09, $7f, $99, $bb, $cc, $0b, $7f, $bb, $bc, $bc, $0d, $7f, $ac, $aa
+        .byte $aa, $0b, $7f, $ba, $ca, $bc, $0b, $7f, $aa, $aa, $bb, $0b, $7f, $bb, $bb, $bb
+        .byte $0a, $7f, $88, $99, $89, $09, $7f, $88, $bb, $89, $08, $7f, $99, $a9, $9a, $09
+        .byte $ff, $fc, $f7, $fc, $fb, $fb, $fa, $fa, $7f, $ce, $c9, $cc, $0c, $0f, $da, $cb
+        ; Frame 2 -> 3
+        .byte $ff, $0f, $0e, $0e, $10, $0b, $0b, $0e, $ff, $11, $0d, $0f, $0f, $0d, $fc, $fa
+        .byte $7f, $cb, $58, $41, $0e, $fe, $01, $09, $09, $07, $01, $fb, $7f, $af, $77, $67
+        .byte $07, $7f, $66, $77, $76, $06, $7f, $33, $35, $51, $03, $7f, $25, $56, $54, $02
+        .byte $7f, $21, $51, $65, $05, $ff, $07, $05, $07, $09, $05, $06, $09, $ff, $0a, $08
+        .byte $fd, $fe, $fd, $fb, $fd, $ff, $fd, $fd, $08, $06, $06, $03, $05, $39, $f5, $ff
+        .byte $18, $14, $51, $1e, $01, $7e, $35, $56, $65, $7f, $32, $32, $23, $01, $7f, $22
+        .byte $51, $22, $01, $7f, $11, $22, $21, $02, $7f, $12, $11, $81, $0e, $ff, $01, $06
+        .byte $0d, $06, $03, $06, $04, $8f, $09, $08, $04, $02, $ff, $f0, $f1, $f1, $ef, $f3
+        .byte $f3, $f0, $df, $ef, $f3, $f1, $f0, $f2, $01, $7f, $1f, $32, $23, $04, $df, $03
+        .byte $02, $f6, $f7, $f8, $03, $ff, $fe, $01, $f9, $f7, $f5, $f5, $f6, $ff, $f6, $f6
+        .byte $f6, $f7, $f5, $f4, $f5, $7f, $6f, $f6, $d7, $0e, $7f, $4e, $b3, $b9, $0e, $7f
+        .byte $f3, $a3, $62, $02, $7f, $e3, $53, $f4, $03, $7f, $25, $8d, $eb, $02, $7f, $f4
+        .byte $12, $23, $04, $7f, $32, $21, $31, $03, $7f, $33, $23, $22, $03, $7f, $32, $33
+        .byte $33, $03, $6f, $13, $e1, $f1, $7f, $54, $64, $44, $05, $77, $56, $62, $66, $7f
+        .byte $45, $55, $55, $05, $73, $e2, $a1, $0e, $ff, $fb, $01, $09, $04, $02, $03, $02
+        .byte $0f, $56, $22, $ff, $e7, $e7, $e8, $e7, $e9, $e9, $e9, $ff, $e8, $ea, $ea, $e8
+        .byte $eb, $f0, $f7, $ff, $f4, $f2, $f9, $f6, $f8, $f6, $fb, $ff, $f8, $f6, $ed, $ef
+        .byte $ea, $f7, $fb, $ff, $f1, $f8, $ed, $e7, $e7, $e8, $e7, $ff, $e8, $e9, $e7, $e8
+        .byte $e8, $e7, $e8, $ff, $f0, $f0, $ee, $f5, $f3, $eb, $f2, $ff, $e8, $f2, $ea, $eb
+        .byte $ec, $eb, $f7, $ff, $f6, $f7, $f8, $eb, $ec, $ea, $e6, $ff, $e4, $ec, $eb, $e7
+        .byte $ed, $eb, $eb, $ff, $e9, $eb, $f0, $ef, $f0, $f2, $f2, $ff, $f3, $f2, $f3, $f1
+        .byte $f5, $f2, $f6, $ff, $f4, $f4, $f4, $f4, $f4, $f4, $f4, $ff, $f4, $f4, $f4, $f5
+        .byte $f4, $f4, $f4, $ff, $f4, $f5, $f5, $f6, $f4, $f4, $f4, $ff, $f4, $f4, $f3, $f0
+        .byte $f2, $f3, $ef, $ff, $ec, $ec, $ea, $eb, $eb, $eb, $eb, $ff, $eb, $eb, $f0, $ee
+        .byte $eb, $ec, $ea, $ff, $ec, $ec, $ec, $ec, $ec, $ee, $ee, $ff, $f2, $e5, $f5, $f2
+        .byte $f0, $f6, $ea, $ff, $ea, $f4, $ec, $f4, $f6, $f1, $f9, $8f, $f1, $ee, $f1, $f5
+        ; Frame 3 -> 4
+        .byte $ff, $0b, $0a, $0a, $0c, $08, $09, $0c, $ff, $0c, $09, $0b, $0c, $0a, $f7, $f5
+        .byte $e7, $f5, $f7, $f5, $ff, $fc, $5f, $cd, $45, $d3, $07, $ad, $03, $4b, $ff, $ff
+        .byte $7f, $bd, $dc, $ac, $0c, $7f, $b9, $ea, $fe, $0e, $6f, $fc, $dd, $bf, $7f, $1a
+        .byte $dd, $22, $0f, $ff, $ff, $01, $09, $07, $07, $09, $07, $7b, $56, $ee, $fc, $7f
+        .byte $bd, $bb, $bb, $0b, $7f, $bb, $db, $ba, $0b, $7f, $bb, $cb, $cb, $0b, $7f, $ec
+        .byte $fc, $de, $0f, $7f, $bb, $ab, $bb, $0b, $7f, $bb, $eb, $bb, $0a, $7f, $cb, $ba
+        .byte $ab, $0a, $ff, $fb, $f4, $fb, $fa, $fa, $f2, $f5, $7f, $f8, $e2, $ee, $0e, $0e
+        .byte $bf, $0c, $ff, $f4, $f2, $f3, $f2, $f5, $f5, $f3, $ff, $f1, $f4, $f2, $f1, $f3
+        .byte $01, $02, $7e, $21, $11, $12, $3f, $21, $88, $f9, $7d, $8e, $bc, $cc, $7f, $dd
+        .byte $dd, $cc, $0d, $7f, $31, $23, $33, $05, $77, $52, $f3, $5f, $5f, $46, $e4, $13
+        .byte $76, $32, $1f, $03, $57, $f1, $2d, $0d, $7e, $12, $11, $11, $7f, $12, $12, $21
+        .byte $02, $7f, $11, $11, $22, $01, $7f, $12, $21, $11, $01, $7d, $11, $fd, $f1, $7f
+        .byte $53, $54, $43, $05, $77, $54, $42, $54, $7f, $54, $55, $45, $04, $7f, $d2, $11
+        .byte $e1, $0e, $7e, $41, $11, $32, $07, $33, $02, $ff, $ef, $ee, $f0, $ee, $f3, $f2
+        .byte $f1, $df, $ef, $f3, $f2, $ef, $f3, $0a, $ff, $08, $03, $0d, $05, $08, $05, $0d
+        .byte $ff, $09, $08, $f8, $fc, $f8, $06, $0d, $ff, $01, $0a, $fa, $f5, $f5, $f5, $f5
+        .byte $ff, $f5, $f5, $f5, $f5, $f5, $f5, $f6, $ff, $f8, $f8, $f7, $f8, $f9, $f7, $f9
+        .byte $ff, $f6, $f9, $f5, $f6, $f7, $f8, $f9, $ff, $fa, $f9, $f9, $f6, $fa, $f6, $f8
+        .byte $ff, $f5, $fb, $fa, $f5, $f6, $f9, $f9, $ff, $f5, $f7, $fa, $fd, $ff, $fe, $fb
+        .byte $7f, $fc, $ee, $ef, $01, $7f, $1e, $11, $11, $01, $7f, $11, $f1, $1f, $01, $75
+        .byte $11, $11, $01, $7f, $e1, $cf, $cc, $09, $7f, $a9, $99, $89, $09, $7f, $99, $ad
+        .byte $9a, $08, $7f, $99, $a9, $9a, $09, $ff, $fd, $f9, $01, $ff, $fd, $0a, $fd, $ff
+        .byte $f7, $fe, $f8, $fe, $01, $fd, $04, $8f, $fb, $f7, $fd, $01
+        ; Frame 4 -> 5
+        .byte $6f, $42, $43, $41, $ff, $05, $02, $05, $04, $03, $f3, $f3, $ff, $f2, $f3, $f4
+        .byte $f5, $f5, $f4, $f5, $ff, $f3, $f3, $fe, $ff, $fb, $f8, $f6, $ff, $f7, $f7, $fe
+        .byte $ed, $ec, $ec, $ec, $ff, $ee, $ee, $ec, $ec, $eb, $ec, $ed, $ff, $f5, $fe, $fb
+        .byte $f6, $01, $ee, $f2, $ff, $ee, $fa, $f5, $f1, $ef, $f1, $f4, $ff, $fd, $f8, $fe
+        .byte $f0, $f6, $f3, $f3, $ff, $f2, $fb, $f3, $f2, $f6, $f9, $f4, $bf, $f3, $f7, $03
+        .byte $06, $03, $04, $ff, $fd, $fe, $f4, $f5, $f5, $f5, $f6, $ff, $f6, $f8, $f7, $f8
+        .byte $f8, $f8, $f8, $ff, $f7, $f7, $f7, $f7, $f8, $f8, $f8, $ff, $f8, $f7, $f8, $f7
+        .byte $f7, $f6, $f7, $ff, $f6, $f4, $f6, $f6, $f5, $f5, $f5, $7f, $89, $99, $98, $08
+        .byte $ff, $f9, $f9, $f6, $f6, $f9, $f9, $fa, $7f, $89, $88, $88, $08, $ff, $f6, $f5
+        .byte $f6, $f7, $f6, $f1, $f7, $ff, $f1, $f5, $f1, $f4, $f5, $f4, $f2, $8f, $f2, $f6
+        .byte $f6, $f6, $44, $ff, $62, $df, $0d, $7f, $ed, $2e, $14, $02, $6e, $ff, $3f, $02
+        .byte $fd, $01, $ff, $20, $22, $21, $23, $ff, $1d, $1d, $21, $1e, $24, $23, $20, $36
+        .byte $24, $f5, $ff, $ff, $03, $01, $13, $16, $11, $02, $ff, $05, $04, $07, $14, $fe
+        .byte $fb, $fc, $7f, $3c, $dd, $2b, $0e, $5b, $fd, $46, $0c, $7f, $1b, $dd, $dc, $0c
+        .byte $7f, $cc, $cc, $bd, $0b, $7f, $cc, $cc, $cb, $0d, $7f, $cc, $bb, $bb, $0b, $77
+        .byte $db, $dd, $ec, $7f, $ff, $fe, $ff, $0f, $1f, $ef, $eb, $0f, $5f, $ee, $fe, $ff
+        .byte $7f, $eb, $dc, $dd, $0e, $7f, $cf, $cb, $db, $0e, $0f, $fb, $cd, $79, $df, $21
+        .byte $0f, $ff, $fd, $01, $01, $ff, $02, $12, $10, $ff, $0b, $14, $14, $0d, $10, $0c
+        .byte $12, $ff, $0d, $0b, $04, $07, $03, $11, $14, $ff, $0f, $15, $08, $11, $0f, $0e
+        .byte $11, $ff, $0e, $0d, $11, $0e, $0e, $0f, $0b, $fd, $09, $02, $04, $fc, $fd, $f6
+        .byte $fe, $f4, $ff, $0a, $05, $08, $f3, $ff, $f2, $fd, $f9, $07, $06, $03, $09, $ef
+        .byte $09, $08, $08, $07, $07, $08, $f7, $07, $04, $fb, $01, $fa, $f7, $7f, $f9, $55
+        .byte $65, $04, $7f, $36, $33, $33, $03, $7f, $23, $52, $34, $03, $7f, $33, $33, $22
+        .byte $02, $ff, $03, $06, $05, $07, $09, $07, $09, $7f, $33, $32, $33, $03, $ff, $03
+        .byte $04, $06, $0a, $03, $04, $03, $7f, $44, $34, $44, $04, $ff, $06, $09, $03, $05
+        .byte $06, $0b, $07, $ff, $06, $05, $0a, $05, $04, $06, $0b, $8f, $08, $09, $06, $04
+        ; Frame 5 -> 6
+        .byte $ff, $f7, $f7, $f7, $f6, $f9, $f8, $f5, $bf, $f5, $f7, $f5, $f6, $f6, $fc, $7f
+        .byte $c4, $dd, $ec, $0d, $7f, $11, $99, $9b, $0a, $ff, $fb, $fa, $fa, $e3, $e2, $e5
+        .byte $e0, $ff, $e8, $e8, $e3, $e8, $e2, $e2, $e7, $fb, $0a, $01, $0c, $02, $09, $0a
+        .byte $ff, $0a, $04, $03, $f2, $f3, $f6, $0c, $ff, $05, $09, $05, $f4, $fd, $ff, $04
+        .byte $73, $a4, $bc, $0e, $ff, $fe, $fc, $f7, $f6, $f6, $f4, $f8, $6b, $88, $22, $02
+        .byte $7f, $32, $44, $44, $04, $7f, $45, $35, $43, $04, $7f, $45, $33, $44, $04, $37
+        .byte $14, $11, $01, $7f, $76, $77, $77, $07, $f7, $07, $07, $02, $06, $07, $08, $7f
+        .byte $66, $66, $66, $06, $df, $03, $09, $04, $03, $04, $07, $e5, $0d, $fc, $ff, $fa
+        .byte $0d, $1f, $02, $7f, $ff, $ff, $ff, $0f, $7f, $ff, $fe, $fe, $03, $5f, $11, $35
+        .byte $65, $63, $23, $75, $fb, $03, $05, $16, $19, $16, $18, $ff, $14, $14, $17, $14
+        .byte $18, $18, $15, $7d, $dd, $32, $61, $ff, $ff, $06, $fe, $0e, $0e, $0c, $0a, $ff
+        .byte $09, $08, $07, $0d, $f8, $f9, $fa, $ff, $fa, $fa, $f7, $f9, $fd, $fb, $f8, $37
+        .byte $d8, $c3, $0e, $7f, $8b, $fe, $aa, $0b, $7f, $aa, $ab, $ab, $0a, $ff, $f8, $f8
+        .byte $f7, $fc, $f9, $fa, $fa, $ff, $f9, $f8, $f8, $f7, $f7, $f7, $f7, $ff, $f7, $fc
+        .byte $fa, $ff, $fe, $fb, $fe, $7f, $99, $99, $ab, $09, $7f, $aa, $c9, $bb, $0a, $7f
+        .byte $aa, $aa, $9a, $0a, $7f, $e9, $aa, $5a, $0f, $ff, $fe, $fc, $f4, $f9, $fb, $f8
+        .byte $fc, $8f, $f5, $f7, $f9, $fb, $ff, $0f, $0e, $0e, $10, $0d, $0d, $10, $ff, $11
+        .byte $0e, $0d, $0f, $0d, $0a, $04, $ff, $03, $0a, $05, $06, $07, $05, $03, $ff, $04
+        .byte $04, $0d, $0a, $0c, $0a, $06, $ff, $0a, $06, $09, $ff, $fb, $fc, $fd, $7a, $1e
+        .byte $ac, $0d, $ff, $0f, $12, $11, $13, $15, $13, $18, $ff, $12, $19, $14, $0c, $04
+        .byte $08, $1c, $ff, $1b, $17, $17, $03, $07, $0c, $0b, $ff, $0e, $06, $09, $0f, $0c
+        .byte $08, $09, $ff, $0d, $0a, $06, $04, $01, $02, $05, $7f, $14, $32, $1f, $01, $7f
+        .byte $c1, $bc, $bc, $0c, $7f, $aa, $1a, $c1, $0b, $7f, $8a, $88, $99, $0a, $7b, $f9
+        .byte $55, $62, $7f, $11, $11, $11, $01, $7d, $21, $16, $11, $0b, $11, $01, $d7, $01
+        .byte $0b, $fd, $02, $06, $f5, $0e, $08, $fc, $01, $02, $8f, $05, $0b, $02, $fc
+        ; Frame 6 -> 7
+        .byte $ff, $09, $0a, $0a, $06, $0b, $0c, $06, $ff, $06, $09, $07, $08, $09, $13, $16
+        .byte $ff, $19, $11, $14, $0f, $0c, $11, $11, $ff, $14, $16, $09, $0a, $0f, $0a, $0e
+        .byte $ff, $0f, $10, $0d, $08, $09, $0a, $08, $ff, $0a, $0b, $08, $0a, $09, $09, $0b
+        .byte $ff, $15, $0d, $10, $13, $0a, $18, $13, $ff, $18, $0d, $13, $0b, $0d, $0c, $10
+        .byte $ff, $0a, $0e, $0a, $0d, $14, $16, $17, $ff, $18, $0d, $17, $17, $0f, $0d, $14
+        .byte $ff, $15, $0d, $fa, $fb, $01, $fe, $ff, $ff, $08, $09, $17, $16, $12, $13, $16
+        .byte $ff, $12, $0f, $0f, $0e, $0e, $0d, $0d, $ff, $0d, $0f, $0e, $16, $11, $0e, $0d
+        .byte $ff, $0d, $0f, $0e, $0f, $0e, $0f, $0e, $ff, $0f, $12, $11, $10, $10, $13, $10
+        .byte $ff, $18, $17, $18, $18, $17, $19, $19, $ff, $19, $18, $10, $0e, $18, $18, $1a
+        .byte $ff, $18, $18, $18, $18, $18, $18, $18, $ff, $10, $19, $10, $11, $11, $16, $18
+        .byte $ff, $19, $12, $14, $12, $13, $13, $10, $8f, $13, $14, $12, $12, $ff, $1b, $1b
+        .byte $1a, $1e, $16, $16, $1b, $ff, $1e, $18, $1a, $1c, $18, $fc, $fd, $7f, $cf, $9d
+        .byte $bb, $0d, $ff, $fc, $fc, $11, $0d, $0f, $01, $ff, $fd, $04, $0d, $f3, $f3, $f4
+        .byte $f2, $ff, $f4, $f4, $f1, $f3, $f1, $f3, $f3, $7f, $aa, $b8, $ab, $0c, $ff, $fa
+        .byte $fc, $f9, $f5, $f5, $f8, $fd, $ff, $fd, $fc, $fd, $f8, $f3, $f8, $f8, $ff, $f7
+        .byte $ef, $f6, $f6, $fa, $f2, $f4, $ff, $f6, $f6, $f5, $ed, $ec, $f3, $fa, $ff, $f7
+        .byte $ef, $03, $01, $fb, $fa, $02, $ff, $fd, $f9, $f8, $f9, $f7, $f9, $fa, $77, $88
+        .byte $b9, $89, $7f, $88, $99, $aa, $09, $7f, $a9, $cb, $cd, $0b, $ff, $f8, $f7, $f8
+        .byte $f7, $f8, $f9, $f7, $ff, $f6, $f7, $fb, $fb, $f8, $f8, $f7, $ff, $f6, $f6, $f6
+        .byte $f4, $f4, $f5, $f5, $7f, $bb, $bd, $38, $0b, $ff, $fc, $fc, $f3, $f9, $fc, $f8
+        .byte $fc, $8f, $f6, $f5, $f7, $fc, $ff, $27, $28, $26, $29, $23, $23, $24, $ff, $27
+        .byte $21, $24, $28, $22, $07, $04, $fb, $0b, $05, $09, $04, $0a, $01, $bf, $07, $09
+        .byte $19, $17, $1d, $05, $ff, $0c, $02, $19, $08, $08, $09, $09, $ff, $0a, $0b, $0b
+        .byte $0c, $0c, $09, $0d, $ff, $14, $16, $12, $1a, $1a, $1a, $1f, $ff, $18, $1d, $14
+        .byte $12, $13, $0f, $24, $ff, $22, $1f, $1f, $0f, $0f, $15, $13, $ff, $13, $0a, $0f
+        .byte $13, $16, $0e, $0f, $ff, $12, $14, $14, $0b, $08, $10, $17, $ff, $13, $0b, $09
+        .byte $09, $07, $07, $0e, $ff, $09, $0b, $0b, $0c, $0b, $0c, $0b, $ff, $0b, $0b, $0b
+        .byte $0e, $0a, $0b, $0c, $ff, $0b, $0b, $0b, $0b, $0b, $0b, $0a, $ff, $0a, $07, $08
+        .byte $08, $07, $08, $08, $ff, $09, $09, $09, $09, $0a, $0a, $08, $ff, $08, $09, $08
+        .byte $08, $09, $09, $09, $ff, $08, $07, $08, $07, $08, $08, $08, $ff, $08, $13, $09
+        .byte $07, $06, $0a, $0e, $ff, $12, $09, $0e, $07, $08, $06, $07, $8f, $09, $0a, $06
+        .byte $09
+        ; Frame 7 -> 8
+        .byte $ff, $b8, $b6, $b8, $b6, $c0, $bd, $ba, $ff, $b5, $bf, $b9, $b4, $bc, $ee, $f3
+        .byte $ff, $f0, $ed, $f4, $e7, $e8, $ea, $ed, $ff, $ed, $ec, $ce, $ce, $cf, $e1, $ea
+        .byte $ff, $df, $e9, $ce, $41, $49, $44, $49, $ff, $39, $3a, $42, $39, $4a, $4a, $40
+        .byte $ff, $ef, $fb, $f6, $f2, $ff, $e6, $ed, $ff, $e7, $f7, $f0, $1d, $27, $1a, $f2
+        .byte $ff, $fc, $fd, $03, $25, $f4, $f3, $ee, $ff, $ee, $f6, $f0, $f0, $f6, $f5, $f2
+        .byte $ff, $f2, $f6, $01, $ff, $ff, $02, $01, $ff, $ff, $fd, $ec, $ed, $ee, $ec, $ee
+        .byte $ff, $ed, $e8, $e7, $e7, $e6, $e7, $e8, $ff, $e7, $e6, $e7, $ed, $ed, $e7, $e8
+        .byte $ff, $e7, $e7, $e9, $e8, $e8, $e7, $e8, $ff, $e7, $ee, $ed, $ec, $eb, $eb, $ea
+        .byte $ff, $ea, $ea, $eb, $eb, $eb, $ea, $ec, $ff, $eb, $ec, $eb, $eb, $ea, $ea, $ea
+        .byte $ff, $ed, $ee, $ee, $ec, $ed, $ed, $ed, $ff, $ec, $e9, $ec, $ec, $ec, $f6, $e8
+        .byte $ff, $e2, $ee, $f2, $ef, $ef, $ee, $f4, $8f, $ef, $ec, $ed, $ed, $ff, $f3, $f5
+        .byte $f5, $f4, $f3, $f5, $f5, $ff, $f4, $f4, $f6, $f6, $f5, $f4, $f8, $ff, $f1, $f7
+        .byte $fd, $ea, $ee, $e9, $f4, $ff, $ee, $ec, $f3, $f7, $f1, $f3, $f9, $ff, $f5, $fc
+        .byte $f5, $cc, $ca, $cb, $c7, $ff, $d0, $d1, $c9, $ce, $c6, $c8, $cb, $ff, $f3, $eb
+        .byte $eb, $f6, $ed, $f6, $f8, $ff, $f5, $f1, $ee, $db, $d7, $e0, $f9, $ff, $f2, $f4
+        .byte $ee, $db, $f3, $ef, $f1, $ff, $f2, $f5, $f1, $ef, $eb, $f2, $f0, $ff, $ee, $ee
+        .byte $ef, $f6, $f8, $f3, $ed, $ff, $f1, $f8, $fc, $fb, $f8, $f8, $fb, $ff, $f8, $f6
+        .byte $f5, $f5, $f5, $f7, $f7, $ff, $f8, $f8, $f8, $fa, $f7, $f6, $f6, $ff, $f7, $f8
+        .byte $f8, $f8, $f7, $f7, $f8, $ff, $f8, $f6, $f6, $fc, $fc, $f7, $fa, $7f, $ec, $ec
+        .byte $cc, $0b, $ff, $fc, $fb, $f5, $f9, $fe, $ff, $fe, $ff, $fa, $fb, $f9, $f7, $f7
+        .byte $f8, $f8, $ff, $f6, $f4, $f3, $f7, $f9, $ee, $f8, $ff, $f6, $f9, $ee, $f6, $f3
+        .byte $f8, $ea, $8f, $f0, $f0, $fa, $f3, $76, $df, $dd, $0c, $ff, $fe, $fd, $fa, $fd
+        .byte $fa, $f0, $f7, $ff, $02, $e9, $ed, $f4, $ed, $f7, $f1, $ff, $fc, $ff, $fc, $f5
+        .byte $ff, $e8, $e6, $ff, $ef, $e8, $f8, $0d, $14, $12, $0c, $ff, $0c, $0f, $04, $06
+        .byte $09, $13, $0b, $ff, $ee, $f1, $f7, $e3, $e8, $f3, $e5, $ff, $f7, $e9, $fa, $f2
+        .byte $fe, $02, $d8, $ff, $dd, $db, $de, $09, $0c, $09, $0b, $ff, $09, $0d, $0c, $07
+        .byte $09, $0c, $0b, $ff, $08, $09, $0f, $11, $12, $11, $0f, $cf, $0f, $10, $01, $02
+        .byte $03, $43, $12, $01, $1f, $22, $32, $02, $7f, $42, $33, $44, $04, $7d, $24, $54
+        .byte $52, $ff, $f8, $f9, $f7, $f8, $f7, $f6, $f7, $ff, $f7, $f7, $02, $05, $f9, $f8
+        .byte $f6, $ff, $f7, $f8, $f8, $f9, $f8, $f8, $f8, $f7, $02, $0a, $02, $ff, $fc, $07
+        .byte $f5, $f7, $06, $02, $ff, $f9, $0f, $a3, $2f
+        ; Frame 8 -> 9
+        .byte $ff, $e4, $e3, $e5, $e0, $e8, $e8, $e3, $ff, $e1, $e7, $e5, $e3, $e7, $04, $fe
+        .byte $3f, $5d, $3e, $14, $9f, $fe, $fe, $ee, $f1, $ef, $ff, $fc, $ff, $f1, $10, $13
+        .byte $10, $11, $ff, $0d, $0d, $0e, $0c, $0f, $13, $0d, $ff, $ee, $f7, $f9, $ea, $f4
+        .byte $f7, $f3, $ff, $f6, $f7, $fb, $01, $03, $03, $ee, $ff, $f2, $ec, $ef, $06, $fc
+        .byte $fc, $fe, $7f, $dd, $dd, $ee, $0d, $73, $ed, $ed, $0f, $7f, $cc, $dc, $ee, $0d
+        .byte $7f, $cf, $cd, $cd, $0c, $7f, $cc, $ec, $cf, $0b, $7f, $eb, $dd, $dd, $0c, $7d
+        .byte $ed, $13, $2f, $ff, $f7, $f7, $f5, $f6, $f6, $f5, $f4, $ff, $f5, $f5, $fd, $ff
+        .byte $f7, $f6, $f4, $ff, $f4, $f4, $f4, $f5, $f4, $f4, $f4, $7f, $de, $fe, $1e, $0e
+        .byte $ff, $f1, $ff, $fe, $fe, $fe, $fe, $01, $0f, $9e, $ee, $ff, $c4, $c6, $c9, $bf
+        .byte $ce, $cd, $c3, $ff, $c0, $ca, $c9, $c3, $cc, $fd, $f5, $ff, $f4, $fc, $f6, $ec
+        .byte $ee, $ed, $ec, $ff, $ec, $ed, $d2, $db, $d7, $e8, $ee, $ff, $eb, $f2, $df, $dd
+        .byte $da, $dc, $dc, $ff, $de, $dd, $de, $e0, $dd, $db, $df, $ff, $f4, $ea, $ed, $f0
+        .byte $e7, $f2, $eb, $ff, $f3, $e6, $ee, $e6, $e5, $e4, $e7, $ff, $e3, $e8, $e5, $e3
+        .byte $ec, $eb, $ed, $ff, $ec, $ef, $ec, $ec, $ee, $f0, $ec, $ff, $ec, $f0, $f3, $f3
+        .byte $ef, $ef, $ef, $ff, $eb, $eb, $f8, $f7, $f5, $f6, $f6, $ff, $f4, $f5, $f5, $f5
+        .byte $f5, $f6, $f5, $ff, $f4, $f4, $f4, $f7, $f5, $f6, $f6, $ff, $f5, $f4, $f4, $f4
+        .byte $f5, $f5, $f4, $ff, $f4, $f6, $f5, $f6, $f6, $f5, $f5, $ff, $f9, $fa, $f9, $fb
+        .byte $f7, $f7, $fb, $ff, $fa, $fa, $f5, $f6, $f7, $f7, $fa, $7f, $9a, $eb, $cd, $0c
+        .byte $ff, $f5, $f1, $f7, $f8, $f9, $fa, $f3, $ff, $fa, $f5, $eb, $f4, $f3, $f5, $f4
+        .byte $8f, $f0, $f3, $f6, $f5, $ff, $d7, $d1, $d4, $d5, $df, $db, $dc, $ff, $d6, $df
+        .byte $d8, $d2, $dc, $0c, $18, $ff, $18, $0b, $17, $0c, $0a, $0f, $12, $ff, $15, $15
+        .byte $f2, $f0, $ed, $03, $0b, $ff, $fe, $08, $ea, $f2, $f1, $f2, $ee, $ff, $f5, $f6
+        .byte $ef, $f3, $ef, $f0, $f3, $ff, $0d, $08, $0a, $08, $04, $0f, $09, $ff, $11, $04
+        .byte $0d, $f9, $fb, $ff, $01, $f8, $fe, $1a, $19, $1c, $ff, $1d, $19, $1b, $1b, $16
+        .byte $19, $1a, $ff, $1a, $18, $0f, $12, $11, $0e, $0e, $ff, $0f, $11, $13, $14, $10
+        .byte $12, $13, $ff, $12, $0e, $0f, $0e, $0e, $0f, $0f, $ff, $0d, $0e, $0d, $14, $11
+        .byte $0f, $0f, $ff, $0d, $0c, $0d, $0d, $0d, $0d, $0d, $ff, $0d, $10, $11, $14, $15
+        .byte $11, $12, $ff, $0c, $0d, $0b, $0c, $0c, $0b, $0c, $ff, $0b, $0b, $11, $14, $0c
+        .byte $0c, $0b, $ff, $0d, $0d, $0c, $0c, $0c, $0d, $0d, $ff, $11, $1d, $11, $13, $14
+        .byte $15, $19, $ff, $12, $11, $17, $10, $0f, $11, $0c, $8f, $13, $0d, $12, $10
+        ; Frame 9 -> 10
+        .byte $59, $42, $51, $3f, $25, $23, $c3, $37, $b1, $ef, $01, $7f, $21, $24, $ef, $0e
+        .byte $7f, $cc, $5e, $33, $05, $7f, $44, $56, $35, $04, $7f, $45, $73, $45, $05, $7f
+        .byte $44, $63, $54, $06, $7f, $66, $36, $12, $01, $7f, $42, $22, $42, $03, $7f, $42
+        .byte $55, $34, $03, $7f, $11, $22, $22, $02, $7f, $32, $33, $32, $03, $7f, $44, $23
+        .byte $32, $03, $7f, $23, $33, $33, $04, $7f, $23, $31, $23, $02, $7f, $32, $22, $22
+        .byte $02, $7f, $22, $31, $32, $02, $7f, $22, $22, $22, $02, $7f, $21, $11, $11, $01
+        .byte $7f, $25, $21, $22, $03, $0f, $21, $22, $ff, $f7, $f9, $f8, $f5, $f8, $f9, $f6
+        .byte $ff, $f5, $f7, $f7, $f7, $f8, $fa, $fa, $7f, $b8, $9c, $9b, $0b, $ff, $f9, $f7
+        .byte $f6, $f9, $f9, $fb, $fd, $ff, $fb, $fd, $fb, $f7, $f6, $f7, $f8, $ff, $f8, $f8
+        .byte $f9, $f8, $f9, $f7, $f8, $7f, $ab, $d9, $ab, $0d, $3f, $ca, $b8, $8a, $ff, $fe
+        .byte $ff, $fe, $f7, $f6, $f6, $f6, $ff, $f6, $f6, $f5, $f5, $f6, $f6, $f5, $ff, $f6
+        .byte $f5, $f6, $f6, $f6, $f6, $f6, $ff, $f6, $f6, $ff, $ff, $fd, $fd, $ff, $7f, $cd
+        .byte $bb, $bb, $0c, $7f, $cb, $fb, $bc, $0b, $7f, $bb, $cb, $bb, $0b, $7f, $bb, $cc
+        .byte $cd, $0c, $7f, $ee, $ee, $ed, $0e, $7f, $ef, $cc, $fe, $0f, $0f, $ee, $fe, $7f
+        .byte $8c, $cc, $ac, $0b, $ff, $fb, $fc, $f6, $fb, $fc, $fb, $f9, $0f, $98, $cc, $7f
+        .byte $43, $36, $54, $05, $ff, $05, $05, $08, $06, $08, $05, $08, $ff, $06, $07, $09
+        .byte $06, $08, $05, $0a, $ff, $06, $06, $05, $09, $02, $09, $0b, $ff, $04, $0a, $08
+        .byte $ff, $01, $01, $01, $7f, $11, $21, $13, $03, $7f, $31, $33, $73, $06, $7f, $66
+        .byte $36, $15, $07, $7f, $34, $32, $45, $06, $7f, $65, $46, $53, $05, $7f, $34, $64
+        .byte $47, $02, $4f, $63, $11, $01, $7f, $31, $32, $23, $02, $7f, $12, $22, $21, $02
+        .byte $7f, $23, $22, $22, $02, $7d, $12, $21, $11, $7f, $ff, $ee, $de, $0e, $7b, $ff
+        .byte $f2, $ef, $7f, $ef, $ff, $ef, $0e, $67, $71, $42, $05, $35, $14, $f1, $0a, $11
+        ; Frame 10 -> 11
+        .byte $7f, $dd, $dd, $dd, $0d, $7f, $ed, $ce, $1e, $01, $45, $12, $01, $1f, $11, $fe
+        .byte $0e, $7d, $ef, $33, $32, $7f, $23, $34, $22, $01, $0f, $11, $f2, $7f, $12, $31
+        .byte $21, $0f, $28, $11, $50, $f1, $7c, $22, $43, $03, $7f, $33, $11, $11, $01, $7f
+        .byte $21, $21, $22, $02, $7f, $21, $13, $21, $03, $7f, $33, $33, $33, $02, $7f, $23
+        .byte $22, $22, $02, $7f, $11, $11, $22, $02, $7f, $11, $11, $11, $01, $7f, $12, $11
+        .byte $21, $01, $77, $11, $21, $12, $7b, $13, $21, $11, $0f, $11, $11, $7f, $32, $23
+        .byte $32, $02, $5f, $23, $33, $f2, $7f, $1e, $f2, $f1, $01, $7f, $ee, $11, $21, $03
+        .byte $7f, $32, $52, $56, $06, $7f, $44, $56, $66, $05, $7f, $de, $ed, $ed, $0e, $7f
+        .byte $dd, $2d, $23, $0e, $7f, $ff, $3e, $bb, $0c, $7f, $cc, $bc, $bb, $0c, $7f, $bb
+        .byte $ca, $bd, $0a, $33, $db, $ef, $7f, $ff, $ff, $ef, $0e, $77, $ef, $ff, $fe, $7f
+        .byte $ff, $fe, $ff, $0f, $7f, $ff, $ff, $ff, $0f, $21, $ff, $2f, $ff, $ff, $0f, $7f
+        .byte $ff, $ef, $ee, $0e, $7f, $cf, $ff, $fe, $0e, $7f, $ff, $fc, $ff, $0f, $0f, $dd
+        .byte $fe, $7f, $32, $23, $22, $02, $7f, $32, $33, $f2, $01, $7f, $f1, $e2, $ef, $01
+        .byte $5e, $1f, $12, $01, $fe, $01, $02, $09, $09, $09, $09, $ff, $08, $07, $0a, $08
+        .byte $09, $09, $08, $32, $ff, $01, $7f, $f2, $51, $45, $0e, $7f, $ff, $5f, $21, $01
+        .byte $1b, $12, $21, $7f, $11, $12, $21, $02, $17, $22, $ff, $7f, $ef, $ef, $fe, $0f
+        .byte $67, $fe, $ff, $0f, $7f, $ee, $ee, $ee, $0f, $67, $ff, $ff, $0f, $7f, $ee, $fe
+        .byte $ee, $0f, $7b, $ee, $ef, $ee, $7f, $fe, $ef, $fe, $0f, $57, $2f, $ff, $01, $6b
+        .byte $f2, $ff, $0e, $0f, $ff, $ff
+        ; Frame 11 -> 12
+        .byte $7f, $22, $12, $22, $01, $7f, $11, $21, $21, $01, $16, $23, $01, $76, $1f, $12
+        .byte $02, $07, $33, $03, $00, $5f, $ee, $ee, $ee, $77, $ef, $ff, $ff, $2f, $de, $fd
+        .byte $0f, $2a, $f1, $01, $3d, $3f, $12, $01, $5c, $ff, $ff, $07, $ff, $0f, $5b, $11
+        .byte $ff, $0f, $7e, $11, $11, $11, $7f, $f1, $ff, $ff, $0f, $3a, $ff, $ff, $3b, $11
+        .byte $ff, $0f, $7f, $21, $12, $11, $02, $32, $f1, $01, $57, $fe, $ff, $0f, $0b, $ff
+        .byte $0f, $7f, $ef, $fe, $ef, $0f, $7f, $fe, $ee, $1f, $01, $03, $11, $33, $11, $1f
+        .byte $7c, $ee, $ee, $0e, $7f, $ee, $ee, $ef, $0e, $7f, $ee, $cf, $ed, $0b, $7f, $df
+        .byte $ef, $de, $0b, $6f, $aa, $db, $ff, $7b, $ff, $ef, $ff, $7f, $ef, $ee, $ff, $0f
+        .byte $00, $64, $11, $01, $2a, $f1, $01, $00, $58, $11, $01, $4e, $ff, $ef, $4b, $ee
+        .byte $e1, $7f, $fe, $cd, $cc, $0c, $60, $f2, $44, $1f, $02, $01, $7f, $ab, $b9, $ab
+        .byte $0b, $7f, $aa, $99, $ea, $0e, $7f, $ef, $dc, $ec, $0b, $7f, $ee, $ac, $bd, $0a
+        .byte $7f, $cd, $fa, $fe, $0f, $3f, $ff, $ff, $ff, $7f, $22, $11, $f2, $0f, $25, $ff
+        .byte $0f, $56, $21, $11, $32, $f2, $01, $7c, $31, $24, $01, $33, $32, $ff, $7e, $ef
+        .byte $ff, $ee, $77, $ef, $fd, $ef, $7f, $fe, $ee, $ee, $0d, $41, $1d, $76, $11, $11
+        .byte $0f, $10, $01, $67, $ff, $ff, $0f, $28, $ff, $54, $ff, $0f, $01, $0f
+        ; Frame 12 -> 13
+        .byte $7f, $21, $12, $32, $01, $7e, $12, $11, $66, $7f, $77, $56, $56, $06, $7f, $65
+        .byte $42, $54, $06, $7f, $65, $24, $21, $02, $7f, $12, $22, $11, $02, $7f, $55, $65
+        .byte $55, $06, $7f, $65, $35, $33, $06, $7f, $65, $26, $64, $05, $7f, $45, $54, $14
+        .byte $03, $7f, $24, $43, $75, $07, $ff, $08, $08, $04, $04, $04, $05, $04, $7f, $74
+        .byte $67, $66, $06, $7f, $66, $55, $64, $07, $7f, $55, $54, $55, $05, $7f, $55, $44
+        .byte $55, $05, $7f, $55, $65, $66, $06, $7f, $45, $54, $56, $06, $7f, $56, $65, $56
+        .byte $05, $ff, $05, $06, $05, $05, $06, $08, $07, $7f, $56, $42, $45, $05, $0f, $63
+        .byte $55, $7f, $22, $32, $22, $03, $3f, $33, $33, $f2, $37, $e1, $ff, $01, $7e, $21
+        .byte $11, $ee, $ff, $fe, $fd, $01, $f7, $f4, $f5, $f5, $ff, $f7, $f6, $f7, $f8, $f5
+        .byte $f4, $f6, $0f, $11, $f1, $7d, $11, $9c, $eb, $7f, $ef, $9e, $ef, $0f, $3d, $fe
+        .byte $ef, $0f, $7f, $ee, $fe, $ef, $0d, $4f, $fe, $11, $01, $70, $f1, $0f, $08, $01
+        .byte $00, $40, $0f, $7f, $ff, $ff, $ff, $0f, $71, $ff, $ff, $7f, $ff, $ff, $ff, $0f
+        .byte $36, $1f, $1f, $25, $f2, $0f, $04, $0f, $7f, $ef, $fe, $ff, $0e, $5f, $ef, $ee
+        .byte $de, $4d, $de, $f1, $4f, $fe, $ef, $0f, $fe, $fe, $fe, $f5, $f5, $f6, $f5, $ff
+        .byte $f7, $f8, $f6, $f8, $f7, $f6, $f8, $7f, $21, $32, $13, $02, $7f, $32, $b2, $bd
+        .byte $03, $2f, $34, $b3, $02, $1b, $e1, $31, $77, $21, $f2, $32, $07, $f2, $0f, $00
+        .byte $24, $f1, $7c, $11, $11, $01, $4b, $f1, $ff, $49, $11, $01, $43, $11, $01, $7f
+        .byte $11, $11, $11, $01, $26, $f1, $0f, $41, $f2, $00
+        ; Frame 13 -> 14
+        .byte $3f, $32, $13, $33, $ff, $01, $02, $02, $02, $03, $08, $06, $ff, $04, $08, $07
+        .byte $04, $06, $04, $05, $7f, $34, $31, $63, $07, $ff, $07, $08, $05, $02, $02, $02
+        .byte $02, $7f, $32, $32, $23, $02, $7f, $36, $73, $63, $07, $ff, $05, $04, $03, $04
+        .byte $03, $04, $08, $ff, $06, $08, $05, $03, $02, $01, $02, $7f, $22, $12, $22, $01
+        .byte $7f, $22, $23, $33, $02, $7f, $22, $33, $33, $02, $7f, $23, $33, $44, $04, $7f
+        .byte $44, $24, $43, $04, $7f, $45, $44, $44, $04, $7f, $34, $43, $33, $03, $7f, $33
+        .byte $22, $22, $01, $7f, $21, $23, $32, $01, $7d, $11, $11, $11, $7f, $32, $33, $53
+        .byte $03, $7f, $36, $31, $33, $04, $0f, $42, $32, $7e, $ff, $ef, $ff, $7e, $ff, $ff
+        .byte $ed, $76, $dd, $fe, $0e, $7c, $ff, $ef, $0e, $ff, $fe, $fe, $ff, $f9, $f7, $f8
+        .byte $f9, $ff, $f9, $f8, $f9, $f9, $f7, $f7, $f8, $5d, $1e, $fe, $0e, $7b, $ff, $ad
+        .byte $eb, $7f, $df, $ae, $ff, $0f, $7f, $ef, $ef, $ee, $0e, $7f, $ee, $ee, $ef, $0e
+        .byte $5f, $ff, $11, $1f, $34, $ff, $0f, $2a, $1f, $0f, $08, $0f, $00, $10, $0f, $75
+        .byte $f1, $ff, $01, $7d, $21, $22, $22, $7f, $ff, $ff, $1f, $0f, $65, $ff, $1f, $05
+        .byte $ff, $ff, $f0, $ef, $ef, $ef, $f1, $f0, $ef, $ff, $ef, $f1, $ee, $ee, $ef, $fe
+        .byte $fa, $7f, $bc, $c9, $ca, $08, $ff, $fb, $fb, $f4, $f3, $f5, $f9, $f7, $ff, $f9
+        .byte $f6, $f3, $f4, $f4, $f5, $f4, $ff, $f6, $f6, $f5, $f6, $f5, $f3, $f6, $7f, $52
+        .byte $33, $37, $06, $ff, $01, $08, $03, $fc, $fc, $fb, $08, $ff, $0a, $05, $08, $fa
+        .byte $fe, $fe, $fe, $7f, $ff, $fe, $ee, $0e, $3b, $ee, $ff, $0f, $7d, $ef, $de, $ee
+        .byte $7f, $ed, $ee, $ee, $0e, $7f, $ee, $ff, $ef, $0e, $7f, $ee, $dd, $ee, $0e, $7f
+        .byte $ee, $ee, $ee, $0e, $7f, $dd, $dd, $dd, $0d, $7f, $dd, $ed, $ed, $0d, $7f, $de
+        .byte $dd, $dd, $0d, $7f, $fe, $ee, $dd, $0f, $7e, $dd, $ee, $dd, $0f, $fd, $ee
+        ; Frame 14 -> 15
+        .byte $7f, $21, $12, $22, $01, $7f, $11, $21, $21, $02, $7f, $32, $23, $12, $02, $7f
+        .byte $22, $22, $22, $03, $7f, $33, $c2, $bb, $0b, $7f, $cc, $cc, $bb, $0c, $7f, $24
+        .byte $42, $23, $03, $77, $32, $e2, $4f, $7f, $43, $e4, $21, $01, $79, $21, $11, $01
+        .byte $43, $11, $01, $33, $11, $11, $7f, $41, $44, $44, $03, $7f, $22, $13, $32, $03
+        .byte $7f, $23, $12, $11, $02, $7f, $11, $22, $12, $02, $7f, $11, $11, $11, $01, $7c
+        .byte $22, $11, $01, $68, $11, $01, $7f, $22, $22, $11, $02, $2f, $13, $11, $02, $0f
+        .byte $22, $12, $6b, $ff, $ff, $0f, $7f, $fe, $ff, $df, $0f, $16, $ec, $0f, $7f, $11
+        .byte $fe, $ef, $0e, $7f, $ed, $bf, $bb, $0a, $7f, $cc, $cc, $aa, $0b, $5e, $ef, $11
+        .byte $01, $7e, $f1, $ce, $3e, $7f, $21, $c2, $ee, $0e, $7f, $ee, $ee, $fe, $0e, $7f
+        .byte $fe, $ee, $fe, $0e, $4f, $ee, $11, $01, $4b, $f1, $ff, $6c, $1f, $ff, $73, $ff
+        .byte $ff, $0f, $49, $1f, $01, $3f, $ff, $ff, $ef, $71, $ff, $ef, $3c, $1f, $11, $6e
+        .byte $1e, $11, $0f, $1e, $e1, $1f, $0b, $ff, $01, $ff, $f8, $f7, $f8, $f7, $f9, $f9
+        .byte $f8, $ff, $f7, $f9, $f7, $f7, $f8, $01, $ff, $5f, $21, $1f, $f1, $7d, $bf, $bb
+        .byte $ef, $7f, $ee, $bc, $ba, $0b, $7f, $bb, $cc, $bc, $0d, $61, $1f, $01, $7f, $12
+        .byte $e1, $cf, $02, $69, $d1, $11, $13, $f1, $01, $18, $ff, $56, $ff, $ff, $00, $0b
+        .byte $11, $0f, $7f, $21, $22, $11, $01, $23, $f1, $0f, $64, $11, $01, $42, $11, $7f
+        .byte $11, $11, $11, $01, $29, $ff, $02, $1f, $f1, $ff, $0f, $0d, $ff, $0f
+        ; Frame 15 -> 16
+        .byte $ff, $0b, $0c, $0b, $0b, $0a, $0b, $0b, $ff, $0b, $0a, $0b, $0b, $0a, $03, $02
+        .byte $7f, $41, $24, $23, $03, $ff, $01, $01, $07, $07, $08, $06, $05, $df, $07, $06
+        .byte $09, $ff, $ff, $ff, $1f, $ff, $ff, $0f, $7d, $1a, $e8, $ae, $ff, $ff, $fd, $01
+        .byte $fd, $ff, $fd, $f6, $ff, $fb, $f6, $f9, $ff, $02, $01, $01, $7f, $22, $11, $22
+        .byte $02, $7f, $21, $33, $22, $02, $3b, $11, $11, $01, $7f, $31, $33, $33, $03, $77
+        .byte $34, $13, $22, $7f, $33, $32, $33, $03, $7f, $24, $11, $11, $01, $7f, $11, $12
+        .byte $11, $01, $7f, $22, $21, $11, $01, $7f, $21, $12, $22, $02, $7f, $11, $11, $f2
+        .byte $01, $3f, $1f, $22, $12, $0d, $21, $01, $7f, $fd, $de, $fe, $0c, $7f, $dd, $dd
+        .byte $1e, $01, $6d, $e3, $32, $0f, $7f, $32, $ee, $df, $0d, $7b, $df, $35, $43, $7f
+        .byte $34, $44, $33, $02, $ff, $07, $03, $03, $08, $03, $05, $06, $7f, $35, $53, $53
+        .byte $05, $7f, $75, $35, $55, $05, $7f, $44, $55, $35, $05, $7f, $35, $33, $44, $04
+        .byte $7f, $55, $22, $34, $02, $7f, $43, $44, $34, $04, $7f, $33, $24, $43, $03, $7f
+        .byte $44, $33, $44, $04, $7f, $44, $34, $43, $03, $7f, $22, $12, $22, $01, $7f, $11
+        .byte $34, $11, $01, $4f, $11, $12, $01, $7f, $54, $33, $43, $05, $7f, $35, $45, $34
+        .byte $04, $0f, $44, $33, $ff, $ee, $ee, $ee, $ed, $f0, $f0, $ee, $ff, $ed, $f0, $ef
+        .byte $ee, $f0, $ff, $fc, $7f, $ec, $ea, $fd, $0b, $ff, $fd, $fd, $f3, $f4, $f5, $fa
+        .byte $fa, $ff, $f9, $fa, $f4, $e2, $e1, $e2, $e0, $ff, $e5, $e5, $e2, $e5, $e2, $e1
+        .byte $e4, $ff, $f9, $f2, $f5, $f4, $ee, $f8, $f2, $ff, $f9, $ee, $f7, $eb, $ea, $eb
+        .byte $ec, $ff, $ea, $ec, $eb, $ea, $fd, $fc, $fc, $7f, $ec, $cc, $dc, $0d, $6f, $cc
+        .byte $fd, $df, $7f, $fe, $dd, $dd, $0c, $7f, $dc, $cd, $cc, $0c, $7f, $cd, $dd, $dc
+        .byte $0c, $7f, $cc, $cc, $cc, $0c, $7f, $dc, $dd, $dc, $0d, $7f, $ef, $ee, $ef, $0f
+        .byte $7f, $ef, $dd, $ee, $0e, $7f, $fe, $ef, $fe, $0f, $7f, $cd, $dc, $dc, $0c, $7f
+        .byte $db, $dd, $dd, $0f, $0f, $bd, $dd
+        ; Frame 16 -> 17
+        .byte $7f, $34, $54, $22, $03, $ff, $04, $02, $03, $05, $02, $f9, $f7, $ff, $f6, $f9
+        .byte $f6, $fb, $fa, $fb, $f9, $6f, $99, $ff, $8a, $5f, $8b, $de, $e1, $4f, $fe, $dc
+        .byte $0f, $ff, $f8, $fa, $fb, $f5, $f9, $f6, $f4, $ff, $f7, $f7, $fa, $f8, $fe, $fb
+        .byte $f2, $ff, $f5, $f4, $f6, $ff, $fa, $fb, $fa, $7f, $ca, $cd, $dc, $0d, $ff, $fe
+        .byte $fe, $f9, $fa, $f8, $f7, $f8, $ff, $f8, $f7, $ff, $fe, $fe, $fe, $ff, $ff, $fe
+        .byte $f9, $f8, $f8, $f7, $f7, $f8, $ff, $f7, $f8, $f7, $fd, $fe, $f9, $f9, $ff, $f7
+        .byte $f8, $f9, $f8, $f9, $f9, $f8, $7f, $d8, $de, $fe, $0f, $ff, $f8, $f9, $f7, $f8
+        .byte $f8, $f7, $f7, $fb, $f7, $f8, $ff, $f9, $f8, $f7, $ff, $f8, $f8, $f7, $f8, $f8
+        .byte $f7, $f7, $ff, $ff, $f7, $ff, $fe, $fe, $f3, $f9, $fb, $f6, $fe, $fd, $fd, $fd
+        .byte $f9, $0f, $ef, $fd, $7f, $25, $52, $35, $06, $ff, $05, $05, $03, $03, $03, $08
+        .byte $08, $ff, $0b, $07, $05, $0b, $09, $0c, $08, $ff, $0c, $0c, $09, $05, $08, $07
+        .byte $05, $ff, $06, $03, $03, $10, $11, $11, $11, $ff, $10, $11, $11, $10, $12, $12
+        .byte $12, $ff, $0a, $10, $12, $06, $0d, $0c, $08, $ff, $0e, $0b, $13, $0e, $10, $0e
+        .byte $04, $ff, $07, $05, $08, $10, $16, $19, $15, $ff, $18, $12, $14, $18, $17, $12
+        .byte $15, $ff, $17, $15, $12, $10, $12, $14, $16, $ff, $17, $15, $04, $05, $09, $0a
+        .byte $06, $ff, $0a, $0b, $0a, $0b, $0a, $0c, $0b, $ff, $0c, $0c, $0c, $06, $0a, $0b
+        .byte $0c, $ff, $0b, $0c, $0c, $0c, $0b, $0b, $0c, $ff, $0c, $0b, $0a, $09, $08, $0a
+        .byte $0a, $ff, $09, $09, $0a, $09, $09, $09, $0a, $ff, $0b, $0a, $0a, $0a, $09, $08
+        .byte $09, $ff, $0b, $0b, $0b, $0b, $0c, $0c, $0c, $ff, $0a, $13, $08, $07, $09, $07
+        .byte $0e, $ff, $0c, $0a, $14, $0d, $0a, $0c, $0a, $8f, $10, $10, $0b, $09, $ff, $0f
+        .byte $11, $10, $11, $0b, $0c, $0e, $ff, $10, $0b, $0d, $10, $0b, $f6, $f4, $ff, $f2
+        .byte $f7, $f5, $f8, $fb, $f7, $f8, $ff, $f5, $f5, $05, $04, $06, $fe, $fb, $ff, $ff
+        .byte $fb, $04, $ee, $ee, $ed, $ec, $ff, $ee, $ee, $eb, $ec, $ea, $ed, $eb, $ff, $f4
+        .byte $f1, $f1, $f3, $f2, $e9, $ea, $ff, $ea, $eb, $ec, $eb, $ea, $f0, $ec, $ff, $ec
+        .byte $f3, $f1, $ef, $ef, $ed, $ec, $ff, $eb, $f1, $ef, $ed, $ee, $ef, $ef, $ff, $ee
+        .byte $ef, $f4, $f5, $f6, $f6, $f4, $ff, $f5, $f6, $f4, $f3, $f6, $f4, $f2, $ff, $f3
+        .byte $f3, $f3, $f4, $f3, $f4, $f4, $ff, $f3, $f4, $f4, $f1, $f3, $f3, $f4, $ff, $f4
+        .byte $f4, $f5, $f5, $f4, $f4, $f4, $ff, $f4, $f6, $f3, $f2, $f2, $f3, $f3, $ff, $f6
+        .byte $f6, $f7, $f6, $f6, $f7, $f6, $ff, $f6, $f6, $f3, $f2, $f6, $f5, $f7, $ff, $f6
+        .byte $f6, $f6, $f6, $f6, $f6, $f6, $ff, $f3, $ea, $f3, $f3, $f5, $f3, $ed, $ff, $ed
+        .byte $f4, $f3, $f5, $f4, $f6, $fa, $8f, $f5, $f6, $f5, $f3
+        ; Frame 17 -> 18
+        .byte $ff, $0a, $0a, $09, $0b, $08, $08, $0a, $ff, $0b, $09, $09, $0a, $09, $02, $02
+        .byte $5f, $13, $12, $12, $ff, $01, $01, $08, $05, $06, $04, $02, $7f, $24, $a5, $98
+        .byte $0a, $7f, $bb, $bb, $9a, $0b, $f9, $05, $07, $01, $08, $0a, $f7, $06, $05, $02
+        .byte $fe, $ff, $0b, $7f, $76, $d5, $ff, $0f, $7f, $fe, $ee, $de, $0e, $73, $cc, $32
+        .byte $01, $7f, $32, $ff, $11, $0e, $7e, $43, $54, $45, $7f, $44, $f5, $51, $04, $7f
+        .byte $35, $43, $33, $04, $4d, $23, $1f, $7f, $11, $11, $12, $02, $7f, $22, $24, $11
+        .byte $01, $7f, $33, $33, $33, $03, $7f, $23, $31, $62, $03, $e5, $0a, $fb, $01, $02
+        .byte $07, $1e, $01, $ff, $15, $13, $13, $17, $13, $13, $16, $ff, $17, $15, $14, $15
+        .byte $14, $0c, $0b, $ff, $0e, $09, $08, $12, $0e, $12, $0c, $ff, $10, $11, $15, $11
+        .byte $13, $0e, $08, $ff, $0d, $07, $0f, $0c, $0e, $0d, $0c, $ff, $0d, $0e, $0a, $0c
+        .byte $0c, $0d, $0d, $ff, $0d, $10, $11, $0b, $0e, $0b, $09, $ff, $0c, $0c, $0f, $09
+        .byte $0d, $0d, $07, $ff, $0a, $09, $0b, $0f, $15, $14, $15, $ff, $14, $17, $16, $15
+        .byte $14, $17, $16, $ff, $16, $15, $15, $16, $16, $14, $13, $ff, $14, $15, $03, $04
+        .byte $0c, $0b, $04, $ff, $0b, $0c, $0d, $0d, $0d, $0c, $0c, $ff, $0d, $0d, $0d, $06
+        .byte $0d, $0c, $0c, $ff, $0d, $0d, $0e, $0e, $0e, $0e, $0e, $ff, $0e, $0c, $0b, $09
+        .byte $08, $0c, $0b, $ff, $07, $05, $07, $05, $08, $07, $06, $ff, $05, $06, $0e, $0a
+        .byte $05, $05, $04, $7f, $77, $77, $77, $07, $ff, $0d, $11, $0d, $0c, $0d, $0c, $0e
+        .byte $ff, $0a, $0a, $16, $0c, $0e, $0e, $0f, $8f, $13, $10, $0d, $0e, $ff, $16, $17
+        .byte $15, $18, $12, $13, $16, $ff, $18, $12, $16, $18, $14, $fc, $f5, $ff, $f0, $fe
+        .byte $f9, $fb, $fc, $f9, $f8, $ff, $f5, $f4, $0a, $09, $09, $02, $ff, $fd, $05, $0b
+        .byte $1a, $1b, $1a, $1c, $ff, $16, $16, $19, $16, $1a, $1b, $17, $fe, $05, $03, $04
+        .byte $09, $ff, $06, $ff, $fd, $09, $01, $10, $0f, $10, $0c, $ff, $0e, $0c, $0e, $0f
+        .byte $f3, $f4, $f2, $ff, $f4, $f4, $f2, $f6, $f5, $f5, $f4, $ff, $f6, $f5, $f4, $f3
+        .byte $f2, $f3, $f4, $ff, $f3, $f2, $fc, $fa, $fd, $fc, $f7, $7f, $eb, $fe, $ef, $0e
+        .byte $fc, $ff, $f6, $f9, $fe, $fe, $74, $ff, $ff, $7f, $df, $bb, $c9, $0a, $7f, $45
+        .byte $67, $76, $06, $7f, $77, $9c, $54, $07, $7f, $55, $65, $56, $05, $ff, $fb, $f3
+        .byte $fb, $fd, $fd, $f1, $f6, $7f, $dc, $d8, $ec, $09, $0d, $db, $0c
+        ; Frame 18 -> 19
+        .byte $ff, $13, $12, $11, $15, $0f, $0f, $14, $ff, $16, $11, $12, $13, $11, $ff, $fe
+        .byte $6f, $ff, $1d, $f1, $bc, $0d, $0b, $0b, $03, $fd, $03, $08, $e6, $e1, $e3, $e3
+        .byte $ff, $e8, $e6, $e7, $e9, $e2, $e1, $e5, $7f, $b3, $4b, $6a, $05, $ff, $06, $fe
+        .byte $fe, $f5, $ee, $f2, $05, $bf, $fe, $01, $fb, $ed, $ff, $fe, $7e, $fb, $df, $ee
+        .byte $ff, $ff, $fd, $f7, $f7, $f8, $f6, $f8, $7f, $a9, $dc, $fe, $0d, $7f, $5f, $66
+        .byte $66, $06, $6f, $67, $d6, $65, $7f, $57, $55, $54, $04, $7b, $d5, $ec, $df, $7f
+        .byte $22, $23, $32, $03, $77, $23, $21, $32, $7f, $33, $23, $32, $03, $47, $11, $21
+        .byte $7f, $d6, $ff, $ff, $01, $02, $0f, $ff, $16, $16, $15, $17, $14, $13, $16, $ff
+        .byte $17, $15, $16, $16, $15, $0a, $0a, $ff, $0a, $0b, $0a, $0e, $0d, $0d, $0c, $ff
+        .byte $0c, $0c, $11, $10, $10, $0d, $0c, $ff, $0c, $0c, $10, $16, $19, $19, $17, $ff
+        .byte $16, $17, $15, $15, $18, $19, $17, $ff, $0b, $0e, $0e, $0b, $0f, $0a, $0a, $ff
+        .byte $0a, $0d, $0d, $0e, $13, $11, $0a, $ff, $0d, $0b, $0d, $14, $10, $11, $0f, $ff
+        .byte $10, $10, $10, $11, $13, $11, $11, $ff, $12, $13, $13, $11, $0f, $12, $14, $ff
+        .byte $12, $0f, $02, $03, $09, $09, $05, $ff, $07, $0a, $0a, $0b, $0b, $09, $09, $ff
+        .byte $0a, $0a, $0a, $05, $0a, $09, $08, $ff, $09, $0a, $0a, $0a, $0a, $0a, $0a, $ff
+        .byte $0a, $0a, $0a, $06, $07, $09, $09, $7f, $35, $14, $56, $03, $ff, $03, $04, $0a
+        .byte $08, $04, $02, $01, $7f, $55, $44, $44, $04, $ff, $0b, $0d, $0b, $0b, $0a, $06
+        .byte $0a, $ff, $07, $08, $12, $0b, $0a, $0a, $0b, $8f, $0f, $0c, $0a, $0a, $ff, $11
+        .byte $13, $14, $12, $0f, $10, $11, $ff, $12, $10, $14, $14, $12, $fe, $fd, $7b, $fa
+        .byte $1f, $1e, $ff, $fd, $fc, $09, $0d, $07, $05, $04, $ff, $04, $05, $0c, $25, $26
+        .byte $24, $29, $ff, $21, $20, $29, $24, $2a, $27, $24, $ff, $02, $08, $04, $0a, $0c
+        .byte $07, $10, $ff, $03, $10, $03, $1d, $1c, $15, $17, $ff, $16, $13, $13, $17, $f6
+        .byte $f8, $f7, $ff, $f6, $f5, $f7, $f8, $f9, $f7, $f7, $ff, $f8, $f9, $f7, $f6, $f5
+        .byte $f6, $f8, $ef, $f7, $f6, $fd, $fd, $ff, $fa, $7f, $4e, $45, $55, $03, $7f, $55
+        .byte $a5, $4e, $05, $7f, $35, $34, $44, $04, $7f, $14, $df, $fb, $0e, $ff, $0c, $0b
+        .byte $0e, $0c, $0c, $0e, $0d, $fb, $0e, $0d, $fd, $0c, $0c, $0f, $ff, $0c, $0c, $0b
+        .byte $0b, $0b, $0b, $0b, $ee, $f6, $ff, $ff, $fb, $fa, $76, $cf, $1f, $0f, $0f, $2e
+        .byte $f1
+        ; Frame 19 -> 20
+        .byte $ff, $15, $15, $15, $17, $13, $12, $17, $ff, $17, $14, $16, $17, $14, $02, $04
+        .byte $5f, $13, $f4, $2f, $ff, $02, $01, $0f, $0e, $0c, $04, $03, $ff, $05, $04, $0d
+        .byte $e8, $e5, $e5, $e4, $ff, $e9, $e8, $e6, $e9, $e2, $e2, $e4, $77, $d1, $ce, $f2
+        .byte $fb, $02, $fd, $f3, $ec, $f5, $ff, $ff, $fc, $fd, $fb, $ee, $01, $01, $02, $4f
+        .byte $12, $12, $01, $22, $f1, $3d, $11, $11, $01, $7e, $22, $22, $12, $77, $22, $12
+        .byte $22, $7f, $22, $12, $22, $02, $75, $22, $11, $01, $69, $11, $11, $7d, $21, $11
+        .byte $11, $7c, $11, $11, $01, $7f, $31, $11, $31, $02, $79, $13, $11, $02, $0e, $1f
+        .byte $01, $ff, $22, $22, $22, $25, $1d, $1e, $23, $ff, $25, $1f, $22, $24, $20, $03
+        .byte $01, $7f, $32, $71, $77, $05, $ff, $04, $05, $19, $17, $15, $0c, $06, $ff, $0b
+        .byte $06, $15, $14, $15, $13, $16, $ff, $12, $11, $16, $12, $16, $16, $14, $7f, $64
+        .byte $45, $36, $04, $ff, $03, $05, $05, $0e, $10, $0b, $04, $ff, $05, $05, $06, $0e
+        .byte $08, $08, $08, $ff, $07, $08, $09, $09, $09, $09, $09, $ff, $09, $09, $0a, $09
+        .byte $09, $09, $09, $ff, $08, $08, $01, $02, $04, $05, $02, $7f, $55, $65, $55, $05
+        .byte $7f, $55, $25, $46, $04, $7f, $54, $55, $55, $05, $7f, $45, $26, $42, $03, $7f
+        .byte $23, $23, $33, $02, $7f, $33, $46, $22, $02, $7f, $34, $44, $44, $04, $7f, $56
+        .byte $55, $f5, $04, $ff, $01, $04, $0a, $05, $05, $05, $05, $8f, $08, $06, $05, $06
+        .byte $ff, $14, $18, $16, $13, $13, $15, $12, $ff, $14, $12, $15, $17, $14, $05, $ff
+        .byte $47, $6e, $df, $ff, $fd, $fd, $0a, $0d, $0d, $02, $01, $ff, $07, $04, $10, $0d
+        .byte $0b, $0a, $0f, $ff, $0b, $0a, $11, $0d, $0e, $0c, $0b, $7f, $33, $52, $45, $06
+        .byte $ff, $04, $07, $02, $0f, $09, $07, $09, $ff, $09, $09, $08, $05, $fe, $fe, $fc
+        .byte $7f, $de, $dc, $de, $0c, $7f, $de, $bd, $cc, $0d, $37, $cd, $41, $03, $ff, $02
+        .byte $07, $07, $08, $08, $08, $08, $ff, $08, $07, $08, $ff, $02, $08, $07, $ff, $08
+        .byte $08, $06, $06, $07, $06, $07, $67, $37, $33, $01, $ff, $09, $09, $0a, $0a, $0a
+        .byte $0b, $0a, $ff, $0a, $0a, $03, $01, $09, $0a, $0b, $ff, $09, $09, $0a, $09, $09
+        .byte $08, $08, $7f, $d3, $43, $24, $0f, $7f, $33, $4f, $44, $05, $0f, $22, $33
+        ; Frame 20 -> 21
+        .byte $7f, $76, $56, $75, $04, $7f, $45, $56, $56, $05, $ff, $04, $08, $07, $05, $07
+        .byte $04, $05, $7f, $43, $54, $76, $07, $ff, $09, $09, $07, $f1, $f0, $f2, $f1, $ff
+        .byte $f4, $f4, $f2, $f4, $f3, $f2, $f5, $7a, $fe, $1d, $0f, $ff, $01, $fe, $01, $f6
+        .byte $f9, $f6, $fd, $7f, $bc, $8c, $32, $03, $7f, $23, $22, $23, $02, $7f, $23, $32
+        .byte $43, $03, $7f, $23, $34, $33, $03, $7f, $13, $11, $22, $01, $7f, $11, $31, $12
+        .byte $01, $7f, $21, $21, $22, $02, $7f, $21, $32, $23, $03, $7f, $21, $12, $12, $01
+        .byte $7f, $21, $42, $11, $01, $7f, $11, $21, $12, $01, $7f, $22, $22, $52, $03, $7e
+        .byte $23, $12, $42, $0f, $22, $22, $7f, $45, $53, $34, $04, $7f, $34, $43, $32, $02
+        .byte $57, $22, $f2, $0f, $7f, $11, $14, $f5, $0f, $fd, $02, $01, $07, $08, $09, $06
+        .byte $ff, $07, $08, $05, $06, $07, $08, $07, $7f, $f3, $11, $1e, $0f, $7f, $d2, $21
+        .byte $64, $0d, $7d, $ec, $36, $23, $7f, $43, $33, $43, $03, $7f, $43, $54, $44, $04
+        .byte $73, $33, $22, $01, $7f, $21, $22, $22, $02, $7f, $22, $22, $22, $02, $7f, $22
+        .byte $22, $22, $02, $27, $22, $12, $7f, $12, $12, $21, $02, $7f, $21, $13, $11, $01
+        .byte $7f, $11, $21, $21, $02, $7f, $22, $23, $22, $02, $7f, $13, $24, $13, $03, $0f
+        .byte $43, $22, $18, $f1, $76, $ff, $ef, $0e, $7f, $cf, $ed, $fe, $0e, $7b, $ff, $fe
+        .byte $cd, $7f, $de, $bf, $ba, $0b, $7f, $ab, $bb, $aa, $0b, $7f, $dc, $be, $fb, $0f
+        .byte $7f, $ee, $cf, $cc, $0d, $3f, $ac, $ca, $ff, $12, $ff, $7c, $fe, $ee, $0e, $7f
+        .byte $ef, $12, $32, $02, $7f, $52, $65, $55, $04, $7f, $55, $24, $53, $05, $7f, $46
+        .byte $55, $54, $04, $0f, $24, $12, $7f, $44, $45, $44, $05, $77, $45, $51, $54, $7f
+        .byte $55, $44, $44, $05, $5d, $42, $23, $01, $3f, $3e, $31, $23, $0d, $32, $04
+        ; Frame 21 -> 22
+        .byte $7f, $da, $9d, $ee, $0a, $7f, $c9, $cb, $5b, $02, $7f, $51, $44, $36, $05, $7f
+        .byte $12, $ec, $5f, $07, $7f, $65, $c1, $fd, $0d, $7f, $ed, $dc, $ef, $0f, $7f, $fc
+        .byte $bf, $df, $0e, $6f, $ed, $cf, $cc, $7f, $ce, $fd, $ff, $0f, $1f, $fe, $ff, $0f
+        .byte $7f, $ff, $ef, $ee, $0f, $7d, $fe, $ee, $fe, $75, $fe, $ff, $0f, $7a, $ff, $ff
+        .byte $0f, $7a, $ff, $ff, $0f, $7e, $fe, $ed, $de, $6d, $11, $11, $01, $7a, $d1, $11
+        .byte $01, $00, $73, $ff, $2f, $0f, $3f, $ec, $ef, $ef, $0f, $ff, $ff, $7f, $ab, $ba
+        .byte $bb, $0b, $7f, $bb, $a8, $2a, $0f, $7f, $11, $ce, $eb, $0b, $7f, $ed, $ac, $ce
+        .byte $0b, $7f, $df, $4b, $45, $04, $7f, $43, $22, $42, $02, $77, $d1, $be, $df, $7e
+        .byte $eb, $ff, $d2, $7f, $eb, $3d, $ff, $0f, $7f, $ff, $ff, $ff, $0f, $7b, $ff, $ff
+        .byte $ff, $7f, $ff, $ff, $fe, $0e, $5f, $ff, $ff, $ff, $1f, $ff, $ff, $0f, $0a, $ff
+        .byte $6e, $ff, $ff, $0f, $6f, $ff, $ff, $ff, $3f, $ff, $ff, $ff, $7f, $ff, $ef, $ef
+        .byte $0e, $7f, $ff, $ff, $1f, $0f, $5f, $f1, $ff, $ff, $0d, $ff, $0f, $7f, $cd, $ec
+        .byte $cd, $0d, $7f, $dd, $cc, $bc, $0e, $7f, $cf, $ed, $ec, $0d, $7f, $fe, $ce, $cf
+        .byte $0c, $7f, $bc, $ec, $ff, $0e, $7f, $fe, $dd, $fe, $0e, $ff, $fa, $fa, $fb, $f7
+        .byte $f8, $fb, $f7, $ff, $fc, $f7, $fd, $f9, $fc, $fc, $f4, $8f, $f5, $f5, $f5, $fd
+        .byte $48, $11, $7a, $f1, $ff, $0f, $0d, $1f, $01, $7e, $dd, $dc, $dd, $67, $dc, $cd
+        .byte $0d, $7f, $ec, $dd, $ee, $0e, $67, $1e, $11, $02, $3b, $11, $11, $01, $2e, $21
+        .byte $11, $22, $1f, $73, $11, $e1, $01, $61, $1c, $0e, $06, $1f
+        ; Frame 22 -> 23
+        .byte $ff, $f6, $f4, $f5, $f5, $f6, $f6, $f4, $ff, $f4, $f6, $f4, $f4, $f6, $02, $02
+        .byte $76, $44, $f2, $02, $7c, $a9, $1b, $03, $7e, $a2, $43, $43, $7f, $33, $34, $43
+        .byte $03, $7b, $1e, $1f, $fe, $3f, $2e, $2f, $12, $7d, $22, $f2, $de, $7f, $ee, $ed
+        .byte $ee, $0d, $7f, $ed, $ff, $ff, $0e, $7f, $ef, $dc, $ee, $0d, $7d, $1e, $11, $11
+        .byte $7a, $e1, $1f, $01, $01, $01, $7e, $ee, $dd, $cd, $3a, $11, $11, $4c, $de, $01
+        .byte $18, $ff, $7f, $ee, $ef, $1f, $0e, $7f, $de, $ee, $ee, $0e, $0f, $ee, $fe, $ff
+        .byte $08, $09, $08, $09, $06, $07, $08, $ff, $09, $07, $08, $09, $07, $fd, $fc, $7f
+        .byte $dd, $da, $dc, $0a, $7f, $dc, $34, $d3, $0b, $77, $ce, $13, $11, $78, $11, $11
+        .byte $7f, $cd, $ec, $ed, $0e, $67, $dd, $fc, $0e, $7f, $ed, $fd, $dd, $0d, $7f, $cd
+        .byte $cc, $cc, $0d, $7f, $cc, $cb, $cc, $0c, $7f, $dc, $ee, $dd, $0d, $7f, $ed, $df
+        .byte $df, $0d, $7f, $ff, $de, $fc, $0f, $7f, $ef, $ed, $ee, $0e, $7f, $de, $fd, $df
+        .byte $0e, $7f, $ed, $ed, $ed, $0e, $7f, $ee, $ec, $ff, $0e, $7f, $ee, $ee, $ee, $0e
+        .byte $7f, $dc, $dd, $fd, $0d, $7f, $de, $dc, $cc, $0e, $0f, $cd, $dd, $7f, $77, $57
+        .byte $76, $05, $7f, $56, $65, $45, $02, $7f, $41, $13, $12, $01, $7d, $31, $63, $33
+        .byte $7f, $35, $65, $67, $06, $7f, $66, $66, $66, $05, $57, $12, $12, $0e, $7b, $f1
+        .byte $34, $d4, $7f, $fd, $4f, $32, $04, $7f, $33, $33, $33, $03, $7f, $33, $43, $44
+        .byte $04, $7f, $33, $42, $32, $02, $7f, $d3, $cd, $cc, $0d, $7f, $cc, $3d, $d3, $0d
+        .byte $7f, $db, $ee, $dd, $0d, $7f, $2e, $42, $43, $04, $03, $11, $3c, $33, $11, $1e
+        .byte $11, $11, $7f, $33, $32, $13, $02, $3f, $33, $22, $22, $0f, $22, $13
+        ; Frame 23 -> 0
+        .byte $7f, $cc, $cc, $dd, $0d, $5f, $dc, $cd, $1d, $39, $f1, $ff, $3c, $ee, $fe, $7d
+        .byte $ef, $ef, $ee, $7f, $fe, $ee, $ee, $0e, $30, $f1, $59, $ff, $1f, $7f, $11, $e1
+        .byte $ff, $0f, $7f, $ff, $ff, $ff, $0f, $7f, $ff, $fe, $ef, $0f, $7f, $ff, $fe, $fe
+        .byte $0f, $01, $0f, $19, $e1, $0f, $00, $7e, $ff, $ff, $ff, $7f, $ef, $ef, $ee, $0e
+        .byte $7e, $fe, $ff, $ff, $7f, $ff, $ff, $ff, $0f, $7e, $ff, $ff, $f2, $7e, $ff, $ff
+        .byte $ff, $0f, $ff, $ff, $ff, $09, $09, $09, $0a, $08, $08, $09, $df, $0a, $08, $09
+        .byte $0a, $08, $ff, $07, $ff, $0f, $3c, $56, $15, $7d, $52, $32, $32, $7f, $22, $23
+        .byte $33, $03, $09, $ff, $7a, $11, $12, $01, $7f, $11, $11, $ff, $0f, $7f, $ff, $ff
+        .byte $ff, $0f, $7f, $ff, $ff, $ff, $0f, $7f, $ff, $ff, $ff, $0f, $03, $ff, $3b, $ff
+        .byte $ff, $0f, $70, $ff, $0f, $17, $ff, $ff, $22, $ff, $3e, $ff, $ff, $0f, $51, $ff
+        .byte $0f, $5c, $ff, $ff, $2f, $ff, $fe, $0f, $0f, $ff, $ff, $7f, $65, $55, $55, $05
+        .byte $7f, $54, $65, $55, $03, $7f, $53, $33, $34, $04, $7f, $32, $54, $44, $04, $7f
+        .byte $54, $55, $44, $05, $7f, $44, $55, $55, $05, $7f, $44, $54, $44, $05, $7f, $44
+        .byte $54, $44, $05, $7f, $55, $45, $34, $02, $7f, $43, $34, $44, $03, $7f, $34, $44
+        .byte $44, $04, $7f, $44, $33, $33, $02, $7f, $22, $22, $22, $02, $7f, $22, $32, $23
+        .byte $01, $7f, $22, $22, $22, $02, $7f, $31, $33, $23, $03, $7f, $22, $33, $33, $03
+        .byte $7f, $33, $33, $33, $03, $7f, $33, $22, $32, $03, $7f, $43, $32, $24, $03, $7f
+        .byte $24, $24, $32, $02, $0f, $43, $33
+grunt_delta_end
+
+.endif
+.endif
+
 grunt_fi_0
         .byte $00, $00, $04, $04, $06, $06, $08, $08, $09, $09, $0b, $0b, $05, $05, $02, $02
         .byte $0c, $0f, $0f, $11, $12, $13, $14, $12, $15, $15, $0d, $15, $10, $10, $0b, $0b
@@ -1146,3 +2005,413 @@ grunt_fcol_1
         .byte $02, $02, $02, $02, $02, $02, $03, $03, $02, $03, $02, $01, $01, $02, $01, $01
         .byte $02, $02, $01, $02
 
+.if PVS_CULL
+; Potentially visible faces per theta sector (face_pvs in bake_animation.py)
+GRUNT_PVS_SHIFT = 4
+
+grunt_pvs0_0
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $0a, $0b, $0c, $0d, $0e, $0f, $10, $11
+        .byte $12, $13, $14, $15, $18, $19, $1a, $1b, $1c, $1d, $1f, $20, $21, $22, $23, $24
+        .byte $25, $26, $27, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $34, $35
+        .byte $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43, $44, $45
+        .byte $46, $47, $48, $49, $4a, $4b, $4c, $4d, $4f, $51, $52, $53, $54, $55, $56, $57
+        .byte $58, $59, $5a, $5b, $5c, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $68, $69
+        .byte $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $77, $78, $7a, $7b, $7c
+        .byte $7d, $7e, $7f, $80, $81, $82, $85, $86, $87, $88, $89, $8a
+
+grunt_pvs0_1
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $0a, $0b, $0c, $0d, $0e, $0f, $10
+        .byte $11, $12, $13, $14, $15, $19, $1a, $1b, $1c, $1d, $1f, $20, $21, $22, $23, $24
+        .byte $25, $26, $27, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $34, $35
+        .byte $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43, $44, $45
+        .byte $46, $47, $48, $49, $4a, $4b, $4c, $4d, $4f, $50, $51, $52, $53, $54, $55, $56
+        .byte $57, $58, $59, $5a, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66
+        .byte $67, $68, $69, $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $7a, $7b
+        .byte $7c, $7d, $7e, $7f, $80, $81, $82, $83, $85, $86, $87, $88, $89, $8c, $8d, $8e
+        .byte $92
+
+grunt_pvs0_2
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $0a, $0b, $0c, $0d, $0e, $0f, $10
+        .byte $11, $12, $13, $14, $15, $18, $19, $1c, $1d, $1f, $20, $21, $22, $23, $24, $25
+        .byte $26, $27, $29, $2a, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $34, $35, $36, $37
+        .byte $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43, $44, $45, $46, $47
+        .byte $48, $49, $4a, $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54, $55, $56, $57
+        .byte $58, $59, $5a, $5b, $5c, $5d, $5e, $60, $61, $62, $63, $64, $65, $66, $67, $68
+        .byte $69, $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $79, $7a
+        .byte $7b, $7c, $7d, $7e, $7f, $80, $81, $82, $83, $85, $86, $87, $88, $89, $8b, $8c
+        .byte $8d, $8e, $91, $92
+
+grunt_pvs0_3
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $10, $11
+        .byte $12, $13, $14, $15, $16, $18, $19, $1e, $1f, $20, $21, $22, $23, $24, $25, $26
+        .byte $27, $29, $2a, $2c, $2d, $2e, $2f, $30, $32, $33, $35, $36, $37, $38, $39, $3a
+        .byte $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43, $44, $45, $46, $47, $48, $49, $4a
+        .byte $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54, $55, $56, $57, $58, $59, $5a
+        .byte $5b, $5c, $5d, $5e, $60, $61, $62, $63, $64, $65, $66, $67, $68, $69, $6a, $6b
+        .byte $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $79, $7a, $7b, $7c, $7d
+        .byte $7e, $80, $81, $82, $83, $85, $86, $87, $88, $8b, $8c, $8d, $8e, $90, $92
+
+grunt_pvs0_4
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $10, $11, $12, $13
+        .byte $14, $15, $16, $17, $18, $19, $1b, $1c, $1d, $1e, $1f, $20, $21, $22, $23, $24
+        .byte $25, $26, $27, $28, $29, $2a, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $36, $37
+        .byte $38, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43, $44, $45, $46, $47, $48
+        .byte $49, $4a, $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54, $55, $56, $57, $58
+        .byte $59, $5a, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $66, $67, $68, $69
+        .byte $6a, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $79, $7a, $7b, $7c
+        .byte $7d, $7e, $81, $82, $83, $84, $86, $87, $88, $8b, $8c, $8d, $8e, $90, $91, $92
+
+grunt_pvs0_5
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0e, $0f, $10, $11
+        .byte $12, $13, $14, $15, $16, $17, $18, $19, $1b, $1c, $1d, $1e, $1f, $20, $21, $22
+        .byte $23, $24, $25, $26, $27, $28, $29, $2a, $2c, $2d, $2e, $2f, $30, $31, $32, $33
+        .byte $34, $36, $37, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43, $44, $45
+        .byte $46, $47, $48, $49, $4a, $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54, $55
+        .byte $56, $57, $58, $59, $5a, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65
+        .byte $66, $67, $68, $69, $6a, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76
+        .byte $78, $79, $7a, $7b, $7c, $7d, $81, $82, $83, $84, $86, $87, $88, $8a, $8b, $8c
+        .byte $8d, $8e, $8f, $90, $91, $92
+
+grunt_pvs0_6
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f
+        .byte $10, $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20
+        .byte $21, $22, $23, $24, $25, $26, $27, $28, $29, $2a, $2b, $2c, $2e, $2f, $30, $31
+        .byte $32, $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41
+        .byte $42, $43, $44, $45, $46, $47, $48, $4a, $4b, $4c, $4d, $4e, $4f, $50, $51, $52
+        .byte $53, $54, $55, $56, $57, $58, $5a, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63
+        .byte $64, $65, $66, $67, $68, $69, $6a, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75
+        .byte $76, $77, $78, $79, $7a, $7b, $81, $82, $83, $84, $86, $87, $88, $8a, $8b, $8c
+        .byte $8d, $8e, $8f, $90, $91, $92
+
+grunt_pvs0_7
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f
+        .byte $10, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21
+        .byte $22, $23, $24, $25, $26, $27, $28, $29, $2a, $2b, $2c, $2e, $2f, $30, $31, $32
+        .byte $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42
+        .byte $43, $44, $45, $46, $47, $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54, $55
+        .byte $56, $57, $58, $5a, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66
+        .byte $67, $68, $69, $6a, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77
+        .byte $78, $79, $7a, $7b, $7f, $81, $82, $83, $84, $85, $86, $87, $88, $8a, $8b, $8c
+        .byte $8d, $8e, $8f, $90, $91, $92
+
+grunt_pvs0_8
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f
+        .byte $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21, $22
+        .byte $23, $24, $25, $26, $27, $28, $29, $2a, $2b, $2c, $2e, $2f, $30, $31, $32, $33
+        .byte $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43
+        .byte $44, $45, $46, $47, $49, $4a, $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54
+        .byte $55, $56, $57, $58, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66
+        .byte $67, $68, $69, $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76
+        .byte $77, $78, $79, $7a, $7b, $7f, $80, $82, $83, $84, $85, $86, $87, $88, $89, $8a
+        .byte $8b, $8c, $8d, $8e, $8f, $90, $91, $92
+
+grunt_pvs0_9
+        .byte $00, $01, $02, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $13
+        .byte $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21, $22, $23
+        .byte $24, $25, $26, $27, $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33
+        .byte $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43
+        .byte $44, $45, $46, $47, $49, $4a, $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54
+        .byte $55, $56, $57, $58, $59, $5b, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66
+        .byte $67, $68, $69, $6a, $6b, $6c, $6d, $6f, $70, $71, $72, $73, $74, $75, $76, $77
+        .byte $78, $79, $7a, $7b, $7f, $80, $83, $84, $85, $87, $88, $89, $8a, $8b, $8c, $8d
+        .byte $8e, $8f, $90, $91, $92
+
+grunt_pvs0_10
+        .byte $02, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10, $11, $12
+        .byte $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21, $22
+        .byte $23, $24, $25, $26, $27, $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32
+        .byte $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $41, $42, $43, $44
+        .byte $45, $46, $47, $48, $49, $4a, $4b, $4c, $4d, $4e, $4f, $50, $51, $52, $53, $54
+        .byte $55, $56, $57, $58, $59, $5a, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66
+        .byte $67, $68, $69, $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76
+        .byte $77, $78, $79, $7a, $7b, $7d, $7e, $7f, $80, $83, $84, $85, $89, $8a, $8b, $8d
+        .byte $8e, $8f, $90, $91, $92
+
+grunt_pvs0_11
+        .byte $00, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10
+        .byte $11, $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20
+        .byte $21, $22, $23, $24, $25, $26, $27, $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30
+        .byte $31, $32, $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $41, $42
+        .byte $43, $44, $45, $46, $47, $48, $49, $4a, $4b, $4d, $4e, $4f, $50, $52, $53, $54
+        .byte $55, $56, $57, $58, $59, $5a, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66
+        .byte $67, $68, $69, $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76
+        .byte $77, $78, $79, $7c, $7d, $7e, $7f, $80, $83, $84, $85, $89, $8a, $8b, $8f, $90
+        .byte $91, $92
+
+grunt_pvs0_12
+        .byte $00, $01, $02, $03, $05, $06, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10, $11
+        .byte $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $21, $22
+        .byte $23, $24, $25, $27, $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33
+        .byte $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3e, $41, $42, $43, $44, $45, $46
+        .byte $47, $48, $49, $4a, $4b, $4d, $4e, $4f, $50, $52, $53, $54, $55, $57, $58, $59
+        .byte $5a, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $68, $69, $6a, $6b
+        .byte $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79, $7c, $7d
+        .byte $7e, $7f, $80, $82, $84, $85, $88, $89, $8a, $8b, $8f, $90, $91, $92
+
+grunt_pvs0_13
+        .byte $00, $01, $02, $03, $04, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10
+        .byte $11, $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $21
+        .byte $22, $23, $24, $25, $26, $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32
+        .byte $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3e, $3f, $40, $41, $42, $43
+        .byte $44, $45, $46, $47, $48, $49, $4a, $4d, $4e, $4f, $50, $52, $53, $54, $55, $57
+        .byte $58, $59, $5a, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $68, $69, $6a, $6b
+        .byte $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79, $7c, $7d
+        .byte $7e, $7f, $80, $81, $82, $84, $85, $86, $87, $88, $89, $8a, $8f, $90, $91
+
+grunt_pvs0_14
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f
+        .byte $10, $11, $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f
+        .byte $20, $21, $22, $23, $24, $25, $26, $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30
+        .byte $31, $32, $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3f, $40, $41
+        .byte $42, $43, $44, $45, $46, $47, $48, $49, $4a, $4b, $4d, $4e, $4f, $50, $52, $53
+        .byte $54, $55, $57, $58, $59, $5a, $5b, $5c, $5f, $60, $61, $62, $63, $64, $65, $66
+        .byte $67, $68, $69, $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $77, $78
+        .byte $7c, $7d, $7e, $7f, $80, $81, $82, $84, $85, $86, $87, $88, $89, $8a, $8f
+
+grunt_pvs0_15
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f
+        .byte $10, $11, $12, $13, $14, $15, $17, $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20
+        .byte $21, $22, $23, $24, $25, $26, $27, $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30
+        .byte $31, $32, $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3f, $40, $41
+        .byte $42, $43, $44, $45, $46, $47, $48, $49, $4a, $4b, $4c, $4d, $4e, $51, $52, $53
+        .byte $54, $55, $56, $57, $58, $59, $5a, $5b, $5c, $5f, $60, $61, $62, $63, $64, $65
+        .byte $66, $67, $68, $69, $6a, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $77
+        .byte $78, $7a, $7b, $7c, $7d, $7e, $7f, $80, $81, $82, $84, $85, $86, $87, $88, $89
+        .byte $8a
+
+grunt_pvs0_lo
+        .byte <grunt_pvs0_0
+        .byte <grunt_pvs0_1
+        .byte <grunt_pvs0_2
+        .byte <grunt_pvs0_3
+        .byte <grunt_pvs0_4
+        .byte <grunt_pvs0_5
+        .byte <grunt_pvs0_6
+        .byte <grunt_pvs0_7
+        .byte <grunt_pvs0_8
+        .byte <grunt_pvs0_9
+        .byte <grunt_pvs0_10
+        .byte <grunt_pvs0_11
+        .byte <grunt_pvs0_12
+        .byte <grunt_pvs0_13
+        .byte <grunt_pvs0_14
+        .byte <grunt_pvs0_15
+
+grunt_pvs0_hi
+        .byte >grunt_pvs0_0
+        .byte >grunt_pvs0_1
+        .byte >grunt_pvs0_2
+        .byte >grunt_pvs0_3
+        .byte >grunt_pvs0_4
+        .byte >grunt_pvs0_5
+        .byte >grunt_pvs0_6
+        .byte >grunt_pvs0_7
+        .byte >grunt_pvs0_8
+        .byte >grunt_pvs0_9
+        .byte >grunt_pvs0_10
+        .byte >grunt_pvs0_11
+        .byte >grunt_pvs0_12
+        .byte >grunt_pvs0_13
+        .byte >grunt_pvs0_14
+        .byte >grunt_pvs0_15
+
+grunt_pvs0_n
+        .byte $7c, $81, $84, $7f, $80, $86, $86, $86, $88, $85, $85, $82, $7e, $7f, $7f, $81
+
+grunt_pvs1_0
+        .byte $00, $01, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10
+        .byte $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1e, $1f, $20, $26, $29, $2a
+        .byte $2b, $30, $31, $33, $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f
+        .byte $40, $41, $42, $43, $44, $45, $46, $47, $48, $49, $4a, $4e, $4f, $50, $54, $55
+        .byte $56, $57, $58, $59, $5a, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65
+        .byte $66, $67, $68, $69, $6a, $6b, $6c, $6e, $70, $71, $72, $73, $74, $75, $76, $77
+        .byte $80, $81, $82, $83, $84, $85, $86, $87, $88, $89, $8a, $8b, $8c, $8d, $8e, $8f
+        .byte $90, $91, $92, $93
+
+grunt_pvs1_1
+        .byte $00, $01, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10
+        .byte $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1e, $1f, $20, $26, $27, $30
+        .byte $34, $35, $36, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43
+        .byte $44, $45, $46, $47, $48, $49, $4a, $4b, $4e, $4f, $50, $54, $55, $56, $57, $58
+        .byte $59, $5a, $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $69
+        .byte $6a, $6b, $6c, $6e, $70, $71, $72, $73, $74, $75, $76, $77, $7a, $7c, $7d, $80
+        .byte $81, $82, $83, $84, $85, $86, $87, $88, $89, $8a, $8b, $8c, $8e, $8f, $90, $91
+        .byte $92
+
+grunt_pvs1_2
+        .byte $00, $01, $03, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $12, $13
+        .byte $16, $17, $18, $19, $1b, $1e, $1f, $20, $25, $26, $27, $30, $32, $34, $35, $36
+        .byte $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $42, $43, $44, $45, $46
+        .byte $47, $48, $49, $4a, $4b, $4d, $4e, $4f, $50, $54, $55, $56, $57, $58, $59, $5a
+        .byte $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $69, $6a, $6b
+        .byte $6c, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $79, $7a, $7b, $7c, $7d
+        .byte $80, $81, $82, $83, $84, $85, $86, $87, $88, $89, $8a, $8b, $8e, $8f, $90, $91
+        .byte $92
+
+grunt_pvs1_3
+        .byte $00, $01, $02, $03, $06, $07, $08, $0a, $0c, $0d, $0e, $0f, $12, $13, $15, $16
+        .byte $17, $18, $19, $1c, $1d, $1e, $1f, $20, $25, $26, $27, $2c, $2d, $2e, $31, $32
+        .byte $33, $34, $35, $37, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f, $40, $41, $43, $44
+        .byte $45, $47, $4a, $4b, $4d, $4e, $4f, $50, $54, $55, $56, $58, $59, $5a, $5b, $5c
+        .byte $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $6b, $6c, $6e, $6f, $70
+        .byte $71, $72, $73, $74, $75, $76, $77, $78, $79, $7a, $7b, $7c, $7d, $80, $81, $82
+        .byte $83, $84, $85, $86, $87, $89, $8a, $8b, $8c, $8f, $90, $91, $92
+
+grunt_pvs1_4
+        .byte $00, $01, $02, $03, $06, $07, $08, $0a, $0c, $0d, $0e, $0f, $12, $13, $15, $16
+        .byte $17, $18, $19, $1c, $1d, $1e, $1f, $20, $22, $23, $25, $26, $27, $28, $2c, $2d
+        .byte $2e, $2f, $30, $31, $32, $33, $34, $35, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f
+        .byte $40, $41, $44, $45, $4a, $4b, $4d, $4e, $4f, $50, $54, $55, $56, $58, $59, $5a
+        .byte $5b, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $6b, $6c, $6e
+        .byte $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79, $7a, $7b, $7c, $7d, $7e
+        .byte $7f, $80, $81, $82, $83, $84, $85, $86, $87, $89, $8a, $8b, $90, $91, $93
+
+grunt_pvs1_5
+        .byte $00, $01, $02, $03, $06, $07, $08, $0c, $0d, $0e, $12, $13, $15, $16, $17, $18
+        .byte $19, $1c, $1d, $1e, $1f, $20, $21, $22, $23, $24, $25, $26, $27, $28, $2c, $2d
+        .byte $2e, $2f, $30, $31, $32, $33, $34, $35, $38, $39, $3a, $3b, $3c, $3d, $3e, $3f
+        .byte $40, $41, $44, $45, $4a, $4b, $4c, $4d, $4e, $4f, $50, $53, $54, $55, $56, $58
+        .byte $59, $5b, $5c, $5d, $5e, $5f, $61, $62, $63, $64, $65, $66, $67, $6b, $6c, $6d
+        .byte $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79, $7a, $7b, $7c, $7d
+        .byte $7e, $7f, $80, $81, $82, $83, $84, $85, $86, $87, $88, $89, $8a, $8b, $8d, $90
+        .byte $91, $93
+
+grunt_pvs1_6
+        .byte $00, $01, $02, $03, $06, $07, $08, $0a, $0b, $0c, $0d, $0e, $12, $15, $16, $18
+        .byte $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21, $22, $23, $24, $25, $26, $27, $28
+        .byte $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $34, $35, $38, $39, $3a, $3b
+        .byte $3c, $3d, $3e, $3f, $40, $41, $44, $45, $46, $4a, $4b, $4c, $4d, $4e, $4f, $50
+        .byte $52, $53, $54, $55, $56, $57, $58, $59, $5b, $5c, $5e, $5f, $61, $62, $66, $67
+        .byte $68, $69, $6b, $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78
+        .byte $79, $7a, $7b, $7c, $7d, $7e, $7f, $80, $81, $82, $83, $84, $85, $86, $87, $88
+        .byte $89, $8a, $8b, $8c, $8d, $8e, $8f, $90, $91, $92, $93
+
+grunt_pvs1_7
+        .byte $00, $01, $02, $03, $04, $05, $06, $07, $0a, $0b, $0c, $0d, $0f, $11, $15, $16
+        .byte $18, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21, $22, $23, $24, $25, $26, $27
+        .byte $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $34, $35, $38, $39
+        .byte $3a, $3b, $3d, $3e, $3f, $40, $41, $44, $45, $46, $4a, $4b, $4c, $4d, $4e, $4f
+        .byte $50, $52, $53, $54, $55, $56, $57, $58, $59, $5b, $5c, $62, $66, $67, $68, $69
+        .byte $6c, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79, $7a, $7b
+        .byte $7c, $7d, $7e, $7f, $80, $81, $82, $83, $84, $85, $86, $87, $88, $89, $8a, $8b
+        .byte $8c, $8d, $8e, $8f, $90, $91, $92, $93
+
+grunt_pvs1_8
+        .byte $00, $01, $02, $03, $04, $05, $09, $0a, $0b, $0d, $0f, $11, $15, $16, $19, $1a
+        .byte $1b, $1c, $1d, $1e, $1f, $20, $21, $22, $23, $24, $25, $26, $27, $28, $29, $2a
+        .byte $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $34, $38, $39, $3a, $3b, $3d, $3e
+        .byte $3f, $41, $44, $45, $46, $47, $4a, $4b, $4c, $4d, $4e, $4f, $50, $52, $53, $54
+        .byte $55, $56, $57, $58, $59, $5b, $5c, $5e, $66, $67, $68, $69, $6a, $6c, $6d, $6e
+        .byte $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79, $7a, $7b, $7c, $7d, $7e
+        .byte $7f, $80, $81, $82, $83, $84, $85, $86, $87, $88, $89, $8a, $8b, $8c, $8d, $8e
+        .byte $8f, $90, $91, $92, $93
+
+grunt_pvs1_9
+        .byte $00, $01, $02, $03, $04, $05, $09, $0a, $0b, $0d, $0f, $10, $11, $14, $15, $16
+        .byte $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21, $22, $23, $24, $25, $26, $27, $28
+        .byte $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $34, $36, $37, $38, $39
+        .byte $3a, $3b, $3c, $3d, $3e, $3f, $41, $42, $45, $46, $49, $4a, $4b, $4c, $4d, $4e
+        .byte $4f, $50, $52, $53, $54, $55, $56, $57, $58, $59, $5b, $5c, $5e, $60, $66, $67
+        .byte $68, $69, $6a, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79
+        .byte $7a, $7b, $7c, $7d, $7e, $7f, $80, $81, $82, $83, $84, $85, $86, $87, $88, $89
+        .byte $8a, $8b, $8c, $8d, $8e, $8f, $90, $91, $92, $93
+
+grunt_pvs1_10
+        .byte $00, $01, $02, $03, $04, $05, $08, $09, $0a, $0b, $0d, $0e, $0f, $10, $11, $14
+        .byte $15, $16, $1a, $1b, $1c, $1d, $1e, $1f, $20, $21, $22, $23, $24, $25, $26, $27
+        .byte $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $36, $37, $38, $3a
+        .byte $3b, $3c, $3d, $3e, $42, $45, $46, $48, $49, $4a, $4b, $4c, $4d, $4e, $4f, $50
+        .byte $52, $53, $54, $55, $56, $57, $58, $59, $5a, $5b, $5c, $5d, $5e, $60, $64, $65
+        .byte $68, $69, $6a, $6b, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78
+        .byte $79, $7a, $7b, $7c, $7d, $7e, $7f, $80, $81, $82, $83, $84, $85, $86, $87, $88
+        .byte $89, $8a, $8b, $8c, $8d, $8e, $8f, $90, $91, $92, $93
+
+grunt_pvs1_11
+        .byte $00, $01, $02, $03, $04, $05, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10, $11
+        .byte $14, $15, $18, $1a, $1b, $1c, $1d, $1e, $1f, $20, $22, $23, $24, $25, $26, $27
+        .byte $28, $29, $2a, $2b, $2c, $2d, $2e, $2f, $30, $31, $32, $33, $36, $37, $38, $3a
+        .byte $3c, $3d, $3e, $42, $43, $44, $45, $46, $47, $48, $49, $4a, $4b, $4c, $4d, $4e
+        .byte $4f, $50, $52, $53, $54, $55, $56, $57, $59, $5a, $5b, $5c, $5d, $5e, $5f, $60
+        .byte $61, $62, $63, $64, $65, $68, $69, $6a, $6b, $6d, $6f, $70, $71, $72, $73, $74
+        .byte $75, $76, $77, $78, $79, $7a, $7b, $7c, $7d, $7e, $7f, $80, $82, $83, $84, $86
+        .byte $88, $89, $8a, $8b, $8c, $8d, $8e, $8f, $90, $92, $93
+
+grunt_pvs1_12
+        .byte $00, $01, $02, $03, $04, $05, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10, $11
+        .byte $14, $15, $1a, $1b, $1c, $1d, $1e, $1f, $20, $24, $25, $26, $28, $29, $2a, $2b
+        .byte $2c, $2d, $2e, $2f, $30, $31, $32, $33, $36, $37, $38, $3a, $3c, $3d, $3e, $42
+        .byte $43, $45, $46, $47, $48, $49, $4c, $4d, $4e, $4f, $50, $52, $53, $54, $55, $56
+        .byte $57, $59, $5a, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $68, $69, $6a
+        .byte $6b, $6d, $6e, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78, $79, $7a, $7b
+        .byte $7e, $7f, $80, $82, $84, $86, $88, $89, $8a, $8b, $8c, $8d, $8e, $8f, $92, $93
+
+grunt_pvs1_13
+        .byte $00, $02, $03, $04, $05, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10, $11
+        .byte $13, $14, $15, $16, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $24, $25, $26, $28
+        .byte $29, $2a, $2b, $2d, $2e, $2f, $30, $31, $32, $33, $35, $36, $37, $38, $3a, $3c
+        .byte $3d, $3e, $3f, $42, $43, $46, $47, $48, $49, $4c, $4d, $4e, $4f, $50, $52, $53
+        .byte $54, $55, $56, $57, $59, $5a, $5c, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65
+        .byte $66, $68, $69, $6a, $6b, $6d, $6f, $70, $71, $72, $73, $74, $75, $76, $77, $78
+        .byte $79, $7a, $7b, $7e, $7f, $80, $81, $82, $83, $84, $86, $88, $89, $8a, $8b, $8c
+        .byte $8d, $8e, $8f, $90, $92, $93
+
+grunt_pvs1_14
+        .byte $00, $02, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10
+        .byte $11, $12, $13, $14, $15, $16, $17, $19, $1a, $1b, $1c, $1d, $1e, $1f, $20, $24
+        .byte $25, $26, $28, $29, $2a, $2b, $2e, $2f, $30, $31, $32, $33, $35, $36, $37, $38
+        .byte $3a, $3c, $3d, $3e, $3f, $40, $42, $43, $46, $47, $48, $49, $4c, $4d, $4e, $4f
+        .byte $50, $52, $54, $55, $56, $57, $59, $5a, $5b, $5d, $5e, $5f, $60, $61, $62, $63
+        .byte $64, $65, $66, $67, $68, $69, $6a, $6b, $6c, $6d, $70, $71, $72, $73, $74, $75
+        .byte $76, $77, $78, $79, $7e, $7f, $80, $81, $82, $83, $84, $86, $88, $89, $8a, $8b
+        .byte $8c, $8d, $8e, $8f, $90, $91, $92, $93
+
+grunt_pvs1_15
+        .byte $00, $03, $04, $05, $06, $07, $08, $09, $0a, $0b, $0c, $0d, $0e, $0f, $10, $11
+        .byte $12, $13, $14, $15, $16, $17, $18, $19, $1a, $1b, $1d, $1e, $1f, $20, $24, $25
+        .byte $26, $28, $29, $2a, $2b, $2e, $2f, $30, $31, $33, $35, $36, $37, $38, $3c, $3d
+        .byte $3e, $3f, $40, $42, $43, $46, $47, $48, $49, $4e, $4f, $50, $54, $55, $56, $57
+        .byte $58, $59, $5a, $5b, $5d, $5e, $5f, $60, $61, $62, $63, $64, $65, $66, $67, $68
+        .byte $69, $6a, $6b, $6c, $6d, $70, $71, $72, $73, $74, $75, $76, $77, $79, $7f, $80
+        .byte $81, $83, $84, $86, $87, $88, $89, $8a, $8b, $8c, $8d, $8e, $8f, $90, $91, $92
+        .byte $93
+
+grunt_pvs1_lo
+        .byte <grunt_pvs1_0
+        .byte <grunt_pvs1_1
+        .byte <grunt_pvs1_2
+        .byte <grunt_pvs1_3
+        .byte <grunt_pvs1_4
+        .byte <grunt_pvs1_5
+        .byte <grunt_pvs1_6
+        .byte <grunt_pvs1_7
+        .byte <grunt_pvs1_8
+        .byte <grunt_pvs1_9
+        .byte <grunt_pvs1_10
+        .byte <grunt_pvs1_11
+        .byte <grunt_pvs1_12
+        .byte <grunt_pvs1_13
+        .byte <grunt_pvs1_14
+        .byte <grunt_pvs1_15
+
+grunt_pvs1_hi
+        .byte >grunt_pvs1_0
+        .byte >grunt_pvs1_1
+        .byte >grunt_pvs1_2
+        .byte >grunt_pvs1_3
+        .byte >grunt_pvs1_4
+        .byte >grunt_pvs1_5
+        .byte >grunt_pvs1_6
+        .byte >grunt_pvs1_7
+        .byte >grunt_pvs1_8
+        .byte >grunt_pvs1_9
+        .byte >grunt_pvs1_10
+        .byte >grunt_pvs1_11
+        .byte >grunt_pvs1_12
+        .byte >grunt_pvs1_13
+        .byte >grunt_pvs1_14
+        .byte >grunt_pvs1_15
+
+grunt_pvs1_n
+        .byte $74, $71, $71, $6d, $6f, $72, $7b, $78, $75, $7a, $7b, $7b, $70, $76, $78, $71
+
+.endif
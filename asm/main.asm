@@ -271,6 +271,32 @@ zp_mesh_py_hi   = $5f
 zp_mesh_pz_lo   = $60
 zp_mesh_pz_hi   = $61
 
+; Dirty-rectangle clear (DIRTY_CLEAR)
+zp_cd_end_lo    = $62   ; pointer to the chain store after the last dirty row
+zp_cd_end_hi    = $63
+zp_cd_saved     = $64   ; opcode replaced by the RTS
+zp_cd_col_end   = $65   ; last dirty column
+zp_cd_temp      = $66
+zp_bnd_xmin     = $67   ; screen bounds of the transformed vertices
+zp_bnd_xmax     = $68
+zp_bnd_ymin     = $69
+zp_bnd_ymax     = $6a
+
+; Row-extent clear (EXTENT_CLEAR)
+zp_ext_base     = $6b   ; draw buffer's first entry in ext_col0/ext_col1
+zp_ce_ptr_lo    = $6c   ; first dirty character of the row being cleared
+zp_ce_ptr_hi    = $6d
+zp_ce_row       = $6e
+zp_ce_count     = $6f
+
+; Delta animation player (ANIM_DELTA)
+zp_gd_mask      = $70   ; group header, shifted right once per vertex
+zp_gd_wide      = $71   ; group header (bit 7 = byte deltas)
+zp_gd_flag      = $72   ; 1 = high nibble of zp_gd_half is still to use
+zp_gd_half      = $73   ; last nibble pair read
+zp_gd_count     = $74   ; vertices left in the group
+zp_gd_axis      = $75
+
 ; ----------------------------------------------------------------------------
 ; Constants
 ; ----------------------------------------------------------------------------
@@ -301,6 +327,48 @@ PIXEL_BR_SHIFT  = 0
 ;      64tass -D GRUNT_MESH=0 -o octa.prg main.asm
 ; ============================================================================
 
+; ANIM_KEYFRAMES = 1 stores only every 4th grunt frame and blends between
+; two keyframes in transform_mesh in quarter steps (MESH_BLEND): 2,718
+; instead of 10,872 bytes of vertex data. Per vertex 15 cycles more on a
+; keyframe, 39 half way (one add per axis), 54 at the quarter steps.
+;
+; ANIM_DELTA = 1 stores the grunt animation as frame 0 plus per-frame
+; deltas (see bake_animation.py), decoded into mesh_vx/vy/vz each frame:
+; ~1.7KB less vertex data, more CPU than reading frames in place.
+;
+; DIRTY_CLEAR = 1 clears only the character rectangle that the draw buffer's
+; previous frame covered (bounding box of its screen vertices), instead of
+; the whole screen. transform_mesh collects the box at ~28 cycles per
+; vertex, so the saving shrinks with the vertex count: ~4k cycles a frame
+; for the octahedron, under 1k for the grunt. Pass -D DIRTY_CLEAR=1 to enable.
+;
+; EXTENT_CLEAR = 1 instead clears, row by row, the characters that the
+; rasterizer wrote into the draw buffer on its previous frame (tracked per
+; span in rasterize_trapezoid). Pass -D EXTENT_CLEAR=1 to enable.
+;
+; PVS_CULL = 1 renders, for the grunt, only the faces of a precomputed
+; potentially visible set for the current theta sector (MESH_PVS), skipping
+; face Z, sort and setup for faces that cannot face the camera there.
+;
+; UNROLLED_SPANS = 1 fills the full characters of dual-row spans of
+; SPAN_UNROLL_MIN or more characters with a jump into an unrolled run of
+; stores (5 instead of 10 cycles per char, ~1.5KB of runs).
+.weak
+ANIM_KEYFRAMES = 0
+ANIM_DELTA = 0
+DIRTY_CLEAR = 0
+EXTENT_CLEAR = 0
+PVS_CULL = 0
+UNROLLED_SPANS = 0
+.endweak
+
+.if DIRTY_CLEAR && EXTENT_CLEAR
+        .error "DIRTY_CLEAR and EXTENT_CLEAR are alternatives"
+.endif
+.if ANIM_KEYFRAMES && ANIM_DELTA
+        .error "ANIM_KEYFRAMES and ANIM_DELTA are alternatives"
+.endif
+
 ; ============================================================================
 ; Main entry point
 ; ============================================================================
@@ -332,12 +400,25 @@ _anim_loop
         beq -
 
         ; Clear screen to color 0
+.if DIRTY_CLEAR
+        ldx buf_draw_idx        ; Only what this buffer's last frame covered
+        jsr clear_dirty
+.elif EXTENT_CLEAR
+        jsr clear_row_extents   ; Only what the rasterizer wrote last time
+.else
         lda #0
         jsr clear_screen
+.endif
 
         ; Draw mesh
         jsr draw_octahedron
 
+.if DIRTY_CLEAR
+        ; Remember what this frame covers, for this buffer's next clear
+        ldx buf_draw_idx
+        jsr mesh_screen_bounds
+.endif
+
         ; Queue page flip: the buffer we just drew becomes the next to display
         lda buf_draw
         sta buf_ready
@@ -374,6 +455,29 @@ buf_draw        .byte SCREEN_BUF_1      ; Currently being drawn to
 buf_table       .byte SCREEN_BUF_0, SCREEN_BUF_1, SCREEN_BUF_2
 buf_next        .byte 1, 2, 0           ; Index of next buffer
 
+.if DIRTY_CLEAR || EXTENT_CLEAR
+buf_draw_idx    .byte 1                 ; Index of buf_draw in buf_table
+.endif
+
+.if DIRTY_CLEAR
+
+; Character rectangle drawn into each buffer by its last frame, inclusive
+; (initially the whole screen, so the first clear of each buffer is full)
+dirty_row0      .byte 0, 0, 0
+dirty_row1      .byte CHAR_HEIGHT-1, CHAR_HEIGHT-1, CHAR_HEIGHT-1
+dirty_col0      .byte 0, 0, 0
+dirty_col1      .byte CHAR_WIDTH-1, CHAR_WIDTH-1, CHAR_WIDTH-1
+.endif
+
+.if EXTENT_CLEAR
+; Characters written per character row, CHAR_HEIGHT entries per buffer
+; (col0 > col1 = empty row). Initially whole rows, so the first clear of
+; each buffer is full.
+ext_col0        .fill 3 * CHAR_HEIGHT, 0
+ext_col1        .fill 3 * CHAR_HEIGHT, CHAR_WIDTH-1
+ext_base_table  .byte 0, CHAR_HEIGHT, 2 * CHAR_HEIGHT
+.endif
+
 ; Timing counters for FPS measurement
 vsync_counter   .word 0                 ; Incremented every vblank IRQ
 frame_counter   .word 0                 ; Incremented on actual page flip
@@ -390,6 +494,10 @@ triple_buf_init
         sta buf_ready
         lda #SCREEN_BUF_1
         sta buf_draw
+.if DIRTY_CLEAR || EXTENT_CLEAR
+        lda #1
+        sta buf_draw_idx
+.endif
 
         ; Patch SMC for initial draw buffer
         jsr patch_screen_base
@@ -498,6 +606,9 @@ advance_draw_buffer
         ; Get next buffer
         lda buf_next,x
         tax
+.if DIRTY_CLEAR || EXTENT_CLEAR
+        stx buf_draw_idx
+.endif
         lda buf_table,x
         sta buf_draw
 
@@ -536,6 +647,9 @@ draw_octahedron
         jsr transform_mesh
         cmp #0
         bne _do_err             ; Transform failed
+.if MESH_PVS
+        jsr select_grunt_pvs
+.endif
         jsr render_mesh
 _do_err
         rts
@@ -543,7 +657,7 @@ _do_err
 ; ============================================================================
 ; init_octahedron - Initialize octahedron mesh data (8 faces, 6 vertices)
 ; ============================================================================
-.if !GRUNT_MESH
+.if !GRUNT_MESH && !STEVE_MESH
 init_octahedron
         ; Octahedron vertices: 6 points
         ; 0: +X (104, 60, 0)   1: -X (-104, -60, 0)
@@ -801,7 +915,16 @@ cycle_count_hi  .byte 0
 ; ============================================================================
         .include "rasterizer.asm"
 DUAL_MESH = GRUNT_MESH          ; 1 = dual-mesh for grunt (295 faces), 0 = single mesh for others
+MESH_VERTEX_BUFFERS = !((GRUNT_MESH && !ANIM_DELTA) || STEVE_MESH) ; Raw frames are used in place
+MESH_BLEND = GRUNT_MESH && ANIM_KEYFRAMES ; Keyframes are blended in transform_mesh
+MESH_PVS = GRUNT_MESH && PVS_CULL ; Only the grunt has baked face sets
         .include "mesh.asm"
+.if COMPILED_TRANSFORM
+.if GRUNT_MESH || STEVE_MESH
+        .error "COMPILED_TRANSFORM is for the static octahedron, see compile_mesh.py"
+.endif
+        .include "octa_xform.asm"
+.endif
 
 ; ============================================================================
 ; VIC-II Setup
@@ -858,7 +981,7 @@ init_grunt
         lda #0
         sta grunt_frame
 
-        ; Load first frame vertices
+        ; Set up the first frame's vertices
         jsr load_grunt_frame
 
         lda #GRUNT_NUM_VERTICES
@@ -918,6 +1041,56 @@ _ig_faces1
         sta mesh_theta
 
         rts
+
+.if MESH_PVS
+; ============================================================================
+; select_grunt_pvs - Point render_mesh at the faces that can face the camera
+; ============================================================================
+; Picks both sub-meshes' potentially visible sets for mesh_theta's sector,
+; and sets zp_mesh_num_faces_0/1 to their lengths. The sets are built for
+; positions near init_grunt's (see PVS_VIEW in bake_animation.py), and hold
+; every face this code draws front-facing at init_grunt's position.
+.if GRUNT_PVS_SHIFT != 4
+        .error "select_grunt_pvs expects 16 sectors (GRUNT_PVS_SHIFT = 4)"
+.endif
+
+select_grunt_pvs
+        lda mesh_theta
+        lsr a
+        lsr a
+        lsr a
+        lsr a
+        tax                     ; X = sector
+.if INCREMENTAL_SORT
+        cpx _sgp_sector
+        beq +
+        stx _sgp_sector
+        lda #0
+        sta mesh_order_valid    ; New face lists: last frame's order is void
++
+.endif
+        lda grunt_pvs0_lo,x
+        sta smc_pvs_list_0
+        sta smc_pvs_draw_0
+        lda grunt_pvs0_hi,x
+        sta smc_pvs_list_0+1
+        sta smc_pvs_draw_0+1
+        lda grunt_pvs0_n,x
+        sta zp_mesh_num_faces_0
+        lda grunt_pvs1_lo,x
+        sta smc_pvs_list_1
+        sta smc_pvs_draw_1
+        lda grunt_pvs1_hi,x
+        sta smc_pvs_list_1+1
+        sta smc_pvs_draw_1+1
+        lda grunt_pvs1_n,x
+        sta zp_mesh_num_faces_1
+        rts
+
+.if INCREMENTAL_SORT
+_sgp_sector     .byte $ff       ; Sector of the face lists in use
+.endif
+.endif
 .endif
 
 ; ============================================================================
@@ -933,7 +1106,7 @@ init_steve
         lda #0
         sta steve_frame
 
-        ; Load first frame vertices
+        ; Point transform_mesh at the first frame's vertices
         jsr load_steve_frame
 
         lda #STEVE_NUM_VERTICES
@@ -979,56 +1152,22 @@ _is_faces0
         rts
 
 ; ============================================================================
-; load_steve_frame - Load vertex data for current animation frame
+; load_steve_frame - Point transform_mesh at the current frame's vertices
 ; ============================================================================
 load_steve_frame
-        ; Set up source pointers based on steve_frame
         ldx steve_frame
-
-        ; X axis pointer -> zp_anim_ptr
         lda steve_vx_lo,x
-        sta zp_anim_ptr
+        sta smc_mesh_vx
         lda steve_vx_hi,x
-        sta zp_anim_ptr+1
-
-        ; Copy X coordinates
-        ldy #0
-_lsf_x  lda (zp_anim_ptr),y
-        sta mesh_vx,y
-        iny
-        cpy #STEVE_NUM_VERTICES
-        bne _lsf_x
-
-        ; Y axis pointer -> zp_anim_ptr
-        ldx steve_frame
+        sta smc_mesh_vx+1
         lda steve_vy_lo,x
-        sta zp_anim_ptr
+        sta smc_mesh_vy
         lda steve_vy_hi,x
-        sta zp_anim_ptr+1
-
-        ; Copy Y coordinates
-        ldy #0
-_lsf_y  lda (zp_anim_ptr),y
-        sta mesh_vy,y
-        iny
-        cpy #STEVE_NUM_VERTICES
-        bne _lsf_y
-
-        ; Z axis pointer -> zp_anim_ptr
-        ldx steve_frame
+        sta smc_mesh_vy+1
         lda steve_vz_lo,x
-        sta zp_anim_ptr
+        sta smc_mesh_vz
         lda steve_vz_hi,x
-        sta zp_anim_ptr+1
-
-        ; Copy Z coordinates
-        ldy #0
-_lsf_z  lda (zp_anim_ptr),y
-        sta mesh_vz,y
-        iny
-        cpy #STEVE_NUM_VERTICES
-        bne _lsf_z
-
+        sta smc_mesh_vz+1
         rts
 
 ; ============================================================================
@@ -1047,60 +1186,99 @@ _asf_ok
 .endif
 
 ; ============================================================================
-; load_grunt_frame - Load vertex data for current animation frame
+; load_grunt_frame - Point transform_mesh at the current frame's vertices
 ; ============================================================================
-.if GRUNT_MESH
-; Uses grunt_frame to index into pointer tables
-; Copies 151 vertices from frame data to mesh_vx/vy/vz
+.if GRUNT_MESH && !ANIM_DELTA && !ANIM_KEYFRAMES
+; Uses grunt_frame to index into pointer tables and patches the three
+; vertex loads in transform_mesh (no copy into mesh_vx/vy/vz)
 load_grunt_frame
-        ; Set up source pointers based on grunt_frame
         ldx grunt_frame
-
-        ; X axis pointer -> zp_anim_ptr
         lda grunt_vx_lo,x
-        sta zp_anim_ptr
+        sta smc_mesh_vx
         lda grunt_vx_hi,x
-        sta zp_anim_ptr+1
-
-        ; Copy X coordinates
-        ldy #0
-_lgf_x  lda (zp_anim_ptr),y
-        sta mesh_vx,y
-        iny
-        cpy #GRUNT_NUM_VERTICES
-        bne _lgf_x
-
-        ; Y axis pointer -> zp_anim_ptr
-        ldx grunt_frame
+        sta smc_mesh_vx+1
         lda grunt_vy_lo,x
-        sta zp_anim_ptr
+        sta smc_mesh_vy
         lda grunt_vy_hi,x
-        sta zp_anim_ptr+1
-
-        ; Copy Y coordinates
-        ldy #0
-_lgf_y  lda (zp_anim_ptr),y
-        sta mesh_vy,y
-        iny
-        cpy #GRUNT_NUM_VERTICES
-        bne _lgf_y
-
-        ; Z axis pointer -> zp_anim_ptr
-        ldx grunt_frame
+        sta smc_mesh_vy+1
         lda grunt_vz_lo,x
-        sta zp_anim_ptr
+        sta smc_mesh_vz
         lda grunt_vz_hi,x
-        sta zp_anim_ptr+1
+        sta smc_mesh_vz+1
+        rts
 
-        ; Copy Z coordinates
-        ldy #0
-_lgf_z  lda (zp_anim_ptr),y
-        sta mesh_vz,y
-        iny
-        cpy #GRUNT_NUM_VERTICES
-        bne _lgf_z
+; ============================================================================
+; advance_grunt_frame - Move to next animation frame
+; ============================================================================
+advance_grunt_frame
+        inc grunt_frame
+        lda grunt_frame
+        cmp #GRUNT_NUM_FRAMES
+        bcc _agf_ok
+        lda #0
+        sta grunt_frame
+_agf_ok
+        jmp load_grunt_frame    ; Tail call
 
-        rts
+.elif GRUNT_MESH && ANIM_KEYFRAMES
+; ============================================================================
+; load_grunt_frame - Point the blend in transform_mesh at grunt_frame
+; ============================================================================
+; grunt_frame lies between keyframe a = grunt_frame / GRUNT_KEY_SPACING and
+; the next one, b, at step grunt_frame & 3 (in quarters). gk_sel_p/q/r say
+; which of the two each blend input P, Q, R reads (see MESH_BLEND).
+.if GRUNT_KEY_SPACING != 4
+        .error "load_grunt_frame steps in quarters of GRUNT_KEY_SPACING = 4"
+.endif
+
+; Point one blend input of all three axes at keyframe a or b (per step Y)
+patch_keys_m .macro sel, vx, vy, vz
+        ldx \sel,y
+        lda gk_keys,x
+        tax
+        lda grunt_kx_lo,x
+        sta \vx
+        lda grunt_kx_hi,x
+        sta \vx+1
+        lda grunt_ky_lo,x
+        sta \vy
+        lda grunt_ky_hi,x
+        sta \vy+1
+        lda grunt_kz_lo,x
+        sta \vz
+        lda grunt_kz_hi,x
+        sta \vz+1
+.endm
+
+load_grunt_frame
+        lda grunt_frame
+        lsr a
+        lsr a                   ; / GRUNT_KEY_SPACING
+        sta gk_keys             ; a
+        tax
+        inx
+        cpx #GRUNT_NUM_KEYS
+        bcc +
+        ldx #0                  ; The last keyframe blends back into the first
++       stx gk_keys+1           ; b
+
+        lda grunt_frame
+        and #3
+        tay                     ; Y = step
+        #patch_keys_m gk_sel_p, smc_mesh_vx, smc_mesh_vy, smc_mesh_vz
+        #patch_keys_m gk_sel_q, smc_mesh_vx_q, smc_mesh_vy_q, smc_mesh_vz_q
+        #patch_keys_m gk_sel_r, smc_mesh_vx_r, smc_mesh_vy_r, smc_mesh_vz_r
+        lda gk_adds,y
+        jmp set_mesh_blend      ; Tail call
+
+gk_keys         .byte 0, 1              ; Keyframes a and b
+; Per step 0-3: 0 = keyframe a, 1 = b, and the adds of the blend: a alone,
+; avg(a, avg(a, b)), avg(a, b), avg(b, avg(a, b)) (bake_animation.py
+; BLEND_SELECT, BLEND_ADDS)
+gk_sel_p        .byte 0, 0, 0, 1
+gk_sel_q        .byte 0, 0, 0, 0
+gk_sel_r        .byte 0, 1, 1, 1
+gk_adds         .byte 0, 2, 1, 2
 
 ; ============================================================================
 ; advance_grunt_frame - Move to next animation frame
@@ -1114,6 +1292,155 @@ advance_grunt_frame
         sta grunt_frame
 _agf_ok
         jmp load_grunt_frame    ; Tail call
+
+.elif GRUNT_MESH
+; ============================================================================
+; load_grunt_frame - Copy frame 0 into mesh_vx/vy/vz, rewind the deltas
+; ============================================================================
+; Only valid with grunt_frame = 0 (from init_grunt).
+load_grunt_frame
+        ldx #0
+_lgf_copy
+        lda grunt_vx_0,x
+        sta mesh_vx,x
+        lda grunt_vy_0,x
+        sta mesh_vy,x
+        lda grunt_vz_0,x
+        sta mesh_vz,x
+        inx
+        cpx #GRUNT_NUM_VERTICES
+        bne _lgf_copy
+
+        lda #<grunt_delta
+        sta zp_anim_ptr
+        lda #>grunt_delta
+        sta zp_anim_ptr+1
+        rts
+
+; ============================================================================
+; advance_grunt_frame - Move to next animation frame
+; ============================================================================
+advance_grunt_frame
+        jsr decode_grunt_delta  ; mesh_vx/vy/vz now hold the next frame
+        inc grunt_frame
+        lda grunt_frame
+        cmp #GRUNT_NUM_FRAMES
+        bcc _agf_ok
+        lda #0                  ; The last delta led back to frame 0
+        sta grunt_frame
+        lda #<grunt_delta
+        sta zp_anim_ptr
+        lda #>grunt_delta
+        sta zp_anim_ptr+1
+_agf_ok
+        rts
+
+; ============================================================================
+; decode_grunt_delta - Apply one frame delta to mesh_vx/vy/vz in place
+; ============================================================================
+; Stream format (encode_frame_delta in bake_animation.py), per axis, per
+; group of GRUNT_DELTA_GROUP vertices: a header byte (bits 0-6 = vertex
+; changes, bit 0 first; bit 7 = byte deltas, else signed nibbles, low
+; nibble first), then the deltas of the changed vertices. An unchanged
+; group costs ~25 cycles, a changed vertex ~55, an unchanged one in a
+; changed group ~18.
+;
+; Input: zp_anim_ptr = start of the delta
+; Output: zp_anim_ptr = start of the next delta
+;
+; Destroys: A, X, Y
+; ============================================================================
+decode_grunt_delta
+        lda #0
+        sta zp_gd_axis
+_gd_axis
+        ; Point the add/store at this axis' array
+        ldx zp_gd_axis
+        lda gd_axis_lo,x
+        sta smc_gd_add
+        sta smc_gd_sta
+        lda gd_axis_hi,x
+        sta smc_gd_add+1
+        sta smc_gd_sta+1
+
+        ldx #0                  ; X = first vertex of the group
+        ldy #0                  ; Y = offset in the stream (< 256 per axis)
+_gd_group
+        lda (zp_anim_ptr),y
+        beq _gd_skip            ; Header 0: nothing moves
+        iny
+        sta zp_gd_mask
+        sta zp_gd_wide
+        lda #0
+        sta zp_gd_flag          ; Groups start on a byte boundary
+        lda #GRUNT_DELTA_GROUP
+        sta zp_gd_count
+
+_gd_vertex
+        lsr zp_gd_mask
+        bcc _gd_next            ; This vertex does not move
+        bit zp_gd_wide
+        bmi _gd_byte
+        dec zp_gd_flag
+        bmi _gd_fetch
+        lda zp_gd_half          ; Second nibble of the pair
+        lsr a
+        lsr a
+        lsr a
+        lsr a
+        bpl _gd_nibble          ; Always
+_gd_fetch
+        lda #1
+        sta zp_gd_flag
+        lda (zp_anim_ptr),y
+        iny
+        sta zp_gd_half
+        and #$0f
+_gd_nibble
+        eor #$08                ; Sign-extend the nibble
+        sec
+        sbc #$08
+        jmp _gd_add
+_gd_byte
+        lda (zp_anim_ptr),y
+        iny
+_gd_add
+        clc
+smc_gd_add = * + 1
+        adc mesh_vx,x           ; SMC: axis array
+smc_gd_sta = * + 1
+        sta mesh_vx,x           ; SMC: axis array
+_gd_next
+        inx
+        dec zp_gd_count
+        bne _gd_vertex
+        beq _gd_group_done
+
+_gd_skip
+        iny
+        txa
+        clc
+        adc #GRUNT_DELTA_GROUP
+        tax
+_gd_group_done
+        cpx #GRUNT_NUM_VERTICES
+        bcc _gd_group
+
+        ; Step the stream pointer past this axis
+        tya
+        clc
+        adc zp_anim_ptr
+        sta zp_anim_ptr
+        bcc +
+        inc zp_anim_ptr+1
++       inc zp_gd_axis
+        lda zp_gd_axis
+        cmp #3
+        bcc _gd_axis
+        rts
+
+gd_axis_lo      .byte <mesh_vx, <mesh_vy, <mesh_vz
+gd_axis_hi      .byte >mesh_vx, >mesh_vy, >mesh_vz
 .endif
 
 ; ============================================================================
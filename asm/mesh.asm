@@ -17,16 +17,48 @@
 ; Configuration:
 ;   DUAL_MESH = 1 : Two sub-meshes with merge-sort render (up to 512 faces)
 ;   DUAL_MESH = 0 : Single mesh, simpler/faster (up to 256 faces)
+;   MERGED_SORT = 1 (with DUAL_MESH): one bucket sort over both sub-meshes,
+;     with 9-bit face ids (sub-mesh = page bit), instead of two radix sorts
+;     and a merge. Sub-meshes are then only the two 256-face pages.
 ;
 ; Set DUAL_MESH before including this file, or default to 1
 ; FLIP_ZSORT = 1 reverses Z-sort order (correct for our coordinate system)
 ; RASTERIZE = 0 skips rasterization (for benchmarking geometry cost)
+; MESH_VERTEX_BUFFERS = 0 drops mesh_vx/vy/vz, for callers that point
+;   transform_mesh at their own arrays (smc_mesh_vx/vy/vz) every frame
+; MESH_BLEND = 1 makes transform_mesh blend each coordinate from three
+;   +128-biased arrays per axis, avg(P, avg(Q, R)), for keyframe
+;   interpolation: with P, Q, R each keyframe a or b this is 3a/4 + b/4
+;   or a/4 + 3b/4. Set their addresses at smc_mesh_vx (P), smc_mesh_vx_q,
+;   smc_mesh_vx_r and likewise for y and z. set_mesh_blend drops the adds a
+;   step does not need: Q alone (a) or avg(Q, R) (a/2 + b/2). 22, 17 or 9
+;   cycles per axis for two, one or no adds.
+; MESH_PVS = 1 renders only the faces listed in a face list per sub-mesh
+;   (local indices, e.g. a potentially visible set for the current theta).
+;   Set the list addresses at smc_pvs_list_0/1 and smc_pvs_draw_0/1 and
+;   the list lengths in zp_mesh_num_faces_0/1 before render_mesh.
+; COMPILED_TRANSFORM = 1 leaves transform_mesh out, for a mesh-specific one
+;   generated by c/compile_mesh.py and included after this file.
+; INCREMENTAL_SORT = 1 makes sort_faces_0/1 repair last frame's face_order
+;   by insertion sort while mesh_order_valid is set (render_mesh sets it),
+;   falling back to the radix sort after SORT_MAX_MOVES moves. Clear
+;   mesh_order_valid when the face lists change.
 .weak
 DUAL_MESH = 1
 FLIP_ZSORT = 1
 RASTERIZE = 1
+MESH_VERTEX_BUFFERS = 1
+MESH_BLEND = 0
+MESH_PVS = 0
+INCREMENTAL_SORT = 0
+MERGED_SORT = 0
+COMPILED_TRANSFORM = 0
 .endweak
 
+.if MERGED_SORT && INCREMENTAL_SORT
+        .error "INCREMENTAL_SORT repairs the per-sub-mesh orders, MERGED_SORT has none"
+.endif
+
 ; XOR value for signed-to-unsigned conversion in radix sort
 ; $80 = normal order (back-to-front), $7f = reversed (front-to-back)
 .if FLIP_ZSORT
@@ -74,6 +106,13 @@ zp_tm_slx_hi    = $51
 zp_tm_rot_x     = $52
 zp_tm_rot_z     = $53
 
+; Insertion sort (INCREMENTAL_SORT), in transform temps free during the sort
+zp_sort_key     = zp_tm_clx_lo
+zp_sort_face    = zp_tm_clx_hi
+zp_sort_pos     = zp_tm_slz_lo
+zp_sort_moves   = zp_tm_slz_hi  ; Move budget left (16-bit)
+zp_sort_moves_hi = zp_tm_clz_lo
+
 ; ============================================================================
 ; Mesh data structure (in main memory)
 ; ============================================================================
@@ -83,10 +122,18 @@ zp_tm_rot_z     = $53
 MESH_MAX_VERTICES = 256
 MESH_MAX_FACES    = 256         ; Per sub-mesh (total 512 faces possible)
 
-; Mesh vertex data (s8 local coordinates) - shared by both sub-meshes
+; Mesh vertex data (s8 local coordinates) - shared by both sub-meshes.
+; transform_mesh reads these unless smc_mesh_vx/vy/vz are patched to point
+; elsewhere (animation frames are used in place, see load_grunt_frame).
+.if MESH_VERTEX_BUFFERS
 mesh_vx         .fill MESH_MAX_VERTICES, 0
 mesh_vy         .fill MESH_MAX_VERTICES, 0
 mesh_vz         .fill MESH_MAX_VERTICES, 0
+.else
+mesh_vx         = $ffff         ; Placeholders, patched before transform_mesh
+mesh_vy         = $ffff
+mesh_vz         = $ffff
+.endif
 
 ; Sub-mesh 0 face data (faces 0-255)
 mesh_fi_0       .fill MESH_MAX_FACES, 0
@@ -118,11 +165,33 @@ face_order_1    .fill MESH_MAX_FACES, 0
         .align 256
 radix_count     .fill 256, 0
 
+.if DUAL_MESH && MERGED_SORT
+; Bucket sort (MERGED_SORT): per face_z value, a list of 9-bit face ids
+; (low byte = index in the sub-mesh, high byte = sub-mesh, $ff = end)
+bucket_head_lo  .fill 256, 0
+bucket_head_hi  .fill 256, 0
+bucket_next_lo  .fill 2 * MESH_MAX_FACES, 0    ; Indexed by id: page 1 at +256
+bucket_next_hi  .fill 2 * MESH_MAX_FACES, 0
+.endif
+
 ; Radix sort temp variables (shared between sort_faces_0 and sort_faces_1)
 sf_position     .byte 0
 sf_face_idx     .byte 0
 sf_pos_temp     .byte 0
 
+.if INCREMENTAL_SORT
+; Moves allowed in an insertion sort repair before the radix sort takes over
+; (~35 cycles each). Pass -D SORT_MAX_MOVES=n to try others. Picked with make
+; profile on the steve build: 640 and up sort in ~7.0k cycles against the
+; radix sort's 10.1k. The animated grunt needs a median of 437 moves per
+; sub-mesh and frame, so no budget beats its ~15.4k radix sorts.
+.weak
+SORT_MAX_MOVES  = 640
+.endweak
+.cerror <(SORT_MAX_MOVES + 1) == 0, "SORT_MAX_MOVES + 1 must not be a multiple of 256"
+mesh_order_valid .byte 0        ; 1 = face_order_0/1 hold last frame's order
+.endif
+
 ; Mesh position is now in ZP (zp_mesh_px/py/pz_lo/hi)
 mesh_theta      .byte 0    ; u8 rotation angle (0-255 = 0 to 2pi)
 
@@ -130,20 +199,55 @@ mesh_theta      .byte 0    ; u8 rotation angle (0-255 = 0 to 2pi)
 screen_x        .fill 256, 0
 screen_y        .fill 256, 0
 
+.if DIRTY_CLEAR
+; reset_bounds_m - Empty the vertex bounds for track_bound_m. 16 cycles.
+; Destroys: A
+reset_bounds_m .macro
+        lda #$ff
+        sta zp_bnd_xmin
+        sta zp_bnd_ymin
+        lda #0
+        sta zp_bnd_xmax
+        sta zp_bnd_ymax
+.endm
+
+; track_bound_m - Widen [min, max], biased by $80 so signed order is
+; unsigned, to take the signed screen coordinate in A. transform_mesh runs
+; it on each screen_x/screen_y it stores, for mesh_screen_bounds. 14 cycles
+; unless the bounds widen. Destroys: A
+track_bound_m .macro min, max
+        eor #$80
+        cmp \min
+        bcs _\@not_min
+        sta \min
+_\@not_min
+        cmp \max
+        bcc _\@done
+        sta \max
+_\@done
+.endm
+.endif
+
+.if !COMPILED_TRANSFORM
 ; ============================================================================
 ; ROUTINE: transform_mesh
 ; ============================================================================
 ; Transform all vertices from local to screen coordinates.
 ;
-; Input: Mesh data must be set up in mesh_* variables
+; Input: Mesh data must be set up in mesh_* variables (vertices in
+;        mesh_vx/vy/vz or wherever smc_mesh_vx/vy/vz point)
 ;
 ; Output: screen_x[], screen_y[] filled with 2D coordinates
+;         zp_bnd_xmin/xmax/ymin/ymax: their bounds (DIRTY_CLEAR)
 ;         Returns: A = 0 on success, A = $FF if any vertex behind camera
 ;
 ; Destroys: A, X, Y, temp zero page vars
 ; ============================================================================
 
 transform_mesh
+.if DIRTY_CLEAR
+        #reset_bounds_m
+.endif
         ; Load sin/cos for rotation
         ldx mesh_theta
         lda rcos,x
@@ -174,10 +278,47 @@ _tm_do_vertex
         ; ----------------------------------------------------------------
 
         ; Load local coordinates
+.if MESH_BLEND
+        ; x = avg(P, avg(Q, R)) of +128-biased arrays, rounded down, or
+        ; Q or avg(Q, R) when set_mesh_blend jumps past the adds
+smc_mesh_vx_q = * + 1
+        lda $ffff,x             ; SMC: Q array
+smc_blend_x_1 = *
+        clc                     ; SMC: or jmp to the eor (Q alone)
+smc_mesh_vx_r = * + 1
+        adc $ffff,x             ; SMC: R array
+        ror a                   ; Carry is bit 8 of the sum
+smc_blend_x_2 = *
+        clc                     ; SMC: or jmp to the eor (avg(Q, R))
+smc_mesh_vx = * + 1
+        adc $ffff,x             ; SMC: P array
+        ror a
+        eor #$80                ; Remove the bias
+        sta zp_tm_lx
+        ; z = avg(P, avg(Q, R)) of +128-biased arrays, rounded down, or
+        ; Q or avg(Q, R) when set_mesh_blend jumps past the adds
+smc_mesh_vz_q = * + 1
+        lda $ffff,x             ; SMC: Q array
+smc_blend_z_1 = *
+        clc                     ; SMC: or jmp to the eor (Q alone)
+smc_mesh_vz_r = * + 1
+        adc $ffff,x             ; SMC: R array
+        ror a                   ; Carry is bit 8 of the sum
+smc_blend_z_2 = *
+        clc                     ; SMC: or jmp to the eor (avg(Q, R))
+smc_mesh_vz = * + 1
+        adc $ffff,x             ; SMC: P array
+        ror a
+        eor #$80                ; Remove the bias
+        sta zp_tm_lz
+.else
+smc_mesh_vx = * + 1             ; SMC: address of the x array
         lda mesh_vx,x
         sta zp_tm_lx
+smc_mesh_vz = * + 1             ; SMC: address of the z array
         lda mesh_vz,x
         sta zp_tm_lz
+.endif
 
         ; Compute c * lx (s0.7 * s8.0 = s8.7)
         lda zp_mesh_c
@@ -271,7 +412,26 @@ _tm_do_vertex
 
         ; world_y = ly + py (ly is s8, sign extend)
         ldx zp_vtx_idx
+.if MESH_BLEND
+        ; y = avg(P, avg(Q, R)) of +128-biased arrays, rounded down, or
+        ; Q or avg(Q, R) when set_mesh_blend jumps past the adds
+smc_mesh_vy_q = * + 1
+        lda $ffff,x             ; SMC: Q array
+smc_blend_y_1 = *
+        clc                     ; SMC: or jmp to the eor (Q alone)
+smc_mesh_vy_r = * + 1
+        adc $ffff,x             ; SMC: R array
+        ror a                   ; Carry is bit 8 of the sum
+smc_blend_y_2 = *
+        clc                     ; SMC: or jmp to the eor (avg(Q, R))
+smc_mesh_vy = * + 1
+        adc $ffff,x             ; SMC: P array
+        ror a
+        eor #$80                ; Remove the bias
+.else
+smc_mesh_vy = * + 1             ; SMC: address of the y array
         lda mesh_vy,x
+.endif
         sta zp_world_y_lo
         ora #$7f
         bmi +
@@ -355,6 +515,9 @@ _tm_z_ok
         adc #40                 ; Add screen center
         ldx zp_vtx_idx
         sta screen_x,x
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_xmin, zp_bnd_xmax
+.endif
 
         ; Compute screen_y = 25 - highbyte(world_y * recip)
         lda zp_world_y_lo
@@ -369,6 +532,9 @@ _tm_z_ok
         adc #25
         ldx zp_vtx_idx
         sta screen_y,x
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_ymin, zp_bnd_ymax
+.endif
 
         ; Next vertex
         inc zp_vtx_idx
@@ -382,6 +548,65 @@ _tm_too_close
 
 ; Temporaries for transform - now in zero page (zp_tm_*)
 
+.if MESH_BLEND
+; blend_skip_m - Make the blend instruction at site jump to target, the
+; eor after the P add (smc_mesh_vx + 3 etc.; not a label of its own, so the
+; profiler does not count the jump as a call)
+blend_skip_m .macro site, target
+        lda #$4c                ; jmp abs
+        sta \site
+        lda #<(\target)
+        sta \site+1
+        lda #>(\target)
+        sta \site+2
+.endm
+
+; blend_add_m - Restore the clc / adc abs,x at site (its operand's low
+; byte, overwritten by a jump, comes back with the array address)
+blend_add_m .macro site
+        lda #$18                ; clc
+        sta \site
+        lda #$7d                ; adc abs,x
+        sta \site+1
+.endm
+
+; ============================================================================
+; ROUTINE: set_mesh_blend
+; ============================================================================
+; Choose how many adds the MESH_BLEND vertex loads do, for all three axes.
+; Call after setting the array addresses (smc_mesh_vx_r and smc_mesh_vx
+; hold the low bytes a jump overwrites).
+;
+; Input: A = 0: Q alone, 1: avg(Q, R), 2: avg(P, avg(Q, R))
+;
+; Destroys: A, X
+; ============================================================================
+
+set_mesh_blend
+        tax
+        beq _smb_none
+        #blend_add_m smc_blend_x_1
+        #blend_add_m smc_blend_y_1
+        #blend_add_m smc_blend_z_1
+        dex
+        beq _smb_one
+        #blend_add_m smc_blend_x_2
+        #blend_add_m smc_blend_y_2
+        #blend_add_m smc_blend_z_2
+        rts
+_smb_one
+        #blend_skip_m smc_blend_x_2, smc_mesh_vx + 3
+        #blend_skip_m smc_blend_y_2, smc_mesh_vy + 3
+        #blend_skip_m smc_blend_z_2, smc_mesh_vz + 3
+        rts
+_smb_none
+        #blend_skip_m smc_blend_x_1, smc_mesh_vx + 3
+        #blend_skip_m smc_blend_y_1, smc_mesh_vy + 3
+        #blend_skip_m smc_blend_z_1, smc_mesh_vz + 3
+        rts
+.endif
+.endif
+
 ; ============================================================================
 ; ROUTINE: compute_face_z_0
 ; ============================================================================
@@ -395,14 +620,26 @@ _cfz0_loop
         cpx zp_mesh_num_faces_0
         beq _cfz0_done
         ; Get z_i / 4
+.if MESH_PVS
+smc_pvs_list_0 = * + 1
+        ldy $ffff,x             ; SMC: face list, X = position in it
+        sty zp_face_idx
+        lda mesh_fi_0,y
+.else
         lda mesh_fi_0,x
+.endif
         tay
         lda mesh_rot_z,y
         lsr
         lsr
         sta zp_tm_lx            ; ZP temp (free during sort)
         ; Get z_j / 4 and add
+.if MESH_PVS
+        ldy zp_face_idx
+        lda mesh_fj_0,y
+.else
         lda mesh_fj_0,x
+.endif
         tay
         lda mesh_rot_z,y
         lsr
@@ -410,7 +647,12 @@ _cfz0_loop
         adc zp_tm_lx            ; carry clear from lsr
         sta zp_tm_lx
         ; Get z_k / 4 and add
+.if MESH_PVS
+        ldy zp_face_idx
+        lda mesh_fk_0,y
+.else
         lda mesh_fk_0,x
+.endif
         tay
         lda mesh_rot_z,y
         lsr
@@ -434,14 +676,26 @@ _cfz1_loop
         cpx zp_mesh_num_faces_1
         beq _cfz1_done
         ; Get z_i / 4
+.if MESH_PVS
+smc_pvs_list_1 = * + 1
+        ldy $ffff,x             ; SMC: face list, X = position in it
+        sty zp_face_idx
+        lda mesh_fi_1,y
+.else
         lda mesh_fi_1,x
+.endif
         tay
         lda mesh_rot_z,y
         lsr
         lsr
         sta zp_tm_lx            ; ZP temp (free during sort)
         ; Get z_j / 4 and add
+.if MESH_PVS
+        ldy zp_face_idx
+        lda mesh_fj_1,y
+.else
         lda mesh_fj_1,x
+.endif
         tay
         lda mesh_rot_z,y
         lsr
@@ -449,7 +703,12 @@ _cfz1_loop
         adc zp_tm_lx
         sta zp_tm_lx
         ; Get z_k / 4 and add
+.if MESH_PVS
+        ldy zp_face_idx
+        lda mesh_fk_1,y
+.else
         lda mesh_fk_1,x
+.endif
         tay
         lda mesh_rot_z,y
         lsr
@@ -465,9 +724,60 @@ _cfz1_done
 ; ROUTINE: sort_faces_0
 ; ============================================================================
 ; Sort sub-mesh 0 faces back-to-front using radix sort on face_z.
+; With INCREMENTAL_SORT, repair last frame's order instead while it is valid.
 ; ============================================================================
 
 sort_faces_0
+.if INCREMENTAL_SORT
+        lda mesh_order_valid
+        beq _sf0_radix
+
+        ; --- Repair last frame's order by insertion sort (ascending face_z) ---
+        lda #<(SORT_MAX_MOVES + 1)
+        sta zp_sort_moves
+        lda #>(SORT_MAX_MOVES + 1) + 1
+        sta zp_sort_moves_hi
+        ldx #1
+_sf0_ins_loop
+        cpx zp_mesh_num_faces_0
+        bcs _sf0_ins_done
+        ldy face_order_0,x
+        lda face_z_0,y
+        ldy face_order_0-1,x
+        cmp face_z_0,y
+        bcs _sf0_ins_next       ; Key >= the one before: in place (common case)
+
+        ; Shift the faces with larger face_z up one until its slot
+        sta zp_sort_key
+        lda face_order_0,x
+        sta zp_sort_face
+        stx zp_sort_pos
+_sf0_shift
+        dec zp_sort_moves
+        bne _sf0_move
+        dec zp_sort_moves_hi
+        beq _sf0_radix          ; Too far from last frame: full sort
+_sf0_move
+        lda face_order_0-1,x
+        sta face_order_0,x
+        dex
+        beq _sf0_place
+        ldy face_order_0-1,x
+        lda zp_sort_key
+        cmp face_z_0,y
+        bcc _sf0_shift
+_sf0_place
+        lda zp_sort_face
+        sta face_order_0,x
+        ldx zp_sort_pos
+_sf0_ins_next
+        inx
+        bne _sf0_ins_loop       ; Always branches (exits via bcs above)
+_sf0_ins_done
+        rts
+
+_sf0_radix
+.endif
         ; --- Phase 1: Clear count array (8x unrolled with stride) ---
         lda #0
         ldx #31
@@ -546,9 +856,60 @@ _sf0_scatter_done
 ; ROUTINE: sort_faces_1
 ; ============================================================================
 ; Sort sub-mesh 1 faces back-to-front using radix sort on rot_z of first vertex.
+; With INCREMENTAL_SORT, repair last frame's order instead while it is valid.
 ; ============================================================================
 
 sort_faces_1
+.if INCREMENTAL_SORT
+        lda mesh_order_valid
+        beq _sf1_radix
+
+        ; --- Repair last frame's order by insertion sort (ascending face_z) ---
+        lda #<(SORT_MAX_MOVES + 1)
+        sta zp_sort_moves
+        lda #>(SORT_MAX_MOVES + 1) + 1
+        sta zp_sort_moves_hi
+        ldx #1
+_sf1_ins_loop
+        cpx zp_mesh_num_faces_1
+        bcs _sf1_ins_done
+        ldy face_order_1,x
+        lda face_z_1,y
+        ldy face_order_1-1,x
+        cmp face_z_1,y
+        bcs _sf1_ins_next       ; Key >= the one before: in place (common case)
+
+        ; Shift the faces with larger face_z up one until its slot
+        sta zp_sort_key
+        lda face_order_1,x
+        sta zp_sort_face
+        stx zp_sort_pos
+_sf1_shift
+        dec zp_sort_moves
+        bne _sf1_move
+        dec zp_sort_moves_hi
+        beq _sf1_radix          ; Too far from last frame: full sort
+_sf1_move
+        lda face_order_1-1,x
+        sta face_order_1,x
+        dex
+        beq _sf1_place
+        ldy face_order_1-1,x
+        lda zp_sort_key
+        cmp face_z_1,y
+        bcc _sf1_shift
+_sf1_place
+        lda zp_sort_face
+        sta face_order_1,x
+        ldx zp_sort_pos
+_sf1_ins_next
+        inx
+        bne _sf1_ins_loop       ; Always branches (exits via bcs above)
+_sf1_ins_done
+        rts
+
+_sf1_radix
+.endif
         ; --- Phase 1: Clear count array (8x unrolled with stride) ---
         lda #0
         ldx #31
@@ -638,12 +999,53 @@ _sf1_scatter_done
 ; ============================================================================
 
 render_mesh
-.if DUAL_MESH
+.if DUAL_MESH && MERGED_SORT
+        ; === DUAL MESH, ONE SORT: bucket both sub-meshes' faces by face_z ===
+        jsr compute_face_z_0
+        jsr compute_face_z_1
+        jsr bucket_faces
+
+        ; Draw bucket by bucket, ascending face_z (back to front)
+        ldx #0
+_rm_bucket_loop
+        ldy bucket_head_hi,x
+        bmi _rm_bucket_next     ; Empty
+        stx _rm_bucket
+        lda bucket_head_lo,x
+_rm_chain
+        ; A = face index, Y = its sub-mesh
+        sta _rm_face
+        cpy #0
+        bne _rm_chain_1
+        jsr _rm_draw_face_0
+        ldx _rm_face
+        lda bucket_next_lo,x
+        ldy bucket_next_hi,x
+        bpl _rm_chain
+        bmi _rm_chain_end       ; Always branches
+_rm_chain_1
+        jsr _rm_draw_face_1
+        ldx _rm_face
+        lda bucket_next_lo+256,x
+        ldy bucket_next_hi+256,x
+        bpl _rm_chain
+_rm_chain_end
+        ldx _rm_bucket
+_rm_bucket_next
+        inx
+        bne _rm_bucket_loop
+        rts
+
+.elif DUAL_MESH
         ; === DUAL MESH MODE: Sort both sub-meshes and merge-render ===
         jsr compute_face_z_0
         jsr compute_face_z_1
         jsr sort_faces_0
         jsr sort_faces_1
+.if INCREMENTAL_SORT
+        lda #1
+        sta mesh_order_valid    ; Next frame starts from this order
+.endif
 
         ; Initialize merge indices
         lda #0
@@ -661,7 +1063,7 @@ _rm_merge_loop
         cmp zp_mesh_num_faces_1
         bcs _rm_only_0
 
-        ; Both have faces - compare face_z (want larger z first = back-to-front)
+        ; Both have faces - compare face_z (ascending = back-to-front, as sorted)
         ; Get face_z for current face in sub-mesh 0
         ldx _rm_idx_0
         lda face_order_0,x
@@ -675,17 +1077,9 @@ _rm_merge_loop
         tax
         lda face_z_1,x
 
-        ; Compare: unsigned comparison (z1 vs z0)
-        ; We want larger Z first, so if z0 >= z1, render mesh 0
-        sec
-        sbc _rm_z0              ; A = z1 - z0
-        bvc _rm_no_overflow
-        eor #$80                ; Fix sign on overflow
-_rm_no_overflow
-        bmi _rm_render_1        ; z1 < z0, render mesh 1... wait, backwards
-        ; Actually: if (z1 - z0) < 0, then z1 < z0, so z0 is larger, render mesh 0
-        ; if (z1 - z0) >= 0, then z1 >= z0, render mesh 1
-        bpl _rm_render_1        ; z1 >= z0, render from mesh 1 first
+        ; face_z is unsigned: draw the smaller first, sub-mesh 0 on ties
+        cmp _rm_z0
+        bcc _rm_render_1        ; z1 < z0
 
 _rm_render_0
         ; Render face from sub-mesh 0
@@ -732,6 +1126,10 @@ _rm_done
         ; === SINGLE MESH MODE: Sort and render directly (faster) ===
         jsr compute_face_z_0
         jsr sort_faces_0
+.if INCREMENTAL_SORT
+        lda #1
+        sta mesh_order_valid
+.endif
 
         ; Simple loop through sorted faces
         ldx #0
@@ -750,9 +1148,15 @@ _rm_single_done
 .endif
 
 ; Helper: draw face from sub-mesh 0
-; Input: A = face index in sub-mesh 0
+; Input: A = face index in sub-mesh 0 (MESH_PVS: position in its face list)
 _rm_draw_face_0
+.if MESH_PVS
+        tay
+smc_pvs_draw_0 = * + 1
+        ldx $ffff,y             ; SMC: face list
+.else
         tax
+.endif
         lda mesh_fi_0,x
         tay
         lda screen_x,y
@@ -783,9 +1187,15 @@ _rm_draw_face_0
 .endif
 
 ; Helper: draw face from sub-mesh 1
-; Input: A = face index in sub-mesh 1
+; Input: A = face index in sub-mesh 1 (MESH_PVS: position in its face list)
 _rm_draw_face_1
+.if MESH_PVS
+        tay
+smc_pvs_draw_1 = * + 1
+        ldx $ffff,y             ; SMC: face list
+.else
         tax
+.endif
         lda mesh_fi_1,x
         tay
         lda screen_x,y
@@ -818,3 +1228,140 @@ _rm_draw_face_1
 _rm_idx_0       .byte 0
 _rm_idx_1       .byte 0
 _rm_z0          .byte 0
+.if DUAL_MESH && MERGED_SORT
+_rm_bucket      .byte 0
+_rm_face        .byte 0
+
+; ============================================================================
+; ROUTINE: bucket_faces
+; ============================================================================
+; Sort both sub-meshes' faces into one list per face_z value. Faces are
+; pushed from the last id down, so each list runs in ascending 9-bit id
+; order: without MESH_PVS, the same order, ties included, as sort_faces_8
+; over the whole mesh in the C model (bucket_faces_8 models this routine,
+; run_merged_sort_tests checks the two). ~41 cycles per face plus ~1.5k to
+; empty the buckets.
+;
+; Input: face_z_0/1 from compute_face_z_0/1
+;
+; Output: bucket_head_lo/hi, bucket_next_lo/hi
+;
+; Destroys: A, X, Y
+; ============================================================================
+
+bucket_faces
+        ; Empty all buckets (8x unrolled with stride)
+        lda #$ff
+        ldx #31
+_bf_clear
+        sta bucket_head_hi,x
+        sta bucket_head_hi+32,x
+        sta bucket_head_hi+64,x
+        sta bucket_head_hi+96,x
+        sta bucket_head_hi+128,x
+        sta bucket_head_hi+160,x
+        sta bucket_head_hi+192,x
+        sta bucket_head_hi+224,x
+        dex
+        bpl _bf_clear
+
+        ; Sub-mesh 1 (page 1) first: its ids are the larger ones
+        ldx zp_mesh_num_faces_1
+        beq _bf_done_1
+_bf_loop_1
+        dex
+        ldy face_z_1,x
+        lda bucket_head_lo,y
+        sta bucket_next_lo+256,x
+        lda bucket_head_hi,y
+        sta bucket_next_hi+256,x
+        lda #1
+        sta bucket_head_hi,y
+        txa
+        sta bucket_head_lo,y
+        bne _bf_loop_1          ; Z from txa: face 0 done
+_bf_done_1
+
+        ldx zp_mesh_num_faces_0
+        beq _bf_done_0
+_bf_loop_0
+        dex
+        ldy face_z_0,x
+        lda bucket_head_lo,y
+        sta bucket_next_lo,x
+        lda bucket_head_hi,y
+        sta bucket_next_hi,x
+        lda #0
+        sta bucket_head_hi,y
+        txa
+        sta bucket_head_lo,y
+        bne _bf_loop_0
+_bf_done_0
+        rts
+.endif
+
+.if DIRTY_CLEAR
+; ============================================================================
+; ROUTINE: mesh_screen_bounds
+; ============================================================================
+; Record the character rectangle covered by the transformed vertices as the
+; dirty rectangle of a draw buffer, for clear_dirty to erase next time that
+; buffer comes round. Matches mesh_screen_rect in the C model: the vertex
+; bounding box, clamped to the screen, empty (col1 < col0) if wholly off the left or top.
+; transform_mesh collects the bounds as it stores each vertex (~28 cycles
+; per vertex); this only clamps them (~80 cycles with the JSR).
+;
+; Input: X = buffer index (0-2), zp_bnd_xmin/xmax/ymin/ymax from transform_mesh
+;
+; Output: dirty_row0/row1/col0/col1,x
+;
+; Destroys: A
+; ============================================================================
+
+mesh_screen_bounds
+        ; Columns: pixels lie in [xmin, xmax), so xmax >> 1 is the last one
+        lda zp_bnd_xmin
+        eor #$80
+        bpl +
+        lda #0                  ; Off the left edge
++       lsr a
+        sta dirty_col0,x
+        lda zp_bnd_xmax
+        eor #$80
+        bmi _msb_no_cols        ; Everything left of the screen
+        cmp #SCREEN_WIDTH
+        bcc +
+        lda #SCREEN_WIDTH - 1
++       lsr a
+        sta dirty_col1,x
+
+        ; Rows, likewise
+        lda zp_bnd_ymin
+        eor #$80
+        bpl +
+        lda #0
++       lsr a
+        sta dirty_row0,x
+        lda zp_bnd_ymax
+        eor #$80
+        bmi _msb_no_rows
+        cmp #SCREEN_HEIGHT
+        bcc +
+        lda #SCREEN_HEIGHT - 1
++       lsr a
+        sta dirty_row1,x
+        rts
+
+_msb_no_cols
+        lda #1
+        sta dirty_col0,x
+        lda #0                  ; col1 < col0: clear_dirty does nothing
+        sta dirty_col1,x
+        rts
+_msb_no_rows
+        lda #1
+        sta dirty_row0,x
+        lda #0
+        sta dirty_row1,x
+        rts
+.endif
@@ -0,0 +1,577 @@
+; octa_xform.asm - Compiled transform_mesh for the octahedron mesh
+; Generated by c/compile_mesh.py, do not edit.
+;
+; 6 vertices folded into straight-line code. Same results as
+; transform_mesh in mesh.asm: screen_x/screen_y, mesh_rot_z, the
+; zp_bnd_* bounds with DIRTY_CLEAR, and
+; A = 0, or A = $ff if a vertex is behind or too close to the camera.
+; mesh_vx/vy/vz and zp_mesh_num_verts are not read.
+
+; Quarter-square table offsets, set once per call
+zp_cm_c         = zp_mesh_c     ; cos + 128
+zp_cm_cn        = zp_tm_lx      ; ~(cos + 128)
+zp_cm_s         = zp_mesh_s     ; sin + 128
+zp_cm_sn        = zp_tm_lz      ; ~(sin + 128)
+
+transform_mesh
+.if DIRTY_CLEAR
+        #reset_bounds_m
+.endif
+        ldx mesh_theta
+        lda rcos,x
+        eor #$80
+        sta zp_cm_c
+        eor #$ff
+        sta zp_cm_cn
+        lda rsin,x
+        eor #$80
+        sta zp_cm_s
+        eor #$ff
+        sta zp_cm_sn
+
+; Vertex 0: (104, 60, 0)
+        ldx zp_cm_c
+        ldy zp_cm_cn
+        sec
+        lda smult_sq1_lo+232,x  ; c * 104
+        sbc smult_sq2_lo+232,y
+        sta zp_tm_clx_lo
+        lda smult_sq1_hi+232,x
+        sbc smult_sq2_hi+232,y
+        sta zp_tm_clx_hi
+        ldx zp_cm_s
+        ldy zp_cm_sn
+        sec
+        lda smult_sq1_lo+24,x   ; s * -104
+        sbc smult_sq2_lo+24,y
+        sta zp_tm_slx_lo
+        lda smult_sq1_hi+24,x
+        sbc smult_sq2_hi+24,y
+        sta zp_tm_slx_hi
+        ; rot_z, for sorting
+        lda zp_tm_slx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_slx_hi
+        rol a
+        sta zp_tm_rot_z
+        eor #SORT_XOR
+        sta mesh_rot_z+0
+        ; world_x = rot_x + px, straight into the multiply input
+        lda zp_tm_clx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_clx_hi
+        rol a
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_px_lo
+        sta zp_mul16_lo
+        txa
+        adc zp_mesh_px_hi
+        sta zp_mul16_hi
+        ; world_z = rot_z + pz: fail if negative, or z8 < 17 (also z = 0)
+        lda zp_tm_rot_z
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_pz_lo
+        sta zp_world_z_lo
+        txa
+        adc zp_mesh_pz_hi
+        bpl +
+        jmp _cm_fail
++       lsr a                   ; Carry = bit 0 of the high byte
+        lda zp_world_z_lo
+        ror a                   ; z8 = world_z >> 1
+        cmp #17
+        bcs +
+        jmp _cm_fail
++       tax
+        ldy recip_persp,x
+        sty zp_recip
+        ; screen_x = 40 + highbyte(world_x * recip)
+        #mul16s_8u_hi_m
+        clc
+        adc #40
+        sta screen_x+0
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_xmin, zp_bnd_xmax
+.endif
+        ; screen_y = 25 - highbyte(world_y * recip), world_y = ly + py
+        clc
+        lda #<(60)
+        adc zp_mesh_py_lo
+        sta zp_mul16_lo
+        lda #>(60)
+        adc zp_mesh_py_hi
+        sta zp_mul16_hi
+        ldy zp_recip
+        #mul16s_8u_hi_m
+        eor #$ff
+        sec
+        adc #25
+        sta screen_y+0
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_ymin, zp_bnd_ymax
+.endif
+
+; Vertex 1: (-104, -60, 0)
+        ldx zp_cm_c
+        ldy zp_cm_cn
+        sec
+        lda smult_sq1_lo+24,x   ; c * -104
+        sbc smult_sq2_lo+24,y
+        sta zp_tm_clx_lo
+        lda smult_sq1_hi+24,x
+        sbc smult_sq2_hi+24,y
+        sta zp_tm_clx_hi
+        ldx zp_cm_s
+        ldy zp_cm_sn
+        sec
+        lda smult_sq1_lo+232,x  ; s * 104
+        sbc smult_sq2_lo+232,y
+        sta zp_tm_slx_lo
+        lda smult_sq1_hi+232,x
+        sbc smult_sq2_hi+232,y
+        sta zp_tm_slx_hi
+        ; rot_z, for sorting
+        lda zp_tm_slx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_slx_hi
+        rol a
+        sta zp_tm_rot_z
+        eor #SORT_XOR
+        sta mesh_rot_z+1
+        ; world_x = rot_x + px, straight into the multiply input
+        lda zp_tm_clx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_clx_hi
+        rol a
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_px_lo
+        sta zp_mul16_lo
+        txa
+        adc zp_mesh_px_hi
+        sta zp_mul16_hi
+        ; world_z = rot_z + pz: fail if negative, or z8 < 17 (also z = 0)
+        lda zp_tm_rot_z
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_pz_lo
+        sta zp_world_z_lo
+        txa
+        adc zp_mesh_pz_hi
+        bpl +
+        jmp _cm_fail
++       lsr a                   ; Carry = bit 0 of the high byte
+        lda zp_world_z_lo
+        ror a                   ; z8 = world_z >> 1
+        cmp #17
+        bcs +
+        jmp _cm_fail
++       tax
+        ldy recip_persp,x
+        sty zp_recip
+        ; screen_x = 40 + highbyte(world_x * recip)
+        #mul16s_8u_hi_m
+        clc
+        adc #40
+        sta screen_x+1
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_xmin, zp_bnd_xmax
+.endif
+        ; screen_y = 25 - highbyte(world_y * recip), world_y = ly + py
+        clc
+        lda #<(-60)
+        adc zp_mesh_py_lo
+        sta zp_mul16_lo
+        lda #>(-60)
+        adc zp_mesh_py_hi
+        sta zp_mul16_hi
+        ldy zp_recip
+        #mul16s_8u_hi_m
+        eor #$ff
+        sec
+        adc #25
+        sta screen_y+1
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_ymin, zp_bnd_ymax
+.endif
+
+; Vertex 2: (-60, 104, 0)
+        ldx zp_cm_c
+        ldy zp_cm_cn
+        sec
+        lda smult_sq1_lo+68,x   ; c * -60
+        sbc smult_sq2_lo+68,y
+        sta zp_tm_clx_lo
+        lda smult_sq1_hi+68,x
+        sbc smult_sq2_hi+68,y
+        sta zp_tm_clx_hi
+        ldx zp_cm_s
+        ldy zp_cm_sn
+        sec
+        lda smult_sq1_lo+188,x  ; s * 60
+        sbc smult_sq2_lo+188,y
+        sta zp_tm_slx_lo
+        lda smult_sq1_hi+188,x
+        sbc smult_sq2_hi+188,y
+        sta zp_tm_slx_hi
+        ; rot_z, for sorting
+        lda zp_tm_slx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_slx_hi
+        rol a
+        sta zp_tm_rot_z
+        eor #SORT_XOR
+        sta mesh_rot_z+2
+        ; world_x = rot_x + px, straight into the multiply input
+        lda zp_tm_clx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_clx_hi
+        rol a
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_px_lo
+        sta zp_mul16_lo
+        txa
+        adc zp_mesh_px_hi
+        sta zp_mul16_hi
+        ; world_z = rot_z + pz: fail if negative, or z8 < 17 (also z = 0)
+        lda zp_tm_rot_z
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_pz_lo
+        sta zp_world_z_lo
+        txa
+        adc zp_mesh_pz_hi
+        bpl +
+        jmp _cm_fail
++       lsr a                   ; Carry = bit 0 of the high byte
+        lda zp_world_z_lo
+        ror a                   ; z8 = world_z >> 1
+        cmp #17
+        bcs +
+        jmp _cm_fail
++       tax
+        ldy recip_persp,x
+        sty zp_recip
+        ; screen_x = 40 + highbyte(world_x * recip)
+        #mul16s_8u_hi_m
+        clc
+        adc #40
+        sta screen_x+2
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_xmin, zp_bnd_xmax
+.endif
+        ; screen_y = 25 - highbyte(world_y * recip), world_y = ly + py
+        clc
+        lda #<(104)
+        adc zp_mesh_py_lo
+        sta zp_mul16_lo
+        lda #>(104)
+        adc zp_mesh_py_hi
+        sta zp_mul16_hi
+        ldy zp_recip
+        #mul16s_8u_hi_m
+        eor #$ff
+        sec
+        adc #25
+        sta screen_y+2
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_ymin, zp_bnd_ymax
+.endif
+
+; Vertex 3: (60, -104, 0)
+        ldx zp_cm_c
+        ldy zp_cm_cn
+        sec
+        lda smult_sq1_lo+188,x  ; c * 60
+        sbc smult_sq2_lo+188,y
+        sta zp_tm_clx_lo
+        lda smult_sq1_hi+188,x
+        sbc smult_sq2_hi+188,y
+        sta zp_tm_clx_hi
+        ldx zp_cm_s
+        ldy zp_cm_sn
+        sec
+        lda smult_sq1_lo+68,x   ; s * -60
+        sbc smult_sq2_lo+68,y
+        sta zp_tm_slx_lo
+        lda smult_sq1_hi+68,x
+        sbc smult_sq2_hi+68,y
+        sta zp_tm_slx_hi
+        ; rot_z, for sorting
+        lda zp_tm_slx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_slx_hi
+        rol a
+        sta zp_tm_rot_z
+        eor #SORT_XOR
+        sta mesh_rot_z+3
+        ; world_x = rot_x + px, straight into the multiply input
+        lda zp_tm_clx_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_clx_hi
+        rol a
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_px_lo
+        sta zp_mul16_lo
+        txa
+        adc zp_mesh_px_hi
+        sta zp_mul16_hi
+        ; world_z = rot_z + pz: fail if negative, or z8 < 17 (also z = 0)
+        lda zp_tm_rot_z
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_pz_lo
+        sta zp_world_z_lo
+        txa
+        adc zp_mesh_pz_hi
+        bpl +
+        jmp _cm_fail
++       lsr a                   ; Carry = bit 0 of the high byte
+        lda zp_world_z_lo
+        ror a                   ; z8 = world_z >> 1
+        cmp #17
+        bcs +
+        jmp _cm_fail
++       tax
+        ldy recip_persp,x
+        sty zp_recip
+        ; screen_x = 40 + highbyte(world_x * recip)
+        #mul16s_8u_hi_m
+        clc
+        adc #40
+        sta screen_x+3
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_xmin, zp_bnd_xmax
+.endif
+        ; screen_y = 25 - highbyte(world_y * recip), world_y = ly + py
+        clc
+        lda #<(-104)
+        adc zp_mesh_py_lo
+        sta zp_mul16_lo
+        lda #>(-104)
+        adc zp_mesh_py_hi
+        sta zp_mul16_hi
+        ldy zp_recip
+        #mul16s_8u_hi_m
+        eor #$ff
+        sec
+        adc #25
+        sta screen_y+3
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_ymin, zp_bnd_ymax
+.endif
+
+; Vertex 4: (0, 0, 120)
+        ldx zp_cm_c
+        ldy zp_cm_cn
+        sec
+        lda smult_sq1_lo+248,x  ; c * 120
+        sbc smult_sq2_lo+248,y
+        sta zp_tm_clz_lo
+        lda smult_sq1_hi+248,x
+        sbc smult_sq2_hi+248,y
+        sta zp_tm_clz_hi
+        ldx zp_cm_s
+        ldy zp_cm_sn
+        sec
+        lda smult_sq1_lo+248,x  ; s * 120
+        sbc smult_sq2_lo+248,y
+        sta zp_tm_slz_lo
+        lda smult_sq1_hi+248,x
+        sbc smult_sq2_hi+248,y
+        sta zp_tm_slz_hi
+        ; rot_z, for sorting
+        lda zp_tm_clz_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_clz_hi
+        rol a
+        sta zp_tm_rot_z
+        eor #SORT_XOR
+        sta mesh_rot_z+4
+        ; world_x = rot_x + px, straight into the multiply input
+        lda zp_tm_slz_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_slz_hi
+        rol a
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_px_lo
+        sta zp_mul16_lo
+        txa
+        adc zp_mesh_px_hi
+        sta zp_mul16_hi
+        ; world_z = rot_z + pz: fail if negative, or z8 < 17 (also z = 0)
+        lda zp_tm_rot_z
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_pz_lo
+        sta zp_world_z_lo
+        txa
+        adc zp_mesh_pz_hi
+        bpl +
+        jmp _cm_fail
++       lsr a                   ; Carry = bit 0 of the high byte
+        lda zp_world_z_lo
+        ror a                   ; z8 = world_z >> 1
+        cmp #17
+        bcs +
+        jmp _cm_fail
++       tax
+        ldy recip_persp,x
+        sty zp_recip
+        ; screen_x = 40 + highbyte(world_x * recip)
+        #mul16s_8u_hi_m
+        clc
+        adc #40
+        sta screen_x+4
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_xmin, zp_bnd_xmax
+.endif
+        ; screen_y = 25 - highbyte(world_y * recip), world_y = ly + py
+        clc
+        lda #<(0)
+        adc zp_mesh_py_lo
+        sta zp_mul16_lo
+        lda #>(0)
+        adc zp_mesh_py_hi
+        sta zp_mul16_hi
+        ldy zp_recip
+        #mul16s_8u_hi_m
+        eor #$ff
+        sec
+        adc #25
+        sta screen_y+4
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_ymin, zp_bnd_ymax
+.endif
+
+; Vertex 5: (0, 0, -120)
+        ldx zp_cm_c
+        ldy zp_cm_cn
+        sec
+        lda smult_sq1_lo+8,x    ; c * -120
+        sbc smult_sq2_lo+8,y
+        sta zp_tm_clz_lo
+        lda smult_sq1_hi+8,x
+        sbc smult_sq2_hi+8,y
+        sta zp_tm_clz_hi
+        ldx zp_cm_s
+        ldy zp_cm_sn
+        sec
+        lda smult_sq1_lo+8,x    ; s * -120
+        sbc smult_sq2_lo+8,y
+        sta zp_tm_slz_lo
+        lda smult_sq1_hi+8,x
+        sbc smult_sq2_hi+8,y
+        sta zp_tm_slz_hi
+        ; rot_z, for sorting
+        lda zp_tm_clz_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_clz_hi
+        rol a
+        sta zp_tm_rot_z
+        eor #SORT_XOR
+        sta mesh_rot_z+5
+        ; world_x = rot_x + px, straight into the multiply input
+        lda zp_tm_slz_lo
+        rol a                   ; Bit 7 into carry
+        lda zp_tm_slz_hi
+        rol a
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_px_lo
+        sta zp_mul16_lo
+        txa
+        adc zp_mesh_px_hi
+        sta zp_mul16_hi
+        ; world_z = rot_z + pz: fail if negative, or z8 < 17 (also z = 0)
+        lda zp_tm_rot_z
+        ldx #0
+        cmp #$80
+        bcc +
+        dex                     ; X = sign extension
++       clc
+        adc zp_mesh_pz_lo
+        sta zp_world_z_lo
+        txa
+        adc zp_mesh_pz_hi
+        bpl +
+        jmp _cm_fail
++       lsr a                   ; Carry = bit 0 of the high byte
+        lda zp_world_z_lo
+        ror a                   ; z8 = world_z >> 1
+        cmp #17
+        bcs +
+        jmp _cm_fail
++       tax
+        ldy recip_persp,x
+        sty zp_recip
+        ; screen_x = 40 + highbyte(world_x * recip)
+        #mul16s_8u_hi_m
+        clc
+        adc #40
+        sta screen_x+5
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_xmin, zp_bnd_xmax
+.endif
+        ; screen_y = 25 - highbyte(world_y * recip), world_y = ly + py
+        clc
+        lda #<(0)
+        adc zp_mesh_py_lo
+        sta zp_mul16_lo
+        lda #>(0)
+        adc zp_mesh_py_hi
+        sta zp_mul16_hi
+        ldy zp_recip
+        #mul16s_8u_hi_m
+        eor #$ff
+        sec
+        adc #25
+        sta screen_y+5
+.if DIRTY_CLEAR
+        #track_bound_m zp_bnd_ymin, zp_bnd_ymax
+.endif
+
+        lda #0                  ; All vertices done
+        rts
+
+_cm_fail
+        lda #$ff
+        rts
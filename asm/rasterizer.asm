@@ -378,6 +378,36 @@ _skip_top_trap
 _done_triangle
         rts
 
+.if EXTENT_CLEAR
+; track_extent_m - Widen the extent of zp_y's character row in the draw
+; buffer's ext_col0/ext_col1 to span [xl, xr). Empty spans are ignored.
+; ~35 cycles per span. Destroys: A, X, Y
+track_extent_m .macro xl, xr
+        ldy \xr
+        cpy \xl
+        beq _\@done             ; Empty: xr <= xl
+        bcc _\@done
+        lda zp_y
+        lsr a
+        clc
+        adc zp_ext_base
+        tax
+        lda \xl
+        lsr a
+        cmp ext_col0,x
+        bcs _\@left_ok
+        sta ext_col0,x
+_\@left_ok
+        dey                     ; Last pixel xr - 1
+        tya
+        lsr a
+        cmp ext_col1,x
+        bcc _\@done
+        sta ext_col1,x
+_\@done
+.endm
+.endif
+
 ; ============================================================================
 ; ROUTINE: rasterize_trapezoid
 ; ============================================================================
@@ -435,6 +465,9 @@ _got_endpoints
         sta zp_xr
         stx zp_xl
 _no_swap_xl
+.if EXTENT_CLEAR
+        #track_extent_m zp_xl, zp_xr
+.endif
         ; Check if we can do dual-row optimization
         lda zp_y
         tax                     ; Save original Y in X
@@ -501,6 +534,9 @@ _got_endpoints2
         sta zp_xr2
         stx zp_xl2
 +
+.if EXTENT_CLEAR
+        #track_extent_m zp_xl2, zp_xr2
+.endif
         ; ----------------------------------------------------------------
         ; Inlined draw_dual_row_intervals
         ; ----------------------------------------------------------------
@@ -1092,6 +1128,39 @@ smc_screen_hi_3 = * + 1         ; SMC: patch this byte
         sta (zp_screen_lo),y
 
 _drs_full_loop
+.if UNROLLED_SPANS
+        ; count = full_end - full_start
+        lda zp_blit_fend
+        sec
+        sbc zp_blit_fstart
+        beq _drs_right_partial  ; count = 0, skip
+        cmp #SPAN_UNROLL_MIN
+        bcc _drs_short          ; Setup costs more than the loop saves
+
+        ; Jump into the run for the page holding the span's end address,
+        ; (40 - count) stores in, with Y = low byte of that address
+        tax
+        lda span_entry_ofs,x    ; 3 * (40 - count)
+        sta zp_blit_temp
+        clc
+        lda zp_screen_lo
+        adc zp_blit_fend
+        tay
+        lda zp_screen_hi
+        adc #0
+        tax                     ; Page, SCREEN_BUF_0 .. SCREEN_BUF_2+3
+        lda span_run_lo-SCREEN_BUF_0,x
+        ora zp_blit_temp        ; Runs are 128-byte aligned, entry < 128
+        sta _drs_smc_run + 1
+        lda span_run_hi-SCREEN_BUF_0,x
+        sta _drs_smc_run + 2
+        lda zp_blit_color
+_drs_smc_run
+        jmp $ffff               ; Run ends with jmp span_run_exit
+
+_drs_short
+        tax                     ; X = count, kept through the patch below
+.endif
         ; SMC version: 10 cycles/char inner loop
         ; Patch address = screen + full_start, X counts down from count-1 to 0
         clc
@@ -1103,11 +1172,13 @@ _drs_full_loop
         sta _drs_smc_sta + 2
 
         ; X = count - 1 = full_end - full_start - 1
+.if !UNROLLED_SPANS
         lda zp_blit_fend
         sec
         sbc zp_blit_fstart
         beq _drs_right_partial  ; count = 0, skip
         tax
+.endif
         dex
         bmi _drs_right_partial  ; count = 1 but underflowed (shouldn't happen, but safe)
 
@@ -1118,6 +1189,9 @@ _drs_smc_sta
         bpl _drs_smc_sta        ; 3 cycles = 10 total
 
 _drs_right_partial
+.if UNROLLED_SPANS
+span_run_exit = _drs_right_partial ; Where span_runs return (a cheap label is not visible there)
+.endif
         ; Check if xr is odd (right partial needed)
         lda zp_xr
         lsr a                   ; carry = xr & 1
@@ -1273,6 +1347,152 @@ smc_clear_4 = * + 2
         bne -
         rts
 
+.if DIRTY_CLEAR
+; ============================================================================
+; ROUTINE: clear_dirty
+; ============================================================================
+; Clear one draw buffer's dirty rectangle (dirty_row0/1, dirty_col0/1 in
+; main.asm) to color 0. Column by column: each column is a JSR into that
+; buffer's unrolled chain of "sta row,y" stores (5 cycles per byte), entered
+; at the first dirty row and cut short by an RTS patched in after the last.
+; About 5 cycles per byte plus 20 per column, vs 6,413 for clear_screen.
+;
+; Input: X = buffer index (0-2, as in buf_table)
+;
+; Destroys: A, X, Y
+; ============================================================================
+
+clear_dirty
+        lda dirty_col1,x
+        sta zp_cd_col_end
+        cmp dirty_col0,x
+        bcc _cd_done            ; No columns (nothing was drawn)
+        lda dirty_row1,x
+        cmp dirty_row0,x
+        bcc _cd_done            ; No rows
+
+        ; End: the store after the last row becomes RTS
+        adc #0                  ; carry set: A = row1 + 1
+        sta zp_cd_temp
+        asl a
+        adc zp_cd_temp          ; A = 3 * (row1 + 1), carry clear (<= 75)
+        adc cd_chain_lo,x
+        sta zp_cd_end_lo
+        lda cd_chain_hi,x
+        adc #0
+        sta zp_cd_end_hi
+
+        ; Entry: the store of the first row
+        lda dirty_row0,x
+        sta zp_cd_temp
+        asl a
+        adc zp_cd_temp          ; A = 3 * row0, carry clear
+        adc cd_chain_lo,x
+        sta _cd_jsr+1
+        lda cd_chain_hi,x
+        adc #0
+        sta _cd_jsr+2
+
+        ldy #0
+        lda (zp_cd_end_lo),y
+        sta zp_cd_saved
+        lda #$60                ; RTS
+        sta (zp_cd_end_lo),y
+
+        lda dirty_col0,x
+        tay
+        lda #0                  ; Clear color byte, kept in A by the chain
+_cd_col
+_cd_jsr jsr $ffff               ; SMC: first dirty row in this buffer's chain
+        iny
+        cpy zp_cd_col_end
+        bcc _cd_col
+        beq _cd_col
+
+        ; Put back the opcode the RTS replaced
+        ldy #0
+        lda zp_cd_saved
+        sta (zp_cd_end_lo),y
+_cd_done
+        rts
+
+; One chain per buffer: a store per character row, then RTS
+CD_CHAIN_SIZE = 3 * CHAR_HEIGHT + 1
+
+cd_chains
+        .for buf = 0, buf < 3, buf += 1
+            .for row = 0, row < CHAR_HEIGHT, row += 1
+                sta ((SCREEN_BUF_0 + buf * (SCREEN_BUF_1 - SCREEN_BUF_0)) << 8) + row * CHAR_WIDTH,y
+            .endfor
+            rts
+        .endfor
+
+cd_chain_lo
+        .for buf = 0, buf < 3, buf += 1
+            .byte <(cd_chains + buf * CD_CHAIN_SIZE)
+        .endfor
+
+cd_chain_hi
+        .for buf = 0, buf < 3, buf += 1
+            .byte >(cd_chains + buf * CD_CHAIN_SIZE)
+        .endfor
+.endif
+
+.if EXTENT_CLEAR
+; ============================================================================
+; ROUTINE: clear_row_extents
+; ============================================================================
+; Clear to color 0 the characters the rasterizer wrote into the draw buffer
+; on its previous frame (ext_col0/col1 for buf_draw_idx), marking each row
+; empty again for this frame's tracking. Sets zp_ext_base for
+; rasterize_trapezoid. About 11 cycles per byte plus 70 per non-empty row.
+;
+; Destroys: A, X, Y
+; ============================================================================
+
+clear_row_extents
+        ldx buf_draw_idx
+        lda ext_base_table,x
+        sta zp_ext_base
+        tax                     ; X = this buffer's entry for row 0
+        lda #0
+        sta zp_ce_row
+_cre_row
+        lda ext_col1,x
+        sec
+        sbc ext_col0,x
+        bcc _cre_next           ; col1 < col0: nothing written
+        sta zp_ce_count         ; Characters - 1
+
+        ; Pointer to the row's first written character
+        ldy zp_ce_row
+        lda row_offset_lo,y
+        clc
+        adc ext_col0,x
+        sta zp_ce_ptr_lo
+        lda row_offset_hi,y
+        adc buf_draw
+        sta zp_ce_ptr_hi
+
+        ldy zp_ce_count
+        lda #0
+-       sta (zp_ce_ptr_lo),y
+        dey
+        bpl -
+
+        lda #CHAR_WIDTH         ; Empty until rasterized again
+        sta ext_col0,x
+        lda #0
+        sta ext_col1,x
+_cre_next
+        inx
+        inc zp_ce_row
+        lda zp_ce_row
+        cmp #CHAR_HEIGHT
+        bcc _cre_row
+        rts
+.endif
+
 ; ============================================================================
 ; LOOKUP TABLES
 ; ============================================================================
@@ -1385,6 +1605,40 @@ pixel_mask
         .byte PIXEL_BL_MASK     ; 2: bottom-left = $0C
         .byte PIXEL_BR_MASK     ; 3: bottom-right = $03
 
+.if UNROLLED_SPANS
+; Unrolled stores for draw_dual_row_simple, one run per page of the three
+; screen buffers ($0400-$0FFF). Store k of the run for page p is
+; sta p*256 - 40 + k,y: entered at store 40 - count with Y = low byte of
+; the span's end address, it fills the count bytes before that address.
+; 5 cycles per char; one run per page keeps Y in range without patching.
+SPAN_UNROLL_MIN = 6             ; Shorter spans use the loop
+
+span_entry_ofs
+        .for n = 0, n <= CHAR_WIDTH, n += 1
+            .byte 3 * (CHAR_WIDTH - n)
+        .endfor
+
+span_run_lo
+        .for page = SCREEN_BUF_0, page < SCREEN_BUF_2 + 4, page += 1
+            .byte <(span_runs + (page - SCREEN_BUF_0) * 128)
+        .endfor
+
+span_run_hi
+        .for page = SCREEN_BUF_0, page < SCREEN_BUF_2 + 4, page += 1
+            .byte >(span_runs + (page - SCREEN_BUF_0) * 128)
+        .endfor
+
+        .align 128
+span_runs
+        .for page = SCREEN_BUF_0, page < SCREEN_BUF_2 + 4, page += 1
+            .for k = 0, k < CHAR_WIDTH, k += 1
+                sta page * 256 - CHAR_WIDTH + k,y
+            .endfor
+            jmp span_run_exit
+            .align 128          ; 123 bytes per run
+        .endfor
+.endif
+
 ; ============================================================================
 ; END OF RASTERIZER
 ; ============================================================================
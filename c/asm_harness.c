@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <string.h>
+#include "asm_harness.h"
+#include "rasterize.h"
+
+/* Give up on a frame (or a single call) after this many cycles */
+#define MAX_FRAME_CYCLES 100000000
+
+static void watch_write(Sim6502 *cpu, uint16_t addr, uint8_t value) {
+    AsmHarness *h = cpu->user;
+    if (addr == h->buf_ready) {
+        /* Flip at once; triple_buf_init also stores here, so only a store
+         * from the main loop ends a frame */
+        cpu->mem[h->buf_display] = value;
+        if (cpu->depth == 0) h->frame_done = 1;
+    }
+}
+
+int asm_harness_open(AsmHarness *h, const char *prg, const char *labels) {
+    sim_init(&h->cpu);
+    h->labels.labels = NULL;
+    h->labels.count = 0;
+
+    if (sim_load_prg(&h->cpu, prg) < 0) {
+        fprintf(stderr, "Cannot load %s\n", prg);
+        return -1;
+    }
+    if (sim_load_labels(&h->labels, labels) < 0) {
+        fprintf(stderr, "Cannot read labels %s\n", labels);
+        return -1;
+    }
+
+    int entry = sim_basic_sys(&h->cpu);
+    h->draw_triangle = sim_label_value(&h->labels, "draw_triangle");
+    h->buf_ready = sim_label_value(&h->labels, "buf_ready");
+    h->buf_display = sim_label_value(&h->labels, "buf_display");
+    h->buf_draw = sim_label_value(&h->labels, "buf_draw");
+    h->zp_ax = sim_label_value(&h->labels, "zp_ax");
+    h->zp_color = sim_label_value(&h->labels, "zp_color");
+    if (entry < 0 || h->draw_triangle < 0 || h->buf_ready < 0 ||
+        h->buf_display < 0 || h->buf_draw < 0 || h->zp_ax < 0 || h->zp_color < 0) {
+        fprintf(stderr, "%s: need a SYS stub and draw_triangle, buf_* and zp_* labels\n",
+                prg);
+        asm_harness_close(h);
+        return -1;
+    }
+
+    h->cpu.pc = (uint16_t)entry;
+    h->cpu.on_write = watch_write;
+    h->cpu.user = h;
+    if (asm_run_frame(h) < 0) {
+        fprintf(stderr, "%s: first frame did not finish (PC=$%04x)\n", prg, h->cpu.pc);
+        asm_harness_close(h);
+        return -1;
+    }
+    return 0;
+}
+
+void asm_harness_close(AsmHarness *h) {
+    sim_free_labels(&h->labels);
+}
+
+int64_t asm_run_frame(AsmHarness *h) {
+    Sim6502 *cpu = &h->cpu;
+    uint64_t start = cpu->cycles;
+
+    h->frame_done = 0;
+    h->num_traced = 0;
+    while (!h->frame_done) {
+        if (cpu->pc == h->draw_triangle) {
+            if (h->num_traced < ASM_MAX_TRACED) {
+                AsmTriangle *t = &h->traced[h->num_traced];
+                const uint8_t *zp = cpu->mem + h->zp_ax;
+                t->ax = zp[0];
+                t->ay = zp[1];
+                t->bx = zp[2];
+                t->by = zp[3];
+                t->cx = zp[4];
+                t->cy = zp[5];
+                t->color = cpu->mem[h->zp_color];
+            }
+            h->num_traced++;
+        }
+        if (!sim_step(cpu) || cpu->cycles - start > MAX_FRAME_CYCLES) return -1;
+    }
+    return (int64_t)(cpu->cycles - start);
+}
+
+const unsigned char *asm_frame_screen(const AsmHarness *h) {
+    return h->cpu.mem + (h->cpu.mem[h->buf_ready] << 8);
+}
+
+int64_t asm_draw_triangle(AsmHarness *h, unsigned char *buf, int ax, int ay,
+                          int bx, int by, int cx, int cy, unsigned char color) {
+    Sim6502 *cpu = &h->cpu;
+    unsigned char *screen = cpu->mem + (cpu->mem[h->buf_draw] << 8);
+    uint8_t *zp = cpu->mem + h->zp_ax;
+
+    memcpy(screen, buf, SCREEN_SIZE);
+    zp[0] = (uint8_t)ax;
+    zp[1] = (uint8_t)ay;
+    zp[2] = (uint8_t)bx;
+    zp[3] = (uint8_t)by;
+    zp[4] = (uint8_t)cx;
+    zp[5] = (uint8_t)cy;
+    cpu->mem[h->zp_color] = color;
+
+    int64_t cycles = sim_call(cpu, (uint16_t)h->draw_triangle, MAX_FRAME_CYCLES);
+    memcpy(buf, screen, SCREEN_SIZE);
+    return cycles;
+}
@@ -0,0 +1,54 @@
+#ifndef ASM_HARNESS_H
+#define ASM_HARNESS_H
+
+#include "sim6502.h"
+
+/* Default build checked by the tests (asm/steve.prg, single mesh) */
+#define ASM_DEFAULT_PRG    "../asm/steve.prg"
+#define ASM_DEFAULT_LABELS "../asm/steve_labels.txt"
+
+/* Most draw_triangle calls traced in one frame (2 sub-meshes of 256 faces) */
+#define ASM_MAX_TRACED 512
+
+/* Inputs of one draw_triangle call, as loaded into zp_ax..zp_cy/zp_color */
+typedef struct {
+    uint8_t ax, ay, bx, by, cx, cy;
+    uint8_t color;
+} AsmTriangle;
+
+/* An assembled demo running on the simulator, past its initialization.
+ * The page flip is applied as soon as a frame is queued (no IRQ), so the
+ * triple-buffered main loop never waits. */
+typedef struct {
+    Sim6502 cpu;
+    SimLabels labels;
+    int draw_triangle;          /* Label addresses */
+    int buf_ready, buf_display, buf_draw;
+    int zp_ax, zp_color;        /* draw_triangle inputs: zp_ax..zp_cy are consecutive */
+    int frame_done;
+
+    AsmTriangle traced[ASM_MAX_TRACED];  /* draw_triangle calls, last frame */
+    int num_traced;             /* May exceed ASM_MAX_TRACED; extras not kept */
+} AsmHarness;
+
+/* Load a .prg and its 64tass label file, then run the program from its SYS
+ * address until the main loop queues its first frame.
+ * Returns 0 on success, -1 on error (message on stderr). */
+int asm_harness_open(AsmHarness *h, const char *prg, const char *labels);
+
+void asm_harness_close(AsmHarness *h);
+
+/* Run the main loop until the next frame is queued, tracing draw_triangle
+ * calls. Returns the frame's cycles, or -1 if the CPU halted or hung. */
+int64_t asm_run_frame(AsmHarness *h);
+
+/* The 1000-byte screen of the most recently queued frame */
+const unsigned char *asm_frame_screen(const AsmHarness *h);
+
+/* Call the assembled draw_triangle on a copy of buf (SCREEN_SIZE bytes)
+ * in the current draw buffer, then copy the result back.
+ * Returns cycles including JSR and RTS, or -1 on a halt. */
+int64_t asm_draw_triangle(AsmHarness *h, unsigned char *buf, int ax, int ay,
+                          int bx, int by, int cx, int cy, unsigned char color);
+
+#endif /* ASM_HARNESS_H */
@@ -435,8 +435,349 @@ def normal_shading_colors(positions, indices):
     print(f"Normal shading: {counts[0]} dark, {counts[1]} medium, {counts[2]} light")
     return face_colors
 
-def export_assembly(frames, indices, output_path):
-    """Export baked animation as assembly data."""
+# Delta stream: vertices are coded in groups of DELTA_GROUP per axis
+DELTA_GROUP = 7
+
+def encode_frame_delta(prev, cur):
+    """Encode the change from frame prev to frame cur (lists of [x, y, z]).
+
+    Per axis (x, y, z), one group per DELTA_GROUP vertices:
+      header byte: bits 0-6 = vertex changes (bit 0 = first of the group),
+                   bit 7 = deltas are bytes (else signed nibbles)
+      deltas for the changed vertices in order: int8 bytes, or nibble pairs
+      (low nibble first, high nibble 0 if the count is odd)
+    A group whose deltas all fit in -8..7 uses nibbles. An unchanged group
+    is just a zero header.
+    """
+    out = []
+    for axis in range(3):
+        for g in range(0, len(cur), DELTA_GROUP):
+            deltas = [int(cur[v][axis]) - int(prev[v][axis])
+                      for v in range(g, min(g + DELTA_GROUP, len(cur)))]
+            header = sum(1 << i for i, d in enumerate(deltas) if d != 0)
+            changed = [d for d in deltas if d != 0]
+            if any(d < -8 or d > 7 for d in changed):
+                out.append(header | 0x80)
+                out.extend(d & 0xff for d in changed)
+            else:
+                out.append(header)
+                for i in range(0, len(changed), 2):
+                    hi = changed[i + 1] & 0x0f if i + 1 < len(changed) else 0
+                    out.append((hi << 4) | (changed[i] & 0x0f))
+    return out
+
+def decode_frame_delta(data, pos, prev):
+    """Apply the delta at data[pos:] to a copy of prev, as the asm player
+    does (int8 wraparound). Returns (frame, position after the delta)."""
+    cur = [[int(c) for c in p] for p in prev]
+    for axis in range(3):
+        for g in range(0, len(cur), DELTA_GROUP):
+            header = data[pos]
+            pos += 1
+            half = None
+            for i in range(DELTA_GROUP):
+                if not header >> i & 1:
+                    continue
+                if header & 0x80:
+                    d = data[pos]
+                    pos += 1
+                elif half is None:
+                    half = data[pos] >> 4
+                    d = data[pos] & 0x0f
+                    pos += 1
+                else:
+                    d, half = half, None
+                if header & 0x80:
+                    d = d - 256 if d > 127 else d
+                else:
+                    d = d - 16 if d > 7 else d
+                cur[g + i][axis] = (cur[g + i][axis] + d + 128) % 256 - 128
+    return cur, pos
+
+def write_byte_rows(f, data):
+    """Write bytes as .byte rows of 16"""
+    for i in range(0, len(data), 16):
+        f.write('        .byte ' + ', '.join(f'${x:02x}' for x in data[i:i+16]) + '\n')
+
+def write_delta_stream(f, frames):
+    """Write the ANIM_DELTA variant: frame deltas 0->1, ..., last->0, each
+    checked by decoding it again."""
+    total = 0
+    f.write('grunt_delta\n')
+    for i in range(len(frames)):
+        prev, cur = frames[i], frames[(i + 1) % len(frames)]
+        data = encode_frame_delta(prev, cur)
+        decoded, end = decode_frame_delta(data, 0, prev)
+        assert end == len(data)
+        assert decoded == [[int(c) for c in p] for p in cur], f'delta {i} does not round-trip'
+        f.write(f'        ; Frame {i} -> {(i + 1) % len(frames)}\n')
+        write_byte_rows(f, data)
+        total += len(data)
+    f.write('grunt_delta_end\n\n')
+    return total
+
+# ANIM_KEYFRAMES: one keyframe per KEY_SPACING baked frames, blended at
+# runtime in steps of 1/4 (BLEND_SELECT picks the arrays per step,
+# BLEND_ADDS how many of the blend's adds it needs)
+KEY_SPACING = 4
+BLEND_SELECT = [(0, 0, 0), (0, 0, 1), (0, 0, 1), (1, 0, 1)]
+BLEND_ADDS = [0, 2, 1, 2]
+
+def blend_keyframes(a, b, step):
+    """Vertex value at step/4 of the way from keyframe value a to b, exactly
+    as transform_mesh computes it from +128-biased bytes:
+    avg(P, avg(Q, R)) with P, Q, R each a or b (BLEND_SELECT), rounded down,
+    cut short to Q or avg(Q, R) for BLEND_ADDS 0 or 1 (set_mesh_blend)"""
+    pick = [a + 128, b + 128]
+    p, q, r = (pick[i] for i in BLEND_SELECT[step])
+    adds = BLEND_ADDS[step]
+    if adds == 0:
+        return q - 128
+    if adds == 1:
+        return ((q + r) >> 1) - 128
+    return ((p + ((q + r) >> 1)) >> 1) - 128
+
+def blended_frame(frames, frame_idx):
+    """Frame frame_idx as ANIM_KEYFRAMES plays it, blended from keyframes"""
+    keys = frames[::KEY_SPACING]
+    key = frame_idx // KEY_SPACING
+    a, b = keys[key], keys[(key + 1) % len(keys)]
+    step = (frame_idx % KEY_SPACING) * 4 // KEY_SPACING
+    return [[blend_keyframes(int(a[v][axis]), int(b[v][axis]), step) for axis in range(3)]
+            for v in range(len(a))]
+
+def write_keyframes(f, frames):
+    """Write the ANIM_KEYFRAMES variant: every KEY_SPACING-th frame, biased
+    by +128, with pointer tables. Returns the bytes used, or None if the
+    frame count is not a multiple of KEY_SPACING: the blend would not loop
+    evenly, so the variant is left out (assembling with it is an error)."""
+    if len(frames) % KEY_SPACING != 0:
+        f.write(f'        .error "ANIM_KEYFRAMES needs a multiple of {KEY_SPACING} frames, '
+                f'rebake with bake_animation.py"\n')
+        print(f"Keyframes: skipped, {len(frames)} frames is not a multiple of {KEY_SPACING}")
+        return None
+    keys = frames[::KEY_SPACING]
+    num_keys = len(keys)
+    f.write(f'GRUNT_NUM_KEYS = {num_keys}\n')
+    f.write(f'GRUNT_KEY_SPACING = {KEY_SPACING}\n\n')
+    for key_idx, positions in enumerate(keys):
+        f.write(f'; Keyframe {key_idx} (frame {key_idx * KEY_SPACING}), biased by +128\n')
+        for axis, name in enumerate(['x', 'y', 'z']):
+            f.write(f'grunt_k{name}_{key_idx}\n')
+            write_byte_rows(f, [int(p[axis]) + 128 for p in positions])
+            f.write('\n')
+    for axis in ['x', 'y', 'z']:
+        f.write(f'grunt_k{axis}_lo\n')
+        for i in range(num_keys):
+            f.write(f'        .byte <grunt_k{axis}_{i}\n')
+        f.write(f'\ngrunt_k{axis}_hi\n')
+        for i in range(num_keys):
+            f.write(f'        .byte >grunt_k{axis}_{i}\n')
+        f.write('\n')
+
+    # How far the blended frames are from the baked ones
+    errors = []
+    for frame_idx, positions in enumerate(frames):
+        blended = blended_frame(frames, frame_idx)
+        for v, p in enumerate(positions):
+            for axis in range(3):
+                errors.append(abs(blended[v][axis] - int(p[axis])))
+    print(f"Keyframes: {num_keys}, blend error vs baked frames: "
+          f"mean {sum(errors) / len(errors):.2f}, max {max(errors)}")
+    return num_keys * len(frames[0]) * 3
+
+# Potentially visible sets: per theta sector of 1 << PVS_SECTOR_SHIFT steps,
+# the faces that can face the camera for mesh positions in the PVS_VIEW box.
+# Mirrors compute_face_pvs() in mesh.c; the box is around init_grunt's
+# position (0, 0, 200).
+PVS_SECTOR_SHIFT = 4
+PVS_VIEW = ((-8, 8), (-8, 8), (192, 512))
+
+def round_away(x):
+    """Round half away from zero, like C lround."""
+    import math
+    return int(math.floor(abs(x) + 0.5)) * (1 if x >= 0 else -1)
+
+def trunc_div(a, b):
+    """Integer division rounding toward zero, like C."""
+    q = abs(a) // abs(b)
+    return q if (a < 0) == (b < 0) else -q
+
+def face_planes(positions, indices):
+    """int8 face normals (length ~127) and offsets, as compute_face_planes."""
+    import math
+    planes = []
+    for f in range(len(indices) // 3):
+        a, b, c = (positions[indices[f*3 + n]] for n in range(3))
+        u = [int(b[n]) - int(a[n]) for n in range(3)]
+        w = [int(c[n]) - int(a[n]) for n in range(3)]
+        cross = [u[1]*w[2] - u[2]*w[1], u[2]*w[0] - u[0]*w[2], u[0]*w[1] - u[1]*w[0]]
+        length = math.sqrt(sum(x * x for x in cross))
+        if length == 0:
+            n = [0, 0, 0]
+        else:
+            n = [round_away(x * 127.0 / length) for x in cross]
+        planes.append((n[0], n[1], n[2], sum(n[i] * int(a[i]) for i in range(3))))
+    return planes
+
+def view_cameras(theta):
+    """Camera in object space (s.8) and the cull margin for each corner of
+    PVS_VIEW, as object_camera() and cull_margin() in mesh.c, with the
+    rotation tables of both renderers: the C model's truncated ones
+    (init_mesh_tables), then mesh.asm's rounded rcos/rsin."""
+    import math
+    angle = theta * 2.0 * math.pi / 256.0
+    tables = [(int(math.cos(angle) * 127.0), int(math.sin(angle) * 127.0)),
+              (round_away(math.cos(angle) * 127.0), round_away(math.sin(angle) * 127.0))]
+    cams = []
+    for c, s in tables:
+        r2 = c * c + s * s
+        for corner in range(8):
+            t = [PVS_VIEW[axis][(corner >> axis) & 1] for axis in range(3)]
+            cam = (trunc_div(128 * 256 * (s * t[2] - c * t[0]), r2),
+                   -t[1] * 256,
+                   -trunc_div(128 * 256 * (s * t[0] + c * t[2]), r2))
+            dist = math.sqrt(sum(x * x for x in cam)) / 256.0 + 222.0
+            cams.append((cam, int((0.87 * dist + 2.0 * 128.0) * 256.0) + 256))
+    return cams
+
+def face_pvs(frames, indices):
+    """Faces that can be front-facing in each theta sector on any frame."""
+    num_faces = len(indices) // 3
+    # Planes per face over all frames; rigid parts repeat, so keep each once
+    planes = [set() for _ in range(num_faces)]
+    for positions in frames:
+        for f, plane in enumerate(face_planes(positions, indices)):
+            planes[f].add(plane)
+
+    sectors = []
+    step = 1 << PVS_SECTOR_SHIFT
+    for sector in range(256 // step):
+        visible = set()
+        for theta in range(sector * step, (sector + 1) * step):
+            cams = view_cameras(theta)
+            margin = max(m for _, m in cams)
+            for f in range(num_faces):
+                if f in visible:
+                    continue
+                for nx, ny, nz, nd in planes[f]:
+                    side = max(nx * cam[0] + ny * cam[1] + nz * cam[2] - nd * 256
+                               for cam, _ in cams)
+                    if side >= -margin:
+                        visible.add(f)
+                        break
+        sectors.append(sorted(visible))
+    return sectors
+
+# Where init_grunt puts the mesh: mesh.asm draws the grunt only here
+PVS_ASM_POSITION = (0, 0, 200)
+
+def asm_front_faces(frames, indices):
+    """Faces mesh.asm draws front-facing in each theta sector on any frame
+    at PVS_ASM_POSITION, with its own arithmetic: the rounded rcos/rsin
+    tables, 8-bit rotated coordinates and recip_persp (the model in
+    asm_model_frame in test.c). Snapped to screen pixels, faces close to
+    edge-on can come out front-facing though face_pvs's plane test rejects
+    them, and they still draw a few pixels."""
+    import math
+    num_faces = len(indices) // 3
+    px, py, pz = PVS_ASM_POSITION
+    sectors = []
+    step = 1 << PVS_SECTOR_SHIFT
+    for sector in range(256 // step):
+        visible = set()
+        for theta in range(sector * step, (sector + 1) * step):
+            angle = theta * 2 * 3.14159265358979 / 256
+            c, s = round_away(math.cos(angle) * 127), round_away(math.sin(angle) * 127)
+            for positions in frames:
+                sx, sy = [], []
+                for lx, ly, lz in positions:
+                    lx, ly, lz = int(lx), int(ly), int(lz)
+                    rot_x = ((c * lx + s * lz) >> 7) & 0xff
+                    rot_z = ((c * lz - s * lx) >> 7) & 0xff
+                    rot_x, rot_z = rot_x - (rot_x & 0x80) * 2, rot_z - (rot_z & 0x80) * 2
+                    r = 4096 // (((rot_z + pz) & 0x1ff) >> 1)
+                    sx.append((40 + (((rot_x + px) * r) >> 8)) & 0xff)
+                    sy.append((25 - (((ly + py) * r) >> 8)) & 0xff)
+                for f in range(num_faces):
+                    a, b, k = indices[f*3:f*3 + 3]
+                    if (sx[b] - sx[a]) * (sy[k] - sy[a]) - (sy[b] - sy[a]) * (sx[k] - sx[a]) > 0:
+                        visible.add(f)
+        sectors.append(visible)
+    return sectors
+
+def write_pvs(f, sectors, split, num_faces):
+    """Per sub-mesh face lists for each sector, with pointer and count tables."""
+    f.write('.if PVS_CULL\n')
+    f.write('; Potentially visible faces per theta sector (face_pvs in bake_animation.py)\n')
+    f.write(f'GRUNT_PVS_SHIFT = {PVS_SECTOR_SHIFT}\n\n')
+    size = 0
+    for sub, (first, last) in enumerate([(0, split), (split, num_faces)]):
+        lists = [[face - first for face in faces if first <= face < last]
+                 for faces in sectors]
+        for sector, faces in enumerate(lists):
+            f.write(f'grunt_pvs{sub}_{sector}\n')
+            write_byte_rows(f, faces)
+            f.write('\n')
+            size += len(faces)
+        for part in ['lo', 'hi']:
+            op = '<' if part == 'lo' else '>'
+            f.write(f'grunt_pvs{sub}_{part}\n')
+            for sector in range(len(lists)):
+                f.write(f'        .byte {op}grunt_pvs{sub}_{sector}\n')
+            f.write('\n')
+        f.write(f'grunt_pvs{sub}_n\n')
+        write_byte_rows(f, [len(faces) for faces in lists])
+        f.write('\n')
+    f.write('.endif\n')
+
+    kept = sum(len(faces) for faces in sectors)
+    print(f"PVS: {len(sectors)} sectors, {100.0 - 100.0 * kept / (len(sectors) * num_faces):.1f}% "
+          f"of faces skipped on average, {size + 3 * len(sectors) * 2} bytes")
+
+def write_pvs_header(path, frames, indices, sectors, played, split):
+    """C header with face_pvs's input frames and faces and its result, so
+    run_baked_pvs_tests in test.c can check it against compute_face_pvs().
+    The first played frames are the animation as the demo plays it, and
+    the first split faces are sub-mesh 0 (run_sort_repair_tests)."""
+    num_faces = len(indices) // 3
+    set_bytes = (num_faces + 7) // 8
+    with open(path, 'w') as f:
+        f.write(f'// Generated by bake_animation.py: the grunt\'s potentially visible sets\n')
+        f.write(f'// ({len(sectors)} sectors) and the {len(frames)} frames they were built from\n\n')
+        f.write(f'#define GRUNT_PVS_FRAMES {len(frames)}\n')
+        f.write(f'#define GRUNT_PVS_PLAYED {played}   // Baked frames; the rest are keyframe blends\n')
+        f.write(f'#define GRUNT_PVS_VERTICES {len(frames[0])}\n')
+        f.write(f'#define GRUNT_PVS_FACES {num_faces}\n')
+        f.write(f'#define GRUNT_PVS_FACES_0 {split}   // Faces in sub-mesh 0\n')
+        f.write(f'#define GRUNT_PVS_SECTOR_SHIFT {PVS_SECTOR_SHIFT}\n')
+        f.write(f'#define GRUNT_PVS_SET_BYTES {set_bytes}\n\n')
+        f.write('static const int16_t grunt_pvs_lo[3] = { ' +
+                ', '.join(str(lo) for lo, _ in PVS_VIEW) + ' };\n')
+        f.write('static const int16_t grunt_pvs_hi[3] = { ' +
+                ', '.join(str(hi) for _, hi in PVS_VIEW) + ' };\n\n')
+        for axis, name in enumerate(['x', 'y', 'z']):
+            f.write(f'static int8_t grunt_pvs_v{name}[GRUNT_PVS_FRAMES][GRUNT_PVS_VERTICES] = {{\n')
+            for positions in frames:
+                f.write('    { ' + ', '.join(str(int(p[axis])) for p in positions) + ' },\n')
+            f.write('};\n\n')
+        for n, name in enumerate(['i', 'j', 'k']):
+            f.write(f'static uint8_t grunt_pvs_f{name}[] = {{\n    ' +
+                    ', '.join(str(int(indices[face * 3 + n])) for face in range(num_faces)) +
+                    '\n};\n\n')
+        f.write('// Bit f of set s: face f is in sector s\'s set\n')
+        f.write('static const uint8_t grunt_pvs_sets[][GRUNT_PVS_SET_BYTES] = {\n')
+        for faces in sectors:
+            bits = [0] * set_bytes
+            for face in faces:
+                bits[face >> 3] |= 1 << (face & 7)
+            f.write('    { ' + ', '.join(f'0x{b:02x}' for b in bits) + ' },\n')
+        f.write('};\n')
+    print(f"Exported to {path}")
+
+def export_assembly(frames, indices, output_path, pvs_header_path=None):
+    """Export baked animation as assembly data, and optionally the face
+    sets as a C header (write_pvs_header)."""
     num_frames = len(frames)
     num_vertices = len(frames[0])
     num_faces = len(indices) // 3
@@ -459,19 +800,24 @@ def export_assembly(frames, indices, output_path):
         f.write(f'GRUNT_NUM_FACES_0 = {split}\n')
         f.write(f'GRUNT_NUM_FACES_1 = {num_faces - split}\n\n')
 
-        # Vertex data for each frame
-        for frame_idx, positions in enumerate(frames):
+        # Vertex data: keyframes (ANIM_KEYFRAMES), or frame 0 followed by
+        # the other frames or, with ANIM_DELTA, the deltas between frames
+        f.write('.if ANIM_KEYFRAMES\n')
+        key_size = write_keyframes(f, frames)
+        f.write('.else\n')
+        def write_frame(frame_idx, positions):
             f.write(f'; Frame {frame_idx}\n')
             for axis, name in enumerate(['x', 'y', 'z']):
                 f.write(f'grunt_v{name}_{frame_idx}\n')
-                data = positions[:, axis]
-                for i in range(0, len(data), 16):
-                    chunk = data[i:i+16]
-                    # Convert to unsigned bytes
-                    chunk = [(int(x) if x >= 0 else int(x) + 256) for x in chunk]
-                    f.write('        .byte ' + ', '.join(f'${x:02x}' for x in chunk) + '\n')
+                # Convert to unsigned bytes
+                write_byte_rows(f, [int(p[axis]) & 0xff for p in positions])
                 f.write('\n')
 
+        write_frame(0, frames[0])
+        f.write('.if !ANIM_DELTA\n')
+        for frame_idx in range(1, num_frames):
+            write_frame(frame_idx, frames[frame_idx])
+
         # Frame pointer tables
         for axis in ['x', 'y', 'z']:
             f.write(f'grunt_v{axis}_lo\n')
@@ -482,6 +828,13 @@ def export_assembly(frames, indices, output_path):
                 f.write(f'        .byte >grunt_v{axis}_{i}\n')
             f.write('\n')
 
+        f.write('.else\n')
+        f.write('; Frame deltas, see encode_frame_delta in bake_animation.py\n')
+        f.write(f'GRUNT_DELTA_GROUP = {DELTA_GROUP}\n\n')
+        delta_size = write_delta_stream(f, frames)
+        f.write('.endif\n')
+        f.write('.endif\n\n')
+
         # Face indices (shared across all frames)
         def write_array(name, data):
             f.write(f'{name}\n')
@@ -504,6 +857,23 @@ def export_assembly(frames, indices, output_path):
         write_array('grunt_fcol_0', fcol0)
         write_array('grunt_fcol_1', fcol1)
 
+        # Face sets over the frames as played, including blended ones
+        blended = []
+        if key_size is not None:
+            blended = [blended_frame(frames, n) for n in range(num_frames)]
+        sectors = face_pvs(frames + blended, indices)
+        drawn = asm_front_faces(frames + blended, indices)
+        write_pvs(f, [sorted(set(faces) | more) for faces, more in zip(sectors, drawn)],
+                  split, num_faces)
+
+    if pvs_header_path:
+        write_pvs_header(pvs_header_path, frames + blended, indices, sectors, num_frames, split)
+
+    raw_size = num_frames * num_vertices * 3
+    key_text = f"{key_size} bytes" if key_size is not None else "none"
+    print(f"Vertex data: {raw_size} bytes raw, "
+          f"{num_vertices * 3 + delta_size} bytes as frame 0 + deltas (ANIM_DELTA), "
+          f"{key_text} as keyframes (ANIM_KEYFRAMES)")
     print(f"Exported to {output_path}")
 
 def main():
@@ -516,7 +886,7 @@ def main():
     scaled_frames, merged_indices = merge_and_scale(frames, indices)
 
     print("\nExporting assembly...")
-    export_assembly(scaled_frames, merged_indices, "../asm/grunt_anim.asm")
+    export_assembly(scaled_frames, merged_indices, "../asm/grunt_anim.asm", "grunt_pvs.h")
 
     print("\nDone!")
 
@@ -0,0 +1,302 @@
+/* bench.c - Microbenchmarks for the C rasterizer and mesh pipeline
+ *
+ * Times each primitive over a fixed workload built from a fixed seed, so
+ * runs are comparable between builds. Each benchmark runs for at least the
+ * minimum time per repeat; the fastest of the repeats is reported.
+ *
+ * Usage: ./bench [--json] [-t ms]
+ *   --json  One JSON object with a fixed key order, for tracking builds
+ *           (ops_per_pass is the workload size: spans, triangles or frames)
+ *   -t ms   Minimum time per repeat (default 200)
+ */
+
+#define _POSIX_C_SOURCE 200809L  /* clock_gettime */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "rasterize.h"
+#include "mesh.h"
+#include "grunt_mesh.h"
+
+#define REPEATS 5
+#define NUM_TRIS 1024       /* Triangles per triangle workload */
+#define NUM_SPANS 1024      /* Spans per span workload */
+#define NUM_FRAMES 64       /* Rotation steps per mesh workload */
+
+typedef struct {
+    int16_t v[6];
+    uint8_t color;
+} BenchTri;
+
+typedef struct {
+    int16_t y, xl, xr;
+} BenchSpan;
+
+/* A workload: op n of it runs run(w, n % count); tris and pixels are the
+ * totals over all count ops, counted once up front */
+typedef struct Workload Workload;
+struct Workload {
+    const char *name;
+    void (*run)(Workload *w, int n);
+    int count;
+    long long tris, pixels;
+    const BenchTri *tri;
+    const BenchSpan *span;
+    Mesh *mesh;
+};
+
+static unsigned char screen[SCREEN_SIZE];
+static int16_t screen_x[MESH_MAX_VERTICES], screen_y[MESH_MAX_VERTICES];
+
+/* Fixed-seed generator (xorshift32), independent of the C library's rand() */
+static uint32_t seed = 0x12345678;
+
+static int random_int(int n) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return (int)(seed % (uint32_t)n);
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int count_pixels(const unsigned char *buf) {
+    int n = 0;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) n += get_pixel(buf, x, y) != 0;
+    }
+    return n;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Operations                                                                */
+/* ------------------------------------------------------------------------ */
+
+static void run_clear(Workload *w, int n) {
+    (void)w;
+    clear_screen(screen, n & 3);
+}
+
+static void run_span_top(Workload *w, int n) {
+    const BenchSpan *s = &w->span[n];
+    draw_span_top(screen, s->y & ~1, s->xl, s->xr, 1 + n % 3);
+}
+
+static void run_span_bottom(Workload *w, int n) {
+    const BenchSpan *s = &w->span[n];
+    draw_span_bottom(screen, s->y | 1, s->xl, s->xr, 1 + n % 3);
+}
+
+static void run_dual_row(Workload *w, int n) {
+    const BenchSpan *s = &w->span[n];
+    draw_dual_row_simple(screen, s->y & ~1, s->xl, s->xr, 1 + n % 3);
+}
+
+static void run_triangle(Workload *w, int n) {
+    const BenchTri *t = &w->tri[n];
+    draw_triangle(screen, t->v[0], t->v[1], t->v[2], t->v[3], t->v[4], t->v[5], t->color);
+}
+
+static void run_transform(Workload *w, int n) {
+    w->mesh->theta = (uint8_t)(n * 256 / NUM_FRAMES);
+    transform_mesh(w->mesh, screen_x, screen_y);
+}
+
+static void run_render(Workload *w, int n) {
+    w->mesh->theta = (uint8_t)(n * 256 / NUM_FRAMES);
+    clear_screen(screen, 0);
+    render_mesh(screen, w->mesh);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Workloads                                                                 */
+/* ------------------------------------------------------------------------ */
+
+static void make_spans(BenchSpan *spans) {
+    for (int n = 0; n < NUM_SPANS; n++) {
+        int a = random_int(SCREEN_WIDTH + 1), b = random_int(SCREEN_WIDTH + 1);
+        spans[n].y = (int16_t)random_int(SCREEN_HEIGHT);
+        spans[n].xl = (int16_t)(a < b ? a : b);
+        spans[n].xr = (int16_t)(a < b ? b : a);
+    }
+}
+
+/* Counter-clockwise (kept by the backface cull) unless degenerate */
+static void make_ccw(BenchTri *t) {
+    int det = (t->v[2] - t->v[0]) * (t->v[5] - t->v[1]) -
+              (t->v[3] - t->v[1]) * (t->v[4] - t->v[0]);
+    if (det < 0) {
+        int16_t x = t->v[2], y = t->v[3];
+        t->v[2] = t->v[4];
+        t->v[3] = t->v[5];
+        t->v[4] = x;
+        t->v[5] = y;
+    }
+}
+
+/* kind 0: tiny (within 4x4 pixels), 1: screen-filling, 2: long slivers */
+static void make_triangles(BenchTri *tris, int kind) {
+    for (int n = 0; n < NUM_TRIS; n++) {
+        BenchTri *t = &tris[n];
+        if (kind == 0) {
+            int x = random_int(SCREEN_WIDTH - 4), y = random_int(SCREEN_HEIGHT - 4);
+            for (int c = 0; c < 6; c += 2) {
+                t->v[c] = (int16_t)(x + random_int(5));
+                t->v[c + 1] = (int16_t)(y + random_int(5));
+            }
+        } else if (kind == 1) {
+            t->v[0] = (int16_t)random_int(8);
+            t->v[1] = (int16_t)random_int(8);
+            t->v[2] = (int16_t)(SCREEN_WIDTH - random_int(8));
+            t->v[3] = (int16_t)random_int(8);
+            t->v[4] = (int16_t)random_int(SCREEN_WIDTH);
+            t->v[5] = (int16_t)(SCREEN_HEIGHT - random_int(8));
+        } else {
+            t->v[0] = (int16_t)random_int(SCREEN_WIDTH);
+            t->v[1] = (int16_t)random_int(4);
+            t->v[2] = (int16_t)random_int(SCREEN_WIDTH);
+            t->v[3] = (int16_t)(SCREEN_HEIGHT - random_int(4));
+            t->v[4] = (int16_t)(t->v[2] + 1 + random_int(2));
+            t->v[5] = t->v[3];
+            if (t->v[4] > SCREEN_WIDTH) t->v[4] = (int16_t)(t->v[2] - 2);
+        }
+        t->color = (uint8_t)(1 + random_int(3));
+        make_ccw(t);
+    }
+}
+
+/* Count triangles and pixels of a workload by running each op on its own */
+static void count_work(Workload *w) {
+    w->tris = 0;
+    w->pixels = 0;
+    for (int n = 0; n < w->count; n++) {
+        if (w->tri) {
+            clear_screen(screen, 0);
+            w->run(w, n);
+            w->tris++;
+            w->pixels += count_pixels(screen);
+        } else if (w->span) {
+            int width = w->span[n].xr - w->span[n].xl;
+            w->pixels += w->run == run_dual_row ? 2 * width : width;
+        } else if (w->mesh && w->run == run_render) {
+            TriEdges tris[MESH_MAX_TRIS];
+            w->run(w, n);
+            w->tris += setup_mesh(w->mesh, tris);
+            w->pixels += count_pixels(screen);
+        } else if (!w->mesh) {
+            w->pixels += SCREEN_WIDTH * SCREEN_HEIGHT;
+        }
+    }
+}
+
+/* Fastest ns/op over the repeats */
+static double time_work(Workload *w, double min_ns) {
+    double best = 0.0;
+    for (int r = 0; r < REPEATS; r++) {
+        long long ops = 0;
+        double start = now_ns(), elapsed;
+        do {
+            for (int n = 0; n < w->count; n++) w->run(w, n);
+            ops += w->count;
+            elapsed = now_ns() - start;
+        } while (elapsed < min_ns);
+        double ns = elapsed / ops;
+        if (r == 0 || ns < best) best = ns;
+    }
+    return best;
+}
+
+int main(int argc, char **argv) {
+    int json = 0;
+    double min_ms = 200.0;
+
+    for (int arg = 1; arg < argc; arg++) {
+        if (strcmp(argv[arg], "--json") == 0) {
+            json = 1;
+        } else if (strcmp(argv[arg], "-t") == 0 && arg + 1 < argc) {
+            min_ms = atof(argv[++arg]);
+        } else {
+            fprintf(stderr, "Usage: %s [--json] [-t ms]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    init_mesh_tables();
+
+    static BenchSpan spans[NUM_SPANS];
+    static BenchTri tiny[NUM_TRIS], full[NUM_TRIS], sliver[NUM_TRIS];
+    make_spans(spans);
+    make_triangles(tiny, 0);
+    make_triangles(full, 1);
+    make_triangles(sliver, 2);
+
+    /* Same meshes as test.c's octahedron and grunt demos */
+    int8_t ovx[] = { 120, -120,    0,    0,    0,    0 };
+    int8_t ovy[] = {   0,    0,  120, -120,    0,    0 };
+    int8_t ovz[] = {   0,    0,    0,    0,  120, -120 };
+    uint8_t ofi[] = { 0, 1, 0, 1,  0, 1, 0, 1 };
+    uint8_t ofj[] = { 4, 3, 3, 5,  2, 4, 5, 2 };
+    uint8_t ofk[] = { 3, 4, 5, 3,  4, 2, 2, 5 };
+    uint8_t ocol[] = { 1, 2, 3, 1,  2, 3, 1, 2 };
+    Mesh octa = {
+        .i = ofi, .j = ofj, .k = ofk, .col = ocol, .num_faces = 8,
+        .x = ovx, .y = ovy, .z = ovz, .num_vertices = 6,
+        .px = 0, .py = -25, .pz = 1500
+    };
+    uint8_t gcol[GRUNT_NUM_FACES];
+    for (int f = 0; f < GRUNT_NUM_FACES; f++) gcol[f] = 1 + (f % 3);
+    Mesh grunt = {
+        .i = grunt_faces_i, .j = grunt_faces_j, .k = grunt_faces_k, .col = gcol,
+        .num_faces = GRUNT_NUM_FACES,
+        .x = grunt_vertices_x, .y = grunt_vertices_y, .z = grunt_vertices_z,
+        .num_vertices = GRUNT_NUM_VERTICES,
+        .px = 0, .py = 0, .pz = 1500
+    };
+
+    Workload work[] = {
+        { "clear_screen", run_clear, 4, 0, 0, NULL, NULL, NULL },
+        { "draw_span_top", run_span_top, NUM_SPANS, 0, 0, NULL, spans, NULL },
+        { "draw_span_bottom", run_span_bottom, NUM_SPANS, 0, 0, NULL, spans, NULL },
+        { "draw_dual_row_simple", run_dual_row, NUM_SPANS, 0, 0, NULL, spans, NULL },
+        { "draw_triangle/tiny", run_triangle, NUM_TRIS, 0, 0, tiny, NULL, NULL },
+        { "draw_triangle/full", run_triangle, NUM_TRIS, 0, 0, full, NULL, NULL },
+        { "draw_triangle/sliver", run_triangle, NUM_TRIS, 0, 0, sliver, NULL, NULL },
+        { "transform_mesh/octahedron", run_transform, NUM_FRAMES, 0, 0, NULL, NULL, &octa },
+        { "transform_mesh/grunt", run_transform, NUM_FRAMES, 0, 0, NULL, NULL, &grunt },
+        { "render_mesh/octahedron", run_render, NUM_FRAMES, 0, 0, NULL, NULL, &octa },
+        { "render_mesh/grunt", run_render, NUM_FRAMES, 0, 0, NULL, NULL, &grunt },
+    };
+    int num_work = sizeof(work) / sizeof(work[0]);
+
+    if (json) {
+        printf("{\n  \"repeats\": %d,\n  \"min_ms\": %.0f,\n  \"benchmarks\": [\n",
+               REPEATS, min_ms);
+    } else {
+        printf("%-26s %12s %14s %14s\n", "benchmark", "ns/op", "tris/s", "pixels/s");
+    }
+    for (int b = 0; b < num_work; b++) {
+        Workload *w = &work[b];
+        count_work(w);
+        double ns = time_work(w, min_ms * 1e6);
+        double ops_per_s = 1e9 / ns;
+        double tris_per_s = ops_per_s * w->tris / w->count;
+        double pixels_per_s = ops_per_s * w->pixels / w->count;
+
+        if (json) {
+            printf("    {\"name\": \"%s\", \"ops_per_pass\": %d, \"ns_per_op\": %.2f, "
+                   "\"tris_per_s\": %.0f, \"pixels_per_s\": %.0f}%s\n",
+                   w->name, w->count, ns, tris_per_s, pixels_per_s,
+                   b + 1 < num_work ? "," : "");
+        } else {
+            printf("%-26s %12.2f %14.0f %14.0f\n", w->name, ns, tris_per_s, pixels_per_s);
+        }
+    }
+    if (json) printf("  ]\n}\n");
+    return 0;
+}
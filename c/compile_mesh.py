@@ -0,0 +1,287 @@
+#!/usr/bin/env python3
+"""
+Compile a static mesh's vertex transform into straight-line 6502 code.
+
+transform_mesh in mesh.asm loops over mesh_vx/vy/vz and runs the full
+signed multiply macro (table setup included) four times per vertex. For a
+mesh whose vertices never change, this emits a replacement transform_mesh
+with the coordinates folded into the code:
+
+- The signed quarter-square tables (smult_sq1/sq2 in main.asm) are indexed
+  by X = c + 128 and Y = ~(c + 128), set once per call, at a constant
+  offset of coordinate + 128. A multiply is then 6 instructions, no setup.
+- Multiplies by a zero coordinate are dropped (the octahedron's vertices
+  lie on the axes, so each needs 2 of the 4).
+- Vertex indices, loop control and y sign extension disappear.
+
+The results (screen_x, screen_y, mesh_rot_z, error return) are the same as
+the loop's. Build with COMPILED_TRANSFORM=1, see asm/Makefile.
+
+Usage: python3 compile_mesh.py octahedron ../asm/octa_xform.asm
+       python3 compile_mesh.py --data ../asm/grunt_data.asm grunt out.asm
+"""
+
+import re
+import sys
+
+# Same vertices as init_octahedron in main.asm
+OCTAHEDRON = [(104, 60, 0), (-104, -60, 0), (-60, 104, 0),
+              (60, -104, 0), (0, 0, 120), (0, 0, -120)]
+
+
+def load_vertices(path, prefix):
+    """Vertices from <prefix>_vx/_vy/_vz .byte tables in an asm file."""
+    arrays = {}
+    current = None
+    with open(path) as f:
+        for line in f:
+            label = re.match(r'^(\w+)\s*$', line)
+            if label:
+                current = label.group(1)
+                arrays[current] = []
+                continue
+            data = re.match(r'^\s+\.byte\s+(.*)$', line)
+            if data and current is not None:
+                arrays[current] += [int(x.strip().lstrip('$'), 16)
+                                    for x in data.group(1).split(',')]
+    axes = [arrays[f'{prefix}_v{axis}'] for axis in 'xyz']
+    signed = [[v - 256 if v > 127 else v for v in axis] for axis in axes]
+    return list(zip(*signed))
+
+
+def smult(table, index):
+    """Entry of a signed quarter-square table as main.asm builds it."""
+    first = -256 if table == 'sq1' else -255
+    i = first + index
+    return (i * i) // 4
+
+
+def folded_product(m, k):
+    """m * k the way the compiled code reads it: X = m + 128,
+    Y = ~(m + 128), both tables at offset k + 128."""
+    x, y = m + 128, (m + 128) ^ 0xff
+    return (smult('sq1', k + 128 + x) - smult('sq2', k + 128 + y)) & 0xffff
+
+
+def shift7(value):
+    """Low byte of a 16-bit sum arithmetically shifted right by 7."""
+    return (value >> 7) & 0xff
+
+
+def rotation_terms(lx, lz):
+    """Product terms of rot_x and rot_z: (multiplier, coordinate, subtract).
+    rot_z = c*lz - s*lx uses s * -lx where -lx fits in a byte."""
+    rot_x = [('c', lx, False), ('s', lz, False)]
+    rot_z = [('c', lz, False), ('s', -lx, False) if lx != -128 else ('s', lx, True)]
+    return ([t for t in rot_x if t[1] != 0], [t for t in rot_z if t[1] != 0])
+
+
+def check_folding(vertices):
+    """Every term and sum against the loop's arithmetic, for all c and s."""
+    for lx, _, lz in vertices:
+        terms_x, terms_z = rotation_terms(lx, lz)
+        for c in range(-127, 128):
+            for s in range(-127, 128, 7):
+                mult = {'c': c, 's': s}
+                for terms, want in [(terms_x, c * lx + s * lz),
+                                    (terms_z, c * lz - s * lx)]:
+                    total = 0
+                    for m, k, sub in terms:
+                        p = folded_product(mult[m], k)
+                        total = (total - p if sub else total + p) & 0xffff
+                    assert shift7(total) == shift7(want & 0xffff), (lx, lz, c, s)
+
+
+class Emitter:
+    def __init__(self, out):
+        self.out = out
+
+    def line(self, text='', comment=None):
+        if comment:
+            text = f'{text:<31} ; {comment}' if text else f'        ; {comment}'
+        self.out.write(text.rstrip() + '\n')
+
+    def op(self, text, comment=None):
+        self.line(f'        {text}', comment)
+
+
+PRODUCT_TEMPS = {('c', 0): 'zp_tm_clx', ('c', 1): 'zp_tm_clz',
+                 ('s', 0): 'zp_tm_slz', ('s', 1): 'zp_tm_slx'}
+
+
+def emit_vertex(e, n, vertex):
+    lx, ly, lz = vertex
+    e.line()
+    e.line(f'; Vertex {n}: ({lx}, {ly}, {lz})')
+    terms_x, terms_z = rotation_terms(lx, lz)
+
+    # Products, grouped by multiplier so X/Y are loaded once per group
+    temps = {}
+    for mult in 'cs':
+        wanted = [(out, t) for out, terms in enumerate([terms_x, terms_z])
+                  for t in terms if t[0] == mult]
+        if not wanted:
+            continue
+        e.op(f'ldx zp_cm_{mult}')
+        e.op(f'ldy zp_cm_{mult}n')
+        for out, (m, k, sub) in wanted:
+            temp = PRODUCT_TEMPS[(m, out)]
+            temps[(out, m)] = temp
+            offset = k + 128
+            e.op('sec')
+            e.op(f'lda smult_sq1_lo+{offset},x', f'{m} * {k}')
+            e.op(f'sbc smult_sq2_lo+{offset},y')
+            e.op(f'sta {temp}_lo')
+            e.op(f'lda smult_sq1_hi+{offset},x')
+            e.op(f'sbc smult_sq2_hi+{offset},y')
+            e.op(f'sta {temp}_hi')
+
+    def emit_sum(out, terms):
+        """A = (sum of the terms) >> 7"""
+        if not terms:
+            e.op('lda #0')
+            return
+        if len(terms) == 1 and not terms[0][2]:
+            temp = temps[(out, terms[0][0])]
+            e.op(f'lda {temp}_lo')
+            e.op('rol a', 'Bit 7 into carry')
+            e.op(f'lda {temp}_hi')
+            e.op('rol a')
+            return
+        first = terms[0][0] if len(terms) == 2 else None
+        second = temps[(out, terms[-1][0])]
+        subtract = terms[-1][2]
+        e.op('sec' if subtract else 'clc')
+        e.op(f'lda {temps[(out, first)]}_lo' if first else 'lda #0')
+        e.op(f'{"sbc" if subtract else "adc"} {second}_lo')
+        e.op('tax')
+        e.op(f'lda {temps[(out, first)]}_hi' if first else 'lda #0')
+        e.op(f'{"sbc" if subtract else "adc"} {second}_hi')
+        e.op('cpx #$80', 'Bit 7 of the low byte into carry')
+        e.op('rol a')
+
+    def emit_extend_add(lo, hi, dest):
+        """dest = A (s8) + lo/hi (s16)"""
+        e.op('ldx #0')
+        e.op('cmp #$80')
+        e.op('bcc +')
+        e.op('dex', 'X = sign extension')
+        e.line('+       clc')
+        e.op(f'adc {lo}')
+        e.op(f'sta {dest}_lo')
+        e.op('txa')
+        e.op(f'adc {hi}')
+
+    e.line('        ; rot_z, for sorting')
+    emit_sum(1, terms_z)
+    e.op('sta zp_tm_rot_z')
+    e.op('eor #SORT_XOR')
+    e.op(f'sta mesh_rot_z+{n}')
+
+    e.line('        ; world_x = rot_x + px, straight into the multiply input')
+    emit_sum(0, terms_x)
+    emit_extend_add('zp_mesh_px_lo', 'zp_mesh_px_hi', 'zp_mul16')
+    e.op('sta zp_mul16_hi')
+
+    e.line('        ; world_z = rot_z + pz: fail if negative, or z8 < 17 (also z = 0)')
+    e.op('lda zp_tm_rot_z')
+    emit_extend_add('zp_mesh_pz_lo', 'zp_mesh_pz_hi', 'zp_world_z')
+    e.op('bpl +')
+    e.op('jmp _cm_fail')
+    e.line('+       lsr a', 'Carry = bit 0 of the high byte')
+    e.op('lda zp_world_z_lo')
+    e.op('ror a', 'z8 = world_z >> 1')
+    e.op('cmp #17')
+    e.op('bcs +')
+    e.op('jmp _cm_fail')
+    e.line('+       tax')
+    e.op('ldy recip_persp,x')
+    e.op('sty zp_recip')
+
+    e.line('        ; screen_x = 40 + highbyte(world_x * recip)')
+    e.op('#mul16s_8u_hi_m')
+    e.op('clc')
+    e.op('adc #40')
+    e.op(f'sta screen_x+{n}')
+    e.line('.if DIRTY_CLEAR')
+    e.op('#track_bound_m zp_bnd_xmin, zp_bnd_xmax')
+    e.line('.endif')
+
+    e.line('        ; screen_y = 25 - highbyte(world_y * recip), world_y = ly + py')
+    e.op('clc')
+    e.op(f'lda #<({ly})')
+    e.op('adc zp_mesh_py_lo')
+    e.op('sta zp_mul16_lo')
+    e.op(f'lda #>({ly})')
+    e.op('adc zp_mesh_py_hi')
+    e.op('sta zp_mul16_hi')
+    e.op('ldy zp_recip')
+    e.op('#mul16s_8u_hi_m')
+    e.op('eor #$ff')
+    e.op('sec')
+    e.op('adc #25')
+    e.op(f'sta screen_y+{n}')
+    e.line('.if DIRTY_CLEAR')
+    e.op('#track_bound_m zp_bnd_ymin, zp_bnd_ymax')
+    e.line('.endif')
+
+
+def compile_mesh(name, vertices, output_path):
+    check_folding(vertices)
+    with open(output_path, 'w') as out:
+        e = Emitter(out)
+        e.line(f'; {output_path.split("/")[-1]} - Compiled transform_mesh for the {name} mesh')
+        e.line('; Generated by c/compile_mesh.py, do not edit.')
+        e.line(';')
+        e.line(f'; {len(vertices)} vertices folded into straight-line code. Same results as')
+        e.line('; transform_mesh in mesh.asm: screen_x/screen_y, mesh_rot_z, the')
+        e.line('; zp_bnd_* bounds with DIRTY_CLEAR, and')
+        e.line('; A = 0, or A = $ff if a vertex is behind or too close to the camera.')
+        e.line('; mesh_vx/vy/vz and zp_mesh_num_verts are not read.')
+        e.line()
+        e.line('; Quarter-square table offsets, set once per call')
+        e.line('zp_cm_c         = zp_mesh_c     ; cos + 128')
+        e.line('zp_cm_cn        = zp_tm_lx      ; ~(cos + 128)')
+        e.line('zp_cm_s         = zp_mesh_s     ; sin + 128')
+        e.line('zp_cm_sn        = zp_tm_lz      ; ~(sin + 128)')
+        e.line()
+        e.line('transform_mesh')
+        e.line('.if DIRTY_CLEAR')
+        e.op('#reset_bounds_m')
+        e.line('.endif')
+        e.op('ldx mesh_theta')
+        e.op('lda rcos,x')
+        e.op('eor #$80')
+        e.op('sta zp_cm_c')
+        e.op('eor #$ff')
+        e.op('sta zp_cm_cn')
+        e.op('lda rsin,x')
+        e.op('eor #$80')
+        e.op('sta zp_cm_s')
+        e.op('eor #$ff')
+        e.op('sta zp_cm_sn')
+        for n, vertex in enumerate(vertices):
+            emit_vertex(e, n, vertex)
+        e.line()
+        e.op('lda #0', 'All vertices done')
+        e.op('rts')
+        e.line()
+        e.line('_cm_fail')
+        e.op('lda #$ff')
+        e.op('rts')
+    print(f'Compiled {len(vertices)} vertices of {name} to {output_path}')
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 2 and args[0] == 'octahedron':
+        compile_mesh('octahedron', OCTAHEDRON, args[1])
+    elif len(args) == 4 and args[0] == '--data':
+        compile_mesh(args[2], load_vertices(args[1], args[2]), args[3])
+    else:
+        print(__doc__.strip().split('\n\n')[-1], file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,438 @@
+/* cost6502.c - Cycle cost model for the assembled draw_triangle
+ *
+ * Sweeps triangle shape classes (shape, height, width, start row parity,
+ * start column parity) through draw_triangle from rasterizer.asm on the
+ * sim6502 core, and fits cycles = a*calls + b*rows + c*stores + d*callees +
+ * e*storing calls per routine by least squares with non-negative terms.
+ * Each routine is fitted on its own work: calls are its calls per triangle,
+ * stores the screen bytes it stored itself, callees its calls to the
+ * routines it drives and storing calls those of its calls that stored
+ * anything; rows are the triangle's scanlines. The residuals show how far
+ * each fit can be trusted. chars in the tables are the screen bytes written
+ * (partial chars have only some of their 4 pixels covered).
+ *
+ * Mean cycles per class group can be saved as a baseline (-w) and checked
+ * against it (-c): a group slower than the baseline by more than the
+ * threshold (-t, percent) is a regression and the exit status is 1.
+ *
+ * Usage: ./cost6502 [-w baseline | -c baseline] [-t percent] program.prg labels.txt
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "asm_harness.h"
+#include "rasterize.h"
+
+#define MAX_GROUPS 32
+#define MAX_SAMPLES 1024
+
+/* Routines the model breaks cycles down by (self cycles each), and the
+ * index of the listed routine that calls each (-1 = the harness) */
+static const char *routine_names[] = {
+    "draw_triangle", "rasterize_trapezoid", "draw_dual_row_simple",
+    "draw_span_top", "draw_span_bottom"
+};
+static const int routine_caller[] = { -1, 0, 1, 1, 1 };
+#define NUM_ROUTINES (int)(sizeof(routine_names) / sizeof(routine_names[0]))
+
+static const char *shape_names[] = { "flat-top", "flat-bottom", "split" };
+static const int heights[] = { 1, 2, 3, 8, 9, 32 };
+static const int widths[] = { 1, 2, 3, 8, 9, 40 };
+#define NUM_SHAPES 3
+#define NUM_HEIGHTS (int)(sizeof(heights) / sizeof(heights[0]))
+#define NUM_WIDTHS (int)(sizeof(widths) / sizeof(widths[0]))
+
+typedef struct {
+    int rows, chars, partial;       /* Scanlines, bytes written, bytes part-covered */
+    int dual, single;               /* draw_dual_row_simple and single-row span calls */
+    double cycles;                  /* Including JSR and RTS */
+    double self[NUM_ROUTINES];
+    double calls[NUM_ROUTINES];
+    double stores[NUM_ROUTINES];    /* Screen stores made by the routine itself */
+    double storing[NUM_ROUTINES];   /* Calls that made at least one of them */
+    double total_stores;
+} Sample;
+
+/* Model terms: the routine's calls, rows, the routine's stores, the calls
+ * it makes to the listed routines, and its calls that stored anything
+ * (early exits on empty spans are much cheaper than the rest) */
+#define NUM_TERMS 5
+
+/* Screen stores per innermost active routine (JSR target), for one
+ * triangle, and the calls they came from */
+static uint32_t store_counts[65536];
+static uint32_t storing_calls[65536];
+static uint64_t last_store_call[65536];
+static uint32_t total_store_count;
+static uint16_t screen_base;
+
+static void count_store(Sim6502 *cpu, uint16_t addr, uint8_t value) {
+    (void)value;
+    if (addr < screen_base || addr >= screen_base + SCREEN_SIZE) return;
+    total_store_count++;
+    if (cpu->depth == 0) return;
+
+    uint16_t target = cpu->call_target[cpu->depth - 1];
+    uint64_t start = cpu->call_start[cpu->depth - 1];
+    store_counts[target]++;
+    if (last_store_call[target] != start + 1) storing_calls[target]++;
+    last_store_call[target] = start + 1;
+}
+
+typedef struct {
+    char name[32];
+    int count;
+    double rows, chars, partial, dual, single, cycles;
+} Group;
+
+static Sample samples[MAX_SAMPLES];
+static int num_samples;
+static Group groups[MAX_GROUPS];
+static int num_groups;
+
+static Group *find_group(const char *name) {
+    for (int n = 0; n < num_groups; n++) {
+        if (strcmp(groups[n].name, name) == 0) return &groups[n];
+    }
+    return NULL;
+}
+
+static void new_group(const char *name) {
+    if (num_groups < MAX_GROUPS) snprintf(groups[num_groups++].name, 32, "%s", name);
+}
+
+static void add_to_group(const char *name, const Sample *s) {
+    Group *g = find_group(name);
+    if (!g) return;
+    g->count++;
+    g->rows += s->rows;
+    g->chars += s->chars;
+    g->partial += s->partial;
+    g->dual += s->dual;
+    g->single += s->single;
+    g->cycles += s->cycles;
+}
+
+/* Vertices for a class, counter-clockwise so draw_triangle keeps it.
+ * Every class fits on screen: x0 <= 11, width <= 40, y0 <= 9, height <= 32. */
+static void class_triangle(int shape, int height, int width, int y_odd, int x_odd, int *v) {
+    int x0 = 10 + x_odd, y0 = 8 + y_odd;
+    switch (shape) {
+    case 0:     /* flat top */
+        v[0] = x0;             v[1] = y0;
+        v[2] = x0 + width;     v[3] = y0;
+        v[4] = x0 + width / 2; v[5] = y0 + height;
+        break;
+    case 1:     /* flat bottom */
+        v[0] = x0 + width / 2; v[1] = y0;
+        v[2] = x0 + width;     v[3] = y0 + height;
+        v[4] = x0;             v[5] = y0 + height;
+        break;
+    default:    /* middle vertex splits it into two trapezoids */
+        v[0] = x0;             v[1] = y0;
+        v[2] = x0 + width;     v[3] = y0 + height / 2;
+        v[4] = x0 + width / 4; v[5] = y0 + height;
+        break;
+    }
+}
+
+static int measure(AsmHarness *h, SimProfile *profile, const int *addr, const int *v,
+                   Sample *s) {
+    unsigned char screen[SCREEN_SIZE];
+    int top = v[1], bottom = v[1];
+
+    clear_screen(screen, 0);
+    memset(profile, 0, sizeof(*profile));
+    memset(store_counts, 0, sizeof(store_counts));
+    memset(storing_calls, 0, sizeof(storing_calls));
+    memset(last_store_call, 0, sizeof(last_store_call));
+    total_store_count = 0;
+    screen_base = (uint16_t)(h->cpu.mem[h->buf_draw] << 8);
+    int64_t cycles = asm_draw_triangle(h, screen, v[0], v[1], v[2], v[3], v[4], v[5], 3);
+    if (cycles < 0) return -1;
+
+    for (int c = 3; c < 6; c += 2) {
+        if (v[c] < top) top = v[c];
+        if (v[c] > bottom) bottom = v[c];
+    }
+    memset(s, 0, sizeof(*s));
+    s->rows = bottom - top;
+    for (int b = 0; b < SCREEN_SIZE; b++) {
+        if (screen[b]) s->chars++;
+        if (screen[b] && screen[b] != 0xff) s->partial++;
+    }
+    s->cycles = (double)cycles;
+    for (int r = 0; r < NUM_ROUTINES; r++) {
+        if (addr[r] >= 0) s->self[r] = (double)profile->self[addr[r]];
+        if (addr[r] >= 0) s->calls[r] = profile->calls[addr[r]];
+        if (addr[r] >= 0) s->stores[r] = store_counts[addr[r]];
+        if (addr[r] >= 0) s->storing[r] = storing_calls[addr[r]];
+    }
+    s->total_stores = total_store_count;
+    if (addr[2] >= 0) s->dual = profile->calls[addr[2]];
+    for (int r = 3; r < 5; r++) {
+        if (addr[r] >= 0) s->single += profile->calls[addr[r]];
+    }
+    return 0;
+}
+
+/* Unconstrained least squares over the terms in mask (normal equations,
+ * Gaussian elimination); unused terms get 0. Returns the sum of squared
+ * residuals, or -1 if the system is singular. */
+static double fit_terms(double x[][NUM_TERMS], const double *y, int mask, double *coef) {
+    double m[NUM_TERMS][NUM_TERMS + 1] = {{0}};
+    int idx[NUM_TERMS], k = 0;
+
+    for (int t = 0; t < NUM_TERMS; t++) {
+        coef[t] = 0.0;
+        if (mask & (1 << t)) idx[k++] = t;
+    }
+    for (int n = 0; n < num_samples; n++) {
+        for (int i = 0; i < k; i++) {
+            for (int j = 0; j < k; j++) m[i][j] += x[n][idx[i]] * x[n][idx[j]];
+            m[i][k] += x[n][idx[i]] * y[n];
+        }
+    }
+    for (int i = 0; i < k; i++) {
+        int pivot = i;
+        for (int r = i + 1; r < k; r++) {
+            if (fabs(m[r][i]) > fabs(m[pivot][i])) pivot = r;
+        }
+        for (int c = 0; c <= k; c++) {
+            double t = m[i][c]; m[i][c] = m[pivot][c]; m[pivot][c] = t;
+        }
+        if (fabs(m[i][i]) < 1e-9) return -1.0;
+        for (int r = 0; r < k; r++) {
+            if (r == i) continue;
+            double f = m[r][i] / m[i][i];
+            for (int c = i; c <= k; c++) m[r][c] -= f * m[i][c];
+        }
+    }
+    for (int i = 0; i < k; i++) coef[idx[i]] = m[i][k] / m[i][i];
+
+    double sse = 0.0;
+    for (int n = 0; n < num_samples; n++) {
+        double e = y[n];
+        for (int t = 0; t < NUM_TERMS; t++) e -= coef[t] * x[n][t];
+        sse += e * e;
+    }
+    return sse;
+}
+
+/* Least squares with non-negative coefficients: the best fit over all
+ * subsets of terms whose unconstrained solution has no negative term (few
+ * terms, so trying them all is exact). Sets the RMS and largest residual. */
+static void fit(double x[][NUM_TERMS], const double *y, double *coef,
+                double *rms, double *worst) {
+    double best = -1.0, c[NUM_TERMS];
+
+    for (int t = 0; t < NUM_TERMS; t++) coef[t] = 0.0;
+    for (int mask = 1; mask < 1 << NUM_TERMS; mask++) {
+        double sse = fit_terms(x, y, mask, c);
+        int ok = sse >= 0.0;
+        for (int t = 0; t < NUM_TERMS; t++) {
+            if (c[t] < 0.0) ok = 0;
+        }
+        if (ok && (best < 0.0 || sse < best)) {
+            best = sse;
+            memcpy(coef, c, sizeof(c));
+        }
+    }
+
+    *worst = 0.0;
+    double sse = 0.0;
+    for (int n = 0; n < num_samples; n++) {
+        double e = y[n];
+        for (int t = 0; t < NUM_TERMS; t++) e -= coef[t] * x[n][t];
+        sse += e * e;
+        if (fabs(e) > *worst) *worst = fabs(e);
+    }
+    *rms = sqrt(sse / num_samples);
+}
+
+static int write_baseline(const char *path, const char *prg) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return -1;
+    }
+    fprintf(f, "# Mean draw_triangle cycles per shape class group, from\n");
+    fprintf(f, "# ./cost6502 -w %s %s\n", path, prg);
+    for (int n = 0; n < num_groups; n++) fprintf(f, "%s %.1f\n", groups[n].name,
+                                                 groups[n].cycles / groups[n].count);
+    fclose(f);
+    printf("\nBaseline written to %s\n", path);
+    return 0;
+}
+
+/* Returns the number of regressed groups, or -1 if the file is unreadable */
+static int check_baseline(const char *path, double threshold) {
+    FILE *f = fopen(path, "r");
+    char line[128];
+    int regressions = 0;
+
+    if (!f) {
+        fprintf(stderr, "Cannot read baseline %s\n", path);
+        return -1;
+    }
+    printf("\nAgainst %s (threshold %.1f%%):\n", path, threshold);
+    printf("%-18s %10s %10s %8s\n", "group", "baseline", "now", "change");
+    while (fgets(line, sizeof(line), f)) {
+        char name[32];
+        double base;
+        if (line[0] == '#' || sscanf(line, "%31s %lf", name, &base) != 2) continue;
+
+        const Group *g = find_group(name);
+        if (!g || g->count == 0) {
+            printf("%-18s %10.1f %10s\n", name, base, "missing");
+            continue;
+        }
+        double now = g->cycles / g->count;
+        double change = base > 0.0 ? 100.0 * (now - base) / base : 0.0;
+        if (fabs(change) < 0.05) change = 0.0;      /* Rounding in the file */
+        const char *flag = "";
+        if (change > threshold) {
+            flag = "  REGRESSION";
+            regressions++;
+        } else if (change < -threshold) {
+            flag = "  faster";
+        }
+        printf("%-18s %10.1f %10.1f %+7.1f%%%s\n", name, base, now, change, flag);
+    }
+    fclose(f);
+    return regressions;
+}
+
+int main(int argc, char **argv) {
+    const char *write_path = NULL, *check_path = NULL;
+    double threshold = 1.0;
+    int arg = 1;
+
+    while (arg + 1 < argc && argv[arg][0] == '-') {
+        if (strcmp(argv[arg], "-w") == 0) write_path = argv[arg + 1];
+        else if (strcmp(argv[arg], "-c") == 0) check_path = argv[arg + 1];
+        else if (strcmp(argv[arg], "-t") == 0) threshold = atof(argv[arg + 1]);
+        else break;
+        arg += 2;
+    }
+    if (argc - arg != 2 || (write_path && check_path)) {
+        fprintf(stderr, "Usage: %s [-w baseline | -c baseline] [-t percent] "
+                "program.prg labels.txt\n", argv[0]);
+        return 1;
+    }
+    const char *prg = argv[arg], *label_path = argv[arg + 1];
+
+    static AsmHarness h;
+    SimProfile *profile = calloc(1, sizeof(SimProfile));
+    if (!profile) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    if (asm_harness_open(&h, prg, label_path) < 0) return 1;
+    h.cpu.profile = profile;
+    h.cpu.on_write = count_store;
+
+    int addr[NUM_ROUTINES];
+    for (int r = 0; r < NUM_ROUTINES; r++) addr[r] = sim_label_value(&h.labels, routine_names[r]);
+
+    /* Groups: all classes, then one per value of each axis */
+    char name[32];
+    new_group("total");
+    for (int shape = 0; shape < NUM_SHAPES; shape++) {
+        snprintf(name, sizeof(name), "shape=%s", shape_names[shape]);
+        new_group(name);
+    }
+    for (int hi = 0; hi < NUM_HEIGHTS; hi++) {
+        snprintf(name, sizeof(name), "height=%d", heights[hi]);
+        new_group(name);
+    }
+    for (int wi = 0; wi < NUM_WIDTHS; wi++) {
+        snprintf(name, sizeof(name), "width=%d", widths[wi]);
+        new_group(name);
+    }
+    new_group("y0=even");
+    new_group("y0=odd");
+    new_group("x0=even");
+    new_group("x0=odd");
+
+    /* Sweep every class; each sample counts toward its group on each axis */
+    for (int shape = 0; shape < NUM_SHAPES; shape++)
+    for (int hi = 0; hi < NUM_HEIGHTS; hi++)
+    for (int wi = 0; wi < NUM_WIDTHS; wi++)
+    for (int y_odd = 0; y_odd < 2; y_odd++)
+    for (int x_odd = 0; x_odd < 2; x_odd++) {
+        Sample *s = &samples[num_samples];
+        int v[6];
+
+        class_triangle(shape, heights[hi], widths[wi], y_odd, x_odd, v);
+        if (measure(&h, profile, addr, v, s) < 0) {
+            fprintf(stderr, "%s: draw_triangle did not return (PC=$%04x)\n", prg, h.cpu.pc);
+            return 1;
+        }
+        num_samples++;
+
+        add_to_group("total", s);
+        snprintf(name, sizeof(name), "shape=%s", shape_names[shape]);
+        add_to_group(name, s);
+        snprintf(name, sizeof(name), "height=%d", heights[hi]);
+        add_to_group(name, s);
+        snprintf(name, sizeof(name), "width=%d", widths[wi]);
+        add_to_group(name, s);
+        add_to_group(y_odd ? "y0=odd" : "y0=even", s);
+        add_to_group(x_odd ? "x0=odd" : "x0=even", s);
+    }
+
+    printf("%s: draw_triangle over %d shape classes\n\n", prg, num_samples);
+    printf("%-18s %6s %7s %7s %8s %6s %7s %10s\n", "group", "tris", "rows", "chars",
+           "partial", "dual", "single", "cycles");
+    for (int n = 0; n < num_groups; n++) {
+        const Group *g = &groups[n];
+        double c = g->count;
+        printf("%-18s %6d %7.1f %7.1f %8.1f %6.1f %7.1f %10.1f\n", g->name, g->count,
+               g->rows / c, g->chars / c, g->partial / c, g->dual / c, g->single / c,
+               g->cycles / c);
+    }
+
+    /* Cost model per routine, then in total (one call per triangle) */
+    static double y[MAX_SAMPLES], x[MAX_SAMPLES][NUM_TERMS];
+    double coef[NUM_TERMS], rms, worst;
+    printf("\ncycles = a*calls + b*rows + c*stores + d*callees + e*storing calls\n"
+           "(least squares, terms >= 0)\n");
+    printf("%-22s %7s %7s %7s %7s %7s %7s %7s %7s\n", "routine", "a", "b", "c", "d", "e",
+           "mean", "rms err", "max err");
+    for (int r = 0; r <= NUM_ROUTINES; r++) {
+        const char *name = r < NUM_ROUTINES ? routine_names[r] : "total";
+        double mean = 0.0;
+        if (r < NUM_ROUTINES && addr[r] < 0) continue;
+        for (int n = 0; n < num_samples; n++) {
+            y[n] = r < NUM_ROUTINES ? samples[n].self[r] : samples[n].cycles;
+            x[n][0] = r < NUM_ROUTINES ? samples[n].calls[r] : 1.0;
+            x[n][1] = samples[n].rows;
+            x[n][2] = r < NUM_ROUTINES ? samples[n].stores[r] : samples[n].total_stores;
+            x[n][3] = 0.0;
+            x[n][4] = 0.0;
+            for (int c = 0; c < NUM_ROUTINES; c++) {
+                if (r == NUM_ROUTINES ? c > 0 : routine_caller[c] == r) x[n][3] += samples[n].calls[c];
+                if (r == NUM_ROUTINES || c == r) x[n][4] += samples[n].storing[c];
+            }
+            mean += y[n] / num_samples;
+        }
+        fit(x, y, coef, &rms, &worst);
+        printf("%-22s %7.1f %7.2f %7.2f %7.1f %7.1f %7.1f %7.1f %7.1f\n", name, coef[0],
+               coef[1], coef[2], coef[3], coef[4], mean, rms, worst);
+    }
+
+    int status = 0;
+    if (write_path && write_baseline(write_path, prg) < 0) status = 1;
+    if (check_path) {
+        int regressions = check_baseline(check_path, threshold);
+        if (regressions != 0) status = 1;
+        if (regressions > 0) printf("%d group(s) regressed\n", regressions);
+    }
+
+    free(profile);
+    asm_harness_close(&h);
+    return status;
+}
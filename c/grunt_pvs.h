@@ -0,0 +1,198 @@
+// Generated by bake_animation.py: the grunt's potentially visible sets
+// (16 sectors) and the 48 frames they were built from
+
+#define GRUNT_PVS_FRAMES 48
+#define GRUNT_PVS_PLAYED 24   // Baked frames; the rest are keyframe blends
+#define GRUNT_PVS_VERTICES 151
+#define GRUNT_PVS_FACES 295
+#define GRUNT_PVS_FACES_0 147   // Faces in sub-mesh 0
+#define GRUNT_PVS_SECTOR_SHIFT 4
+#define GRUNT_PVS_SET_BYTES 37
+
+static const int16_t grunt_pvs_lo[3] = { -8, -8, 192 };
+static const int16_t grunt_pvs_hi[3] = { 8, 8, 512 };
+
+static int8_t grunt_pvs_vx[GRUNT_PVS_FRAMES][GRUNT_PVS_VERTICES] = {
+    { -14, -16, -18, -15, -14, -15, -19, -18, -17, -23, -19, -21, 8, -11, -10, 5, -14, -14, -16, -14, -24, -20, -18, -13, -21, -4, -16, -22, -3, -16, -16, -11, -17, -12, -11, -7, -8, -5, -3, -7, -14, -5, 20, 28, 26, 28, 32, 41, 48, 38, 46, 36, 16, 12, 4, 54, 50, 36, 38, 1, -1, 14, 2, 11, -9, -6, 12, 16, -3, -4, 7, 8, 9, -5, -7, 4, 17, 12, -3, 5, 19, 0, 12, -8, 3, 11, 22, 13, 26, -1, 1, 24, 29, 20, 4, 8, 8, 7, 20, 21, 14, 36, 39, 40, 27, 27, 9, 6, -3, -12, 10, 11, 19, 17, 18, 18, 30, 36, -3, 0, 2, 21, 5, 34, 39, 18, -1, 0, -16, -35, -35, -26, -26, 17, 11, 2, 12, 23, -1, 14, 34, 2, -2, 6, -4, 15, -8, 3, 22, 18, 0 },
+    { -10, -13, -15, -11, -12, -13, -15, -14, -14, -20, -16, -19, 7, -12, -11, 3, -14, -16, -18, -15, -25, -21, -19, -10, -20, -3, -17, -23, -4, -17, -16, 0, -5, -1, 0, 2, 0, 6, 6, 4, -3, 5, 20, 29, 26, 29, 34, 41, 48, 38, 47, 36, 23, 18, 10, 55, 52, 38, 40, 8, -3, 12, 1, 9, -10, -7, 10, 14, -5, -5, 6, 7, 9, -5, -7, 5, 17, 11, -4, 5, 18, 0, 12, -8, 2, 9, 20, 11, 24, -3, 0, 22, 27, 19, 4, 8, 6, 5, 18, 20, 12, 35, 38, 38, 26, 25, 9, 5, -3, -13, 10, 11, 18, 16, 17, 17, 29, 35, -4, -1, 1, 20, 4, 33, 38, 16, -2, -1, -17, -36, -36, -27, -27, 16, 10, 1, 12, 22, -2, 13, 33, 1, -3, 5, -4, 14, -9, 2, 21, 18, 0 },
+    { 2, 0, -3, 4, 0, -2, 0, 1, -2, -7, -1, -6, 7, -11, -8, 1, -16, -15, -19, -13, -26, -19, -17, 0, -12, 4, -16, -25, -3, -18, -9, 10, 4, 8, 11, 12, 10, 16, 16, 14, 6, 13, 27, 35, 30, 37, 41, 46, 55, 43, 54, 39, 33, 26, 19, 63, 60, 47, 49, 16, 0, 15, 5, 13, -6, -3, 14, 18, -1, -2, 9, 10, 13, -2, -4, 8, 20, 14, 0, 9, 22, 3, 15, -5, 5, 10, 20, 11, 24, -3, 0, 21, 27, 18, 7, 10, 6, 5, 18, 20, 13, 35, 38, 39, 26, 26, 12, 8, 0, -10, 13, 14, 20, 18, 19, 19, 31, 37, -1, 0, 3, 23, 7, 35, 40, 19, 0, 1, -15, -34, -33, -25, -25, 18, 14, 3, 14, 25, 0, 17, 40, 5, 0, 8, -1, 17, -6, 5, 23, 20, 2 },
+    { 17, 14, 11, 20, 11, 9, 14, 18, 11, 8, 14, 7, 3, -17, -13, -3, -24, -10, -18, -9, -28, -19, -16, 9, -3, 11, -15, -30, -4, -24, -2, 17, 11, 14, 18, 18, 16, 23, 23, 20, 13, 19, 30, 38, 35, 40, 42, 51, 58, 48, 56, 45, 38, 30, 24, 65, 61, 49, 50, 21, 5, 21, 10, 20, -1, 4, 23, 23, 5, 7, 19, 18, 10, -4, -7, 3, 17, 11, -3, 17, 28, 9, 18, 0, 10, 10, 20, 10, 23, -4, 0, 21, 27, 18, 11, 11, 6, 5, 16, 20, 13, 35, 39, 39, 27, 26, 17, 11, 6, -5, 18, 20, 22, 21, 21, 22, 34, 39, 0, 2, 5, 24, 12, 37, 42, 20, 1, 2, -13, -32, -32, -23, -23, 20, 15, 4, 15, 26, -8, 15, 41, 11, 13, 14, 2, 23, -2, 14, 31, 24, 4 },
+    { 28, 24, 21, 32, 19, 18, 26, 30, 20, 19, 26, 17, -6, -28, -24, -12, -35, -10, -18, -10, -32, -22, -20, 14, 1, 14, -15, -33, -7, -30, 1, 17, 11, 14, 18, 17, 15, 23, 22, 20, 13, 18, 27, 33, 31, 37, 38, 45, 54, 41, 51, 39, 36, 28, 23, 63, 57, 48, 47, 18, 5, 20, 5, 14, 0, 1, 20, 25, 7, 6, 18, 19, 19, 3, 0, 12, 24, 17, 2, 17, 26, 7, 14, -1, 7, 5, 15, 5, 18, -9, -5, 16, 22, 13, 8, 5, 1, 0, 11, 15, 8, 31, 34, 35, 22, 22, 15, 7, 5, -7, 15, 19, 17, 16, 16, 16, 29, 34, -5, -3, 0, 19, 10, 32, 37, 14, -4, -2, -19, -37, -37, -29, -29, 15, 3, -1, 9, 20, -22, 4, 33, 10, 15, 12, 0, 21, -4, 14, 30, 19, 0 },
+    { 30, 28, 24, 36, 19, 19, 30, 35, 22, 24, 30, 20, -19, -41, -38, -25, -47, -21, -29, -22, -43, -35, -33, 12, 0, 9, -23, -43, -16, -39, -1, -2, -9, -6, -2, -1, -3, 3, 2, -1, -7, -1, 16, 31, 26, 27, 39, 27, 40, 23, 45, 28, 21, 11, 8, 51, 54, 40, 45, 2, -5, 7, -8, 0, -5, -12, 6, 15, 0, -6, 5, 10, 22, 9, 3, 16, 24, 14, 0, 5, 15, -4, 3, -11, -3, -3, 6, -3, 10, -17, -13, 7, 13, 4, -1, -3, -7, -8, 3, 6, 0, 22, 25, 25, 13, 12, 3, -3, -5, -18, 4, 8, 10, 8, 9, 9, 21, 27, -13, -10, -7, 9, 0, 25, 30, 8, -11, -10, -27, -45, -45, -37, -37, 5, -8, -11, 0, 10, -37, -5, 18, -1, 0, 0, -11, 9, -18, 0, 20, 9, -10 },
+    { 21, 19, 15, 26, 12, 11, 19, 24, 13, 13, 20, 10, -23, -41, -34, -29, -50, -24, -33, -24, -46, -34, -32, 5, -7, 4, -30, -49, -21, -45, -7, -31, -39, -33, -34, -25, -27, -26, -22, -31, -37, -26, 26, 32, 26, 39, 41, 36, 50, 33, 49, 31, 7, -2, -2, 63, 59, 49, 50, -10, -8, 6, -4, 4, -11, -12, 6, 11, -5, -8, 3, 6, 13, -1, -7, 4, 16, 6, -8, 5, 17, -4, 5, -9, -1, 0, 10, 1, 14, -13, -9, 12, 17, 9, 2, 0, -3, -4, 8, 10, 3, 25, 29, 29, 17, 16, 4, -2, -5, -17, 5, 8, 16, 15, 16, 16, 28, 34, -6, -3, 0, 11, 0, 31, 37, 16, -5, -4, -21, -39, -39, -31, -31, 8, 1, -7, 3, 14, -37, 2, 31, -1, -4, 0, -11, 8, -24, -1, 20, 10, -8 },
+    { 30, 29, 25, 32, 23, 23, 25, 30, 22, 20, 28, 19, -4, -19, -9, -12, -30, -9, -21, -7, -29, -14, -10, 14, 3, 19, -20, -35, -6, -29, 6, -23, -30, -23, -26, -15, -16, -18, -12, -22, -28, -15, 47, 45, 42, 58, 51, 60, 69, 57, 62, 50, 18, 11, 10, 79, 69, 63, 60, 3, 12, 28, 19, 28, 2, 11, 29, 26, 8, 12, 24, 19, 7, -6, -6, 2, 15, 14, 1, 28, 39, 14, 24, 13, 17, 15, 25, 15, 28, 0, 4, 25, 32, 23, 24, 17, 11, 9, 21, 25, 17, 40, 43, 44, 31, 31, 22, 15, 11, -1, 24, 24, 40, 38, 40, 40, 51, 59, 19, 22, 24, 27, 14, 55, 61, 42, 19, 20, 3, -15, -15, -7, -7, 24, 26, 9, 20, 31, -15, 26, 56, 17, 16, 18, 8, 27, -8, 18, 40, 28, 10 },
+    { -42, -45, -47, -42, -41, -44, -45, -45, -43, -51, -48, -49, -22, -32, -25, -31, -42, -34, -45, -29, -48, -33, -30, -36, -47, -30, -51, -57, -39, -52, -44, 42, 43, 45, 47, 42, 42, 48, 45, 52, 46, 49, 30, 40, 32, 44, 50, 34, 50, 32, 53, 34, 47, 50, 36, 65, 65, 60, 63, 40, 0, 15, 1, 10, -8, -5, 13, 16, -3, -2, 10, 9, 8, -7, -7, 4, 16, 13, -2, 8, 20, -4, 4, -5, -2, -9, 0, -10, 2, -25, -20, 0, 6, -2, 5, -2, -14, -15, -4, 0, -6, 16, 19, 19, 7, 6, 4, -4, -9, -22, 3, 2, 18, 16, 19, 19, 30, 37, -1, 1, 4, 6, -7, 33, 39, 20, 0, 2, -15, -35, -34, -26, -26, 4, 3, -11, 0, 11, -25, 2, 26, -1, 2, 1, -9, 9, -20, 1, 20, 9, -9 },
+    { -70, -74, -74, -74, -65, -68, -74, -76, -68, -78, -77, -74, -18, -34, -28, -26, -44, -31, -41, -28, -48, -35, -32, -54, -62, -47, -51, -57, -43, -53, -59, 58, 62, 61, 64, 55, 55, 62, 57, 67, 65, 62, 12, 31, 25, 22, 38, 25, 37, 22, 44, 29, 48, 53, 39, 47, 51, 40, 46, 46, -4, 11, -1, 7, -11, -8, 10, 14, -5, -5, 7, 7, 8, -7, -10, 2, 15, 9, -6, 4, 17, -6, 2, -8, -3, -13, -3, -14, -1, -29, -24, -4, 2, -6, 3, -3, -18, -20, -9, -2, -9, 13, 16, 16, 3, 3, 4, -6, -6, -21, 2, 4, 9, 7, 8, 9, 20, 26, -13, -10, -7, 3, -8, 24, 29, 8, -12, -10, -27, -46, -46, -38, -38, 2, 0, -13, -1, 9, -24, 0, 11, -2, 0, -1, -11, 7, -19, -1, 13, 7, -11 },
+    { -68, -74, -74, -70, -64, -68, -69, -71, -66, -75, -75, -71, -22, -34, -27, -31, -45, -31, -43, -27, -48, -34, -30, -50, -60, -48, -53, -59, -47, -57, -61, 63, 65, 64, 69, 59, 59, 68, 62, 72, 68, 66, 17, 35, 28, 29, 43, 29, 42, 26, 48, 32, 54, 57, 44, 53, 57, 46, 52, 49, -2, 12, 0, 9, -7, -6, 12, 16, -1, -2, 9, 11, 13, -2, -6, 5, 18, 10, -5, 6, 19, -4, 4, -6, -1, -10, 0, -11, 1, -26, -21, 0, 6, -3, 5, -1, -15, -17, -6, 0, -6, 16, 19, 19, 7, 6, 6, -5, -3, -18, 4, 6, 11, 10, 10, 11, 22, 28, -11, -8, -5, 4, -5, 26, 32, 10, -10, -8, -25, -44, -44, -36, -36, 3, 2, -12, 0, 10, -23, 1, 16, 0, 1, 1, -9, 9, -16, 0, 15, 9, -9 },
+    { -71, -77, -77, -73, -67, -71, -72, -74, -68, -77, -79, -73, -21, -33, -25, -31, -44, -31, -43, -27, -47, -33, -29, -52, -61, -50, -53, -59, -48, -57, -63, 66, 68, 66, 72, 62, 61, 72, 65, 74, 70, 67, 18, 36, 30, 28, 43, 29, 42, 28, 49, 33, 57, 58, 46, 52, 57, 46, 52, 50, -2, 13, 0, 9, -7, -6, 12, 17, -1, -3, 9, 11, 15, 0, -3, 9, 21, 13, -2, 7, 20, -3, 5, -5, 0, -8, 1, -9, 3, -24, -19, 1, 8, 0, 6, 0, -13, -14, -3, 3, -3, 19, 22, 22, 9, 9, 8, -3, -1, -16, 6, 8, 12, 11, 11, 12, 24, 30, -9, -7, -4, 5, -4, 27, 33, 11, -8, -7, -24, -43, -43, -34, -35, 4, 3, -11, 0, 12, -21, 2, 19, 1, 1, 2, -7, 10, -15, 1, 16, 10, -8 },
+    { -69, -75, -75, -72, -65, -69, -71, -73, -67, -76, -77, -72, -19, -32, -25, -28, -42, -31, -42, -27, -47, -33, -30, -51, -61, -48, -52, -57, -45, -54, -60, 66, 68, 66, 72, 62, 61, 72, 65, 74, 70, 67, 16, 34, 28, 26, 41, 29, 40, 27, 47, 32, 57, 57, 45, 51, 55, 43, 49, 49, -2, 12, 0, 9, -6, -6, 11, 17, 0, -3, 8, 11, 18, 2, -2, 10, 21, 13, -2, 6, 19, -4, 5, -6, -1, -9, 0, -9, 3, -24, -19, 2, 9, 0, 5, -1, -13, -15, -3, 4, -2, 20, 23, 23, 10, 10, 7, -4, -2, -17, 5, 7, 12, 10, 11, 11, 23, 29, -9, -6, -3, 5, -5, 26, 32, 11, -7, -5, -22, -42, -42, -33, -33, 4, 4, -11, 0, 11, -20, 2, 17, 0, 0, 2, -8, 10, -16, 0, 15, 10, -9 },
+    { -68, -73, -73, -71, -63, -66, -70, -73, -65, -75, -76, -71, -13, -26, -18, -21, -36, -26, -36, -22, -41, -28, -24, -49, -57, -44, -47, -51, -40, -48, -56, 68, 69, 68, 74, 64, 62, 74, 67, 75, 71, 69, 21, 39, 33, 32, 46, 34, 46, 32, 53, 37, 60, 60, 48, 57, 60, 49, 55, 51, 2, 18, 5, 14, -2, -2, 16, 21, 1, 0, 12, 13, 21, 6, 3, 17, 28, 21, 6, 10, 23, 0, 10, -2, 3, -2, 7, -3, 9, -18, -13, 8, 15, 5, 10, 3, -7, -8, 2, 9, 2, 25, 28, 28, 15, 15, 12, 0, 2, -12, 10, 12, 17, 15, 16, 17, 29, 35, -3, -1, 1, 9, 0, 32, 37, 17, -1, 0, -17, -36, -36, -28, -28, 9, 10, -6, 5, 17, -12, 9, 23, 5, 2, 6, -3, 14, -11, 3, 21, 15, -4 },
+    { -66, -70, -70, -70, -60, -63, -70, -72, -63, -73, -74, -68, -5, -20, -14, -13, -29, -22, -30, -18, -36, -24, -21, -48, -54, -41, -41, -44, -33, -40, -51, 70, 71, 70, 76, 66, 65, 76, 70, 78, 73, 71, 27, 42, 36, 39, 49, 40, 53, 37, 57, 40, 64, 63, 52, 65, 66, 57, 60, 54, 4, 19, 7, 16, 0, 0, 17, 23, 3, 1, 14, 15, 24, 8, 6, 20, 30, 23, 8, 13, 26, 3, 13, 0, 6, 0, 10, 0, 13, -14, -9, 12, 19, 9, 12, 6, -3, -4, 7, 13, 6, 29, 32, 32, 19, 19, 15, 3, 6, -9, 13, 15, 20, 18, 18, 19, 31, 37, -2, 0, 3, 12, 2, 34, 40, 18, 0, 0, -16, -35, -35, -27, -27, 11, 13, -3, 8, 20, -7, 12, 29, 8, 3, 9, 0, 17, -7, 5, 25, 17, -1 },
+    { -65, -68, -68, -69, -58, -61, -69, -71, -62, -72, -72, -67, -3, -18, -12, -10, -26, -20, -28, -17, -34, -22, -19, -46, -52, -39, -39, -41, -30, -37, -49, 66, 66, 65, 71, 62, 61, 72, 66, 73, 68, 67, 31, 44, 38, 43, 52, 42, 56, 39, 60, 42, 64, 61, 51, 69, 69, 61, 64, 52, 5, 21, 8, 17, 0, 0, 19, 24, 4, 2, 15, 16, 24, 8, 6, 20, 31, 24, 9, 13, 26, 4, 14, 0, 7, 4, 14, 4, 17, -10, -6, 14, 21, 12, 13, 8, 0, -1, 10, 15, 8, 30, 33, 33, 21, 20, 16, 5, 8, -7, 14, 17, 21, 19, 19, 20, 32, 38, -1, 0, 3, 14, 4, 35, 41, 19, 0, 0, -16, -34, -35, -26, -26, 13, 15, -1, 10, 21, -6, 14, 32, 9, 4, 10, 0, 19, -7, 7, 27, 19, 0 },
+    { -54, -56, -57, -58, -48, -50, -58, -60, -52, -61, -61, -57, 0, -16, -11, -6, -22, -18, -25, -15, -31, -21, -18, -39, -45, -31, -33, -36, -23, -31, -40, 65, 65, 65, 70, 61, 60, 71, 65, 72, 68, 67, 25, 44, 39, 35, 50, 40, 50, 38, 57, 43, 61, 60, 48, 59, 64, 51, 57, 51, 7, 22, 9, 19, 2, 1, 20, 26, 6, 4, 16, 18, 27, 11, 8, 22, 33, 25, 10, 13, 27, 5, 15, 0, 8, 7, 17, 7, 20, -7, -3, 18, 24, 15, 13, 9, 2, 1, 13, 18, 10, 33, 36, 36, 24, 24, 18, 6, 9, -6, 15, 18, 22, 20, 21, 21, 33, 39, 0, 2, 5, 15, 6, 36, 42, 20, 1, 2, -14, -33, -33, -24, -24, 14, 16, 0, 11, 23, -7, 15, 31, 10, 6, 12, 2, 20, -7, 8, 27, 21, 1 },
+    { -50, -53, -53, -53, -46, -48, -55, -56, -50, -58, -56, -55, -7, -25, -21, -13, -32, -23, -31, -20, -38, -28, -25, -40, -46, -31, -39, -44, -28, -39, -42, 62, 66, 65, 68, 59, 59, 67, 62, 72, 68, 66, 17, 38, 34, 24, 43, 30, 38, 29, 48, 37, 53, 58, 43, 45, 53, 39, 47, 50, 1, 17, 3, 13, -2, -2, 16, 22, 3, 1, 14, 16, 20, 5, 0, 13, 25, 17, 1, 12, 25, 3, 13, -1, 6, 0, 9, -1, 11, -16, -11, 9, 16, 6, 10, 7, -5, -6, 4, 10, 3, 25, 29, 29, 16, 16, 15, 4, 6, -8, 14, 17, 14, 13, 12, 13, 25, 30, -9, -7, -3, 15, 5, 29, 34, 11, -7, -6, -23, -41, -41, -33, -33, 13, 7, -1, 9, 21, -20, 8, 21, 8, 6, 9, -1, 17, -14, 7, 25, 18, 0 },
+    { -40, -43, -44, -42, -38, -40, -45, -45, -41, -49, -46, -46, -5, -23, -18, -12, -30, -22, -29, -20, -37, -27, -24, -32, -41, -25, -35, -42, -24, -37, -37, 56, 58, 58, 62, 54, 54, 62, 57, 66, 61, 61, 22, 38, 34, 31, 44, 38, 48, 35, 53, 39, 53, 56, 42, 56, 59, 46, 52, 47, 0, 16, 2, 11, -3, -4, 14, 20, 0, -1, 10, 12, 20, 5, 2, 16, 26, 19, 4, 11, 24, 4, 14, -3, 6, 3, 13, 3, 16, -11, -7, 13, 20, 11, 9, 8, 0, -2, 9, 13, 6, 29, 32, 32, 20, 19, 15, 6, 5, -8, 14, 18, 15, 14, 13, 14, 27, 31, -7, -5, -1, 19, 7, 30, 35, 12, -4, -3, -20, -38, -38, -30, -30, 16, 9, 0, 12, 23, -14, 11, 31, 8, 1, 9, -1, 18, -12, 5, 26, 19, 0 },
+    { -21, -25, -27, -21, -23, -25, -25, -23, -24, -31, -27, -29, -6, -25, -19, -13, -33, -21, -29, -19, -38, -27, -24, -19, -30, -14, -32, -42, -21, -37, -29, 30, 27, 29, 33, 30, 28, 37, 34, 36, 30, 34, 25, 33, 29, 35, 38, 44, 53, 41, 51, 37, 42, 38, 28, 61, 57, 47, 47, 28, -1, 14, 2, 11, -8, -5, 13, 17, -2, -3, 9, 9, 11, -4, -6, 6, 18, 12, -2, 7, 21, 2, 13, -6, 5, 8, 19, 9, 22, -5, -1, 20, 26, 17, 6, 8, 5, 4, 16, 18, 11, 34, 36, 37, 24, 24, 12, 6, 1, -10, 13, 15, 17, 16, 16, 16, 29, 34, -4, -2, 1, 20, 7, 32, 37, 15, -1, 0, -17, -36, -36, -27, -27, 17, 10, 1, 12, 23, -14, 13, 37, 5, 0, 8, -2, 17, -11, 5, 25, 19, 0 },
+    { 0, -4, -6, 2, -4, -7, -2, 0, -4, -9, -4, -9, -4, -21, -16, -12, -29, -22, -30, -19, -36, -25, -23, -4, -16, -2, -28, -39, -16, -33, -16, 6, 0, 2, 5, 7, 4, 11, 11, 6, 0, 6, 26, 30, 27, 35, 34, 46, 52, 43, 48, 37, 29, 18, 17, 60, 53, 44, 42, 10, 0, 15, 4, 13, -7, -3, 14, 17, -2, -2, 9, 10, 11, -4, -6, 5, 18, 13, -2, 8, 22, 3, 14, -6, 5, 10, 21, 11, 24, -3, 0, 22, 28, 19, 6, 9, 7, 6, 18, 20, 13, 35, 38, 39, 26, 26, 12, 8, 1, -9, 14, 16, 18, 16, 16, 17, 29, 35, -3, -1, 1, 22, 8, 33, 38, 16, -1, 0, -16, -35, -35, -26, -26, 18, 13, 2, 13, 24, -11, 15, 40, 5, 0, 9, -1, 18, -9, 5, 24, 20, 1 },
+    { 6, 3, 0, 7, 1, 0, 2, 5, 0, -3, 1, -3, 1, -16, -12, -4, -22, -17, -23, -15, -31, -22, -19, 0, -11, 4, -21, -32, -7, -24, -9, -9, -16, -12, -10, -5, -8, -3, -1, -7, -14, -5, 26, 28, 27, 34, 31, 47, 51, 44, 46, 38, 19, 11, 7, 57, 49, 39, 38, 2, 2, 18, 7, 16, -5, -1, 16, 20, 0, 0, 12, 12, 13, -1, -3, 9, 21, 16, 0, 12, 25, 6, 17, -3, 8, 11, 22, 12, 26, -1, 1, 23, 29, 20, 9, 11, 8, 7, 19, 22, 14, 37, 40, 41, 28, 27, 14, 10, 4, -6, 16, 19, 19, 18, 18, 18, 31, 36, -2, 0, 3, 24, 12, 34, 39, 17, 0, 1, -15, -33, -33, -25, -25, 20, 15, 4, 15, 26, -6, 18, 40, 8, 2, 11, 0, 20, -5, 7, 26, 22, 3 },
+    { 0, 0, -3, 0, -1, -2, -4, -2, -4, -8, -3, -8, 6, -14, -11, 1, -18, -13, -17, -12, -26, -20, -18, -4, -13, 3, -16, -25, -2, -18, -8, -13, -19, -13, -13, -8, -10, -7, -4, -8, -16, -6, 22, 27, 26, 29, 30, 44, 49, 41, 44, 37, 15, 11, 3, 53, 47, 35, 35, 1, 1, 17, 6, 14, -6, -2, 15, 19, 0, 0, 11, 11, 12, -3, -5, 7, 20, 14, 0, 11, 23, 4, 15, -4, 6, 11, 21, 12, 25, -2, 0, 23, 28, 20, 8, 10, 7, 6, 19, 21, 14, 36, 39, 40, 27, 27, 12, 9, 1, -8, 14, 16, 20, 18, 19, 19, 31, 37, -1, 0, 4, 24, 9, 35, 40, 18, 0, 1, -15, -33, -33, -25, -25, 19, 14, 4, 15, 25, -4, 17, 36, 6, 1, 9, -1, 18, -5, 6, 25, 21, 2 },
+    { -10, -12, -14, -11, -11, -12, -16, -14, -14, -20, -15, -18, 8, -12, -11, 5, -14, -13, -15, -13, -24, -20, -18, -11, -19, -2, -15, -22, -2, -16, -14, -10, -15, -10, -9, -5, -7, -3, -1, -5, -12, -3, 20, 28, 26, 28, 31, 42, 48, 39, 46, 36, 17, 13, 4, 53, 49, 35, 37, 3, 0, 15, 3, 12, -8, -5, 13, 17, -2, -3, 8, 9, 11, -4, -6, 6, 18, 13, -2, 7, 20, 2, 13, -7, 4, 11, 22, 13, 26, -1, 1, 23, 29, 20, 6, 9, 8, 7, 20, 21, 14, 36, 39, 40, 27, 27, 10, 7, -2, -11, 11, 12, 20, 19, 19, 20, 32, 38, -1, 0, 4, 22, 6, 35, 40, 19, 0, 1, -15, -34, -34, -25, -25, 17, 12, 3, 13, 24, -3, 15, 34, 3, -1, 7, -3, 16, -7, 4, 23, 19, 1 },
+    { -14, -16, -18, -15, -14, -15, -19, -18, -17, -23, -19, -21, 8, -11, -10, 5, -14, -14, -16, -14, -24, -20, -18, -13, -21, -4, -16, -22, -3, -16, -16, -11, -17, -12, -11, -7, -8, -5, -3, -7, -14, -5, 20, 28, 26, 28, 32, 41, 48, 38, 46, 36, 16, 12, 4, 54, 50, 36, 38, 1, -1, 14, 2, 11, -9, -6, 12, 16, -3, -4, 7, 8, 9, -5, -7, 4, 17, 12, -3, 5, 19, 0, 12, -8, 3, 11, 22, 13, 26, -1, 1, 24, 29, 20, 4, 8, 8, 7, 20, 21, 14, 36, 39, 40, 27, 27, 9, 6, -3, -12, 10, 11, 19, 17, 18, 18, 30, 36, -3, 0, 2, 21, 5, 34, 39, 18, -1, 0, -16, -35, -35, -26, -26, 17, 11, 2, 12, 23, -1, 14, 34, 2, -2, 6, -4, 15, -8, 3, 22, 18, 0 },
+    { -4, -6, -9, -4, -6, -7, -8, -6, -8, -13, -8, -12, 4, -16, -14, 0, -20, -13, -17, -13, -26, -21, -19, -7, -16, 0, -16, -25, -4, -20, -12, -4, -10, -6, -4, -1, -3, 2, 3, -1, -8, 0, 21, 29, 27, 30, 33, 42, 49, 38, 47, 36, 21, 16, 8, 56, 51, 39, 40, 5, 0, 15, 2, 11, -7, -5, 14, 18, -1, -2, 9, 10, 11, -3, -6, 6, 18, 13, -2, 8, 20, 1, 12, -7, 4, 9, 20, 11, 24, -3, -1, 22, 27, 18, 5, 7, 6, 5, 17, 19, 12, 34, 37, 38, 25, 25, 10, 6, -1, -11, 11, 13, 18, 16, 17, 17, 29, 35, -4, -1, 1, 20, 6, 33, 38, 17, -2, -1, -17, -36, -36, -27, -27, 16, 9, 1, 11, 22, -7, 11, 33, 4, 2, 7, -3, 16, -7, 5, 24, 18, 0 },
+    { 7, 4, 1, 8, 2, 1, 3, 6, 1, -2, 3, -2, 1, -20, -17, -4, -25, -12, -17, -12, -28, -21, -19, 0, -10, 5, -16, -28, -5, -23, -8, 3, -3, 1, 3, 5, 3, 9, 9, 6, -1, 6, 23, 30, 28, 32, 35, 43, 51, 39, 48, 37, 26, 20, 13, 58, 53, 42, 42, 9, 2, 17, 3, 12, -5, -3, 16, 20, 2, 1, 12, 13, 14, -1, -4, 8, 20, 14, -1, 11, 22, 3, 13, -5, 5, 8, 18, 9, 22, -5, -2, 20, 25, 16, 6, 6, 4, 3, 15, 18, 11, 33, 36, 37, 24, 24, 12, 6, 1, -10, 12, 15, 18, 16, 17, 17, 29, 35, -4, -2, 1, 20, 7, 33, 38, 16, -3, -1, -18, -36, -36, -28, -28, 16, 7, 0, 10, 21, -12, 9, 33, 6, 6, 9, -2, 18, -6, 8, 26, 18, 0 },
+    { 17, 14, 11, 20, 10, 9, 14, 18, 10, 8, 14, 7, -3, -24, -21, -8, -30, -11, -18, -11, -30, -22, -20, 7, -5, 9, -16, -31, -6, -27, -4, 10, 4, 7, 10, 11, 9, 16, 15, 13, 6, 12, 25, 31, 29, 34, 36, 44, 52, 40, 49, 38, 31, 24, 18, 60, 55, 45, 44, 13, 3, 18, 4, 13, -3, -1, 18, 22, 4, 3, 15, 16, 16, 1, -2, 10, 22, 15, 0, 14, 24, 5, 13, -3, 6, 6, 16, 7, 20, -7, -4, 18, 23, 14, 7, 5, 2, 1, 13, 16, 9, 32, 35, 36, 23, 23, 13, 6, 3, -9, 13, 17, 17, 16, 16, 16, 29, 34, -5, -3, 0, 19, 8, 32, 37, 15, -4, -2, -19, -37, -37, -29, -29, 15, 5, -1, 9, 20, -17, 6, 33, 8, 10, 10, -1, 19, -5, 11, 28, 18, 0 },
+    { 28, 24, 21, 32, 19, 18, 26, 30, 20, 19, 26, 17, -6, -28, -24, -12, -35, -10, -18, -10, -32, -22, -20, 14, 1, 14, -15, -33, -7, -30, 1, 17, 11, 14, 18, 17, 15, 23, 22, 20, 13, 18, 27, 33, 31, 37, 38, 45, 54, 41, 51, 39, 36, 28, 23, 63, 57, 48, 47, 18, 5, 20, 5, 14, 0, 1, 20, 25, 7, 6, 18, 19, 19, 3, 0, 12, 24, 17, 2, 17, 26, 7, 14, -1, 7, 5, 15, 5, 18, -9, -5, 16, 22, 13, 8, 5, 1, 0, 11, 15, 8, 31, 34, 35, 22, 22, 15, 7, 5, -7, 15, 19, 17, 16, 16, 16, 29, 34, -5, -3, 0, 19, 10, 32, 37, 14, -4, -2, -19, -37, -37, -29, -29, 15, 3, -1, 9, 20, -22, 4, 33, 10, 15, 12, 0, 21, -4, 14, 30, 19, 0 },
+    { 10, 6, 4, 13, 4, 2, 8, 11, 4, 1, 7, 0, -10, -29, -25, -17, -37, -16, -25, -15, -36, -25, -23, 1, -11, 3, -24, -39, -15, -36, -11, 23, 19, 21, 25, 23, 21, 29, 27, 28, 21, 25, 27, 34, 31, 38, 41, 42, 53, 38, 51, 37, 38, 33, 26, 63, 59, 51, 51, 23, 3, 18, 4, 13, -2, -1, 18, 22, 4, 4, 16, 16, 16, 0, -2, 10, 22, 16, 1, 14, 24, 4, 11, -2, 4, 1, 11, 1, 14, -13, -9, 12, 18, 9, 7, 3, -3, -4, 7, 11, 4, 27, 30, 31, 18, 18, 12, 4, 1, -11, 12, 14, 17, 16, 16, 16, 29, 34, -4, -2, 1, 15, 5, 32, 37, 15, -3, -1, -18, -37, -37, -29, -29, 12, 3, -4, 6, 17, -23, 3, 31, 7, 11, 9, -3, 18, -8, 10, 27, 16, -3 },
+    { -7, -11, -13, -5, -11, -13, -10, -8, -12, -16, -11, -16, -14, -30, -25, -22, -39, -22, -32, -20, -40, -28, -25, -11, -23, -8, -33, -45, -23, -41, -22, 29, 27, 29, 32, 29, 28, 35, 33, 36, 29, 33, 28, 36, 31, 40, 44, 39, 52, 36, 52, 36, 41, 39, 29, 64, 61, 54, 55, 29, 2, 17, 3, 12, -4, -2, 16, 20, 2, 2, 14, 14, 13, -2, -4, 8, 20, 15, 0, 12, 23, 1, 9, -3, 2, -2, 7, -3, 10, -17, -13, 8, 14, 5, 6, 1, -7, -8, 3, 7, 1, 23, 26, 27, 14, 14, 9, 1, -2, -15, 9, 10, 17, 16, 17, 17, 29, 35, -3, -1, 2, 12, 1, 32, 38, 17, -2, 0, -17, -36, -36, -28, -28, 9, 3, -6, 4, 15, -24, 3, 29, 4, 8, 6, -5, 15, -12, 7, 25, 14, -5 },
+    { -25, -28, -30, -24, -26, -29, -28, -27, -28, -34, -30, -33, -18, -31, -25, -27, -41, -28, -39, -25, -44, -31, -28, -24, -35, -19, -42, -51, -31, -47, -33, 35, 35, 37, 39, 35, 35, 41, 39, 44, 37, 41, 29, 38, 31, 42, 47, 36, 51, 34, 52, 35, 44, 44, 32, 64, 63, 57, 59, 34, 1, 16, 2, 11, -6, -4, 14, 18, -1, 0, 12, 11, 10, -5, -6, 6, 18, 14, -1, 10, 21, -2, 6, -4, 0, -6, 3, -7, 6, -21, -17, 4, 10, 1, 5, -1, -11, -12, -1, 3, -3, 19, 22, 23, 10, 10, 6, -2, -6, -19, 6, 6, 17, 16, 18, 18, 29, 36, -2, 0, 3, 9, -3, 32, 38, 18, -1, 1, -16, -36, -35, -27, -27, 6, 3, -9, 2, 13, -25, 2, 27, 1, 5, 3, -7, 12, -16, 4, 22, 11, -7 },
+    { -42, -45, -47, -42, -41, -44, -45, -45, -43, -51, -48, -49, -22, -32, -25, -31, -42, -34, -45, -29, -48, -33, -30, -36, -47, -30, -51, -57, -39, -52, -44, 42, 43, 45, 47, 42, 42, 48, 45, 52, 46, 49, 30, 40, 32, 44, 50, 34, 50, 32, 53, 34, 47, 50, 36, 65, 65, 60, 63, 40, 0, 15, 1, 10, -8, -5, 13, 16, -3, -2, 10, 9, 8, -7, -7, 4, 16, 13, -2, 8, 20, -4, 4, -5, -2, -9, 0, -10, 2, -25, -20, 0, 6, -2, 5, -2, -14, -15, -4, 0, -6, 16, 19, 19, 7, 6, 4, -4, -9, -22, 3, 2, 18, 16, 19, 19, 30, 37, -1, 1, 4, 6, -7, 33, 39, 20, 0, 2, -15, -35, -34, -26, -26, 4, 3, -11, 0, 11, -25, 2, 26, -1, 2, 1, -9, 9, -20, 1, 20, 9, -9 },
+    { -49, -53, -54, -50, -47, -51, -52, -52, -49, -58, -56, -55, -22, -32, -25, -31, -42, -34, -45, -29, -48, -33, -30, -40, -51, -35, -52, -57, -41, -53, -48, 48, 49, 50, 53, 47, 46, 54, 50, 57, 52, 53, 26, 38, 31, 39, 47, 32, 47, 30, 51, 33, 49, 51, 38, 61, 62, 55, 59, 42, -1, 14, 0, 9, -8, -6, 12, 16, -3, -3, 9, 9, 10, -5, -6, 5, 17, 13, -2, 7, 19, -4, 4, -6, -2, -9, 0, -10, 2, -25, -20, 0, 6, -2, 5, -2, -14, -15, -4, 1, -5, 17, 20, 20, 7, 7, 4, -4, -8, -21, 3, 3, 16, 14, 17, 17, 28, 35, -3, -1, 2, 5, -7, 31, 37, 17, -2, 0, -17, -37, -36, -28, -28, 4, 3, -11, 0, 11, -24, 2, 23, -1, 1, 1, -9, 9, -19, 0, 18, 9, -9 },
+    { -56, -60, -61, -57, -53, -57, -58, -59, -55, -64, -63, -61, -21, -32, -25, -30, -42, -33, -44, -28, -48, -33, -30, -44, -54, -39, -52, -57, -42, -53, -52, 54, 55, 55, 59, 52, 51, 60, 55, 63, 58, 58, 23, 37, 30, 35, 45, 31, 45, 29, 50, 33, 52, 53, 40, 58, 60, 51, 56, 44, -1, 13, 0, 9, -7, -6, 12, 16, -2, -3, 9, 10, 13, -3, -5, 7, 18, 13, -2, 7, 19, -4, 4, -6, -2, -9, 0, -10, 2, -25, -20, 1, 7, -1, 5, -2, -14, -15, -4, 2, -4, 18, 21, 21, 8, 8, 5, -4, -6, -20, 4, 4, 15, 13, 15, 15, 26, 33, -5, -3, 0, 5, -6, 29, 35, 15, -4, -2, -19, -39, -38, -30, -30, 4, 3, -11, 0, 11, -23, 2, 21, -1, 1, 1, -9, 9, -18, 0, 17, 9, -9 },
+    { -63, -68, -68, -65, -59, -63, -65, -66, -61, -70, -70, -67, -20, -32, -25, -29, -42, -32, -43, -28, -48, -33, -30, -48, -58, -44, -52, -57, -44, -54, -56, 60, 61, 60, 65, 57, 56, 66, 60, 68, 64, 62, 19, 35, 29, 30, 43, 30, 42, 28, 48, 32, 54, 55, 42, 54, 57, 47, 52, 46, -2, 12, 0, 9, -7, -6, 11, 16, -1, -3, 8, 10, 15, -1, -4, 8, 19, 13, -2, 6, 19, -4, 4, -6, -2, -9, 0, -10, 2, -25, -20, 1, 8, -1, 5, -2, -14, -15, -4, 3, -3, 19, 22, 22, 9, 9, 6, -4, -4, -19, 4, 5, 13, 11, 13, 13, 24, 31, -7, -5, -2, 5, -6, 27, 33, 13, -6, -4, -21, -41, -40, -32, -32, 4, 3, -11, 0, 11, -22, 2, 19, -1, 0, 1, -9, 9, -17, 0, 16, 9, -9 },
+    { -69, -75, -75, -72, -65, -69, -71, -73, -67, -76, -77, -72, -19, -32, -25, -28, -42, -31, -42, -27, -47, -33, -30, -51, -61, -48, -52, -57, -45, -54, -60, 66, 68, 66, 72, 62, 61, 72, 65, 74, 70, 67, 16, 34, 28, 26, 41, 29, 40, 27, 47, 32, 57, 57, 45, 51, 55, 43, 49, 49, -2, 12, 0, 9, -6, -6, 11, 17, 0, -3, 8, 11, 18, 2, -2, 10, 21, 13, -2, 6, 19, -4, 5, -6, -1, -9, 0, -9, 3, -24, -19, 2, 9, 0, 5, -1, -13, -15, -3, 4, -2, 20, 23, 23, 10, 10, 7, -4, -2, -17, 5, 7, 12, 10, 11, 11, 23, 29, -9, -6, -3, 5, -5, 26, 32, 11, -7, -5, -22, -42, -42, -33, -33, 4, 4, -11, 0, 11, -20, 2, 17, 0, 0, 2, -8, 10, -16, 0, 15, 10, -9 },
+    { -66, -71, -71, -69, -61, -65, -68, -70, -64, -73, -73, -69, -15, -28, -22, -23, -37, -28, -38, -24, -43, -30, -27, -48, -57, -44, -48, -52, -40, -49, -55, 65, 67, 65, 71, 61, 60, 71, 65, 73, 69, 67, 18, 36, 30, 28, 43, 31, 42, 29, 49, 34, 58, 57, 45, 53, 57, 45, 51, 49, 0, 14, 2, 11, -4, -5, 13, 19, 1, -2, 10, 12, 20, 4, 0, 13, 24, 16, 1, 7, 21, -2, 7, -5, 1, -5, 4, -5, 7, -20, -15, 6, 12, 3, 7, 1, -10, -11, 1, 7, 1, 23, 26, 26, 13, 13, 9, -2, 0, -15, 7, 9, 14, 12, 13, 13, 25, 31, -7, -4, -1, 7, -3, 28, 34, 13, -5, -4, -20, -40, -40, -31, -31, 6, 7, -9, 2, 14, -17, 5, 20, 2, 1, 4, -6, 12, -14, 2, 18, 12, -7 },
+    { -62, -66, -66, -65, -57, -60, -65, -67, -60, -69, -69, -65, -10, -24, -18, -17, -32, -25, -34, -21, -39, -27, -24, -45, -53, -40, -43, -47, -34, -43, -50, 65, 66, 65, 71, 61, 60, 71, 65, 73, 69, 67, 20, 39, 33, 30, 45, 34, 45, 32, 52, 37, 59, 58, 46, 55, 59, 47, 53, 50, 2, 17, 4, 14, -2, -3, 15, 21, 3, 0, 12, 14, 22, 6, 3, 16, 27, 19, 4, 9, 23, 0, 10, -3, 3, -1, 8, -1, 11, -16, -11, 10, 16, 7, 9, 4, -6, -7, 5, 11, 4, 26, 29, 29, 17, 17, 12, 1, 3, -12, 10, 12, 17, 15, 16, 16, 28, 34, -5, -2, 1, 10, 0, 31, 37, 15, -3, -2, -18, -38, -38, -29, -29, 9, 10, -6, 5, 17, -14, 8, 24, 5, 3, 7, -3, 15, -12, 4, 21, 15, -4 },
+    { -58, -61, -62, -62, -53, -55, -62, -64, -56, -65, -65, -61, -5, -20, -15, -12, -27, -22, -30, -18, -35, -24, -21, -42, -49, -36, -38, -42, -29, -37, -45, 65, 65, 65, 70, 61, 60, 71, 65, 72, 68, 67, 22, 41, 36, 32, 47, 37, 47, 35, 54, 40, 60, 59, 47, 57, 61, 49, 55, 50, 4, 19, 6, 16, 0, -1, 17, 23, 4, 2, 14, 16, 24, 8, 5, 19, 30, 22, 7, 11, 25, 2, 12, -2, 5, 3, 12, 3, 15, -12, -7, 14, 20, 11, 11, 6, -2, -3, 9, 14, 7, 29, 32, 32, 20, 20, 15, 3, 6, -9, 12, 15, 19, 17, 18, 18, 30, 36, -3, 0, 3, 12, 3, 33, 39, 17, -1, 0, -16, -36, -36, -27, -27, 11, 13, -3, 8, 20, -11, 11, 27, 7, 4, 9, -1, 17, -10, 6, 24, 18, -2 },
+    { -54, -56, -57, -58, -48, -50, -58, -60, -52, -61, -61, -57, 0, -16, -11, -6, -22, -18, -25, -15, -31, -21, -18, -39, -45, -31, -33, -36, -23, -31, -40, 65, 65, 65, 70, 61, 60, 71, 65, 72, 68, 67, 25, 44, 39, 35, 50, 40, 50, 38, 57, 43, 61, 60, 48, 59, 64, 51, 57, 51, 7, 22, 9, 19, 2, 1, 20, 26, 6, 4, 16, 18, 27, 11, 8, 22, 33, 25, 10, 13, 27, 5, 15, 0, 8, 7, 17, 7, 20, -7, -3, 18, 24, 15, 13, 9, 2, 1, 13, 18, 10, 33, 36, 36, 24, 24, 18, 6, 9, -6, 15, 18, 22, 20, 21, 21, 33, 39, 0, 2, 5, 15, 6, 36, 42, 20, 1, 2, -14, -33, -33, -24, -24, 14, 16, 0, 11, 23, -7, 15, 31, 10, 6, 12, 2, 20, -7, 8, 27, 21, 1 },
+    { -41, -43, -45, -43, -37, -40, -44, -45, -40, -48, -47, -45, -1, -18, -13, -8, -24, -19, -27, -16, -33, -22, -20, -31, -38, -24, -32, -37, -22, -32, -34, 50, 48, 49, 53, 47, 46, 56, 51, 55, 51, 51, 25, 40, 36, 35, 46, 41, 50, 39, 54, 41, 53, 49, 40, 59, 61, 49, 53, 40, 5, 20, 7, 17, -1, 0, 18, 23, 4, 2, 14, 16, 23, 7, 4, 17, 29, 22, 7, 11, 25, 4, 14, -2, 7, 7, 18, 8, 21, -6, -3, 19, 25, 16, 11, 9, 3, 2, 14, 18, 10, 33, 36, 36, 24, 24, 16, 6, 7, -7, 14, 17, 21, 19, 19, 20, 32, 38, -1, 1, 4, 16, 6, 35, 41, 19, 0, 1, -15, -34, -34, -25, -25, 15, 15, 0, 11, 23, -8, 15, 33, 8, 4, 11, 1, 19, -8, 7, 26, 20, 1 },
+    { -27, -30, -32, -28, -26, -29, -30, -30, -28, -35, -33, -33, -2, -19, -14, -9, -26, -20, -28, -17, -34, -23, -21, -22, -31, -17, -31, -38, -20, -32, -28, 35, 32, 33, 37, 34, 32, 41, 38, 39, 34, 36, 25, 37, 33, 35, 42, 43, 51, 40, 52, 40, 45, 39, 32, 59, 58, 47, 49, 30, 3, 18, 6, 16, -3, -1, 17, 21, 2, 1, 12, 14, 19, 3, 1, 13, 25, 19, 4, 10, 24, 4, 14, -3, 6, 8, 19, 9, 22, -5, -2, 20, 26, 17, 9, 9, 4, 3, 15, 19, 11, 34, 37, 37, 25, 25, 15, 7, 5, -8, 14, 17, 20, 18, 18, 19, 31, 37, -2, 0, 3, 18, 7, 34, 40, 18, 0, 1, -15, -34, -34, -25, -25, 16, 14, 1, 12, 23, -9, 15, 35, 7, 3, 10, 0, 19, -8, 6, 25, 20, 1 },
+    { -14, -17, -19, -13, -15, -18, -16, -15, -16, -22, -19, -21, -3, -20, -15, -11, -28, -21, -29, -18, -35, -24, -22, -13, -24, -10, -30, -39, -18, -33, -22, 20, 16, 17, 21, 20, 18, 26, 24, 22, 17, 21, 25, 33, 30, 35, 38, 44, 51, 41, 50, 38, 37, 28, 24, 59, 55, 45, 45, 20, 1, 16, 5, 14, -5, -2, 15, 19, 0, -1, 10, 12, 15, -1, -3, 9, 21, 16, 1, 9, 23, 3, 14, -5, 5, 9, 20, 10, 23, -4, -1, 21, 27, 18, 7, 9, 5, 4, 16, 19, 12, 34, 37, 38, 25, 25, 13, 7, 3, -9, 14, 16, 19, 17, 17, 18, 30, 36, -3, -1, 2, 20, 7, 33, 39, 17, -1, 0, -16, -35, -35, -26, -26, 17, 13, 1, 12, 23, -10, 15, 37, 6, 1, 9, -1, 18, -9, 5, 24, 20, 1 },
+    { 0, -4, -6, 2, -4, -7, -2, 0, -4, -9, -4, -9, -4, -21, -16, -12, -29, -22, -30, -19, -36, -25, -23, -4, -16, -2, -28, -39, -16, -33, -16, 6, 0, 2, 5, 7, 4, 11, 11, 6, 0, 6, 26, 30, 27, 35, 34, 46, 52, 43, 48, 37, 29, 18, 17, 60, 53, 44, 42, 10, 0, 15, 4, 13, -7, -3, 14, 17, -2, -2, 9, 10, 11, -4, -6, 5, 18, 13, -2, 8, 22, 3, 14, -6, 5, 10, 21, 11, 24, -3, 0, 22, 28, 19, 6, 9, 7, 6, 18, 20, 13, 35, 38, 39, 26, 26, 12, 8, 1, -9, 14, 16, 18, 16, 16, 17, 29, 35, -3, -1, 1, 22, 8, 33, 38, 16, -1, 0, -16, -35, -35, -26, -26, 18, 13, 2, 13, 24, -11, 15, 40, 5, 0, 9, -1, 18, -9, 5, 24, 20, 1 },
+    { -4, -7, -9, -3, -7, -9, -7, -5, -8, -13, -8, -12, -1, -19, -15, -8, -26, -20, -27, -18, -33, -24, -22, -7, -18, -3, -25, -35, -13, -29, -16, 1, -5, -2, 1, 3, 1, 7, 7, 2, -4, 3, 24, 29, 26, 33, 33, 44, 51, 41, 47, 36, 25, 16, 13, 58, 52, 42, 41, 7, -1, 14, 3, 12, -8, -4, 13, 16, -3, -3, 8, 9, 10, -5, -7, 4, 17, 12, -3, 7, 21, 2, 13, -7, 4, 10, 21, 11, 24, -3, 0, 22, 28, 19, 5, 8, 7, 6, 18, 20, 13, 35, 38, 39, 26, 26, 11, 7, 0, -10, 13, 14, 18, 16, 16, 17, 29, 35, -3, -1, 1, 21, 7, 33, 38, 16, -1, 0, -16, -35, -35, -26, -26, 17, 12, 2, 12, 23, -9, 14, 38, 4, -1, 8, -2, 17, -9, 4, 23, 19, 0 },
+    { -7, -10, -12, -7, -9, -11, -11, -9, -11, -16, -12, -15, 2, -16, -13, -4, -22, -18, -23, -17, -30, -23, -21, -9, -19, -3, -22, -31, -10, -25, -16, -3, -9, -5, -3, 0, -2, 3, 4, -1, -7, 0, 23, 29, 26, 31, 33, 43, 50, 40, 47, 36, 22, 15, 10, 57, 51, 40, 40, 5, -1, 14, 3, 12, -8, -5, 13, 16, -3, -3, 8, 9, 10, -5, -7, 4, 17, 12, -3, 6, 20, 1, 13, -7, 4, 10, 21, 12, 25, -2, 0, 23, 28, 19, 5, 8, 7, 6, 19, 20, 13, 35, 38, 39, 26, 26, 10, 7, -1, -11, 12, 13, 18, 16, 17, 17, 29, 35, -3, -1, 1, 21, 6, 33, 38, 17, -1, 0, -16, -35, -35, -26, -26, 17, 12, 2, 12, 23, -6, 14, 37, 3, -1, 7, -3, 16, -9, 4, 23, 19, 0 },
+    { -11, -13, -15, -11, -12, -13, -15, -14, -14, -20, -16, -18, 5, -14, -12, 0, -18, -16, -20, -16, -27, -22, -20, -11, -20, -4, -19, -27, -7, -21, -16, -7, -13, -9, -7, -4, -5, -1, 0, -4, -11, -3, 21, 28, 26, 29, 32, 42, 49, 39, 46, 36, 19, 13, 7, 55, 50, 38, 39, 3, -1, 14, 2, 11, -9, -6, 12, 16, -3, -4, 7, 8, 9, -5, -7, 4, 17, 12, -3, 5, 19, 0, 12, -8, 3, 10, 21, 12, 25, -2, 0, 23, 28, 19, 4, 8, 7, 6, 19, 20, 13, 35, 38, 39, 26, 26, 9, 6, -2, -12, 11, 12, 18, 16, 17, 17, 29, 35, -3, -1, 1, 21, 5, 33, 38, 17, -1, 0, -16, -35, -35, -26, -26, 17, 11, 2, 12, 23, -4, 14, 35, 2, -2, 6, -4, 15, -9, 3, 22, 18, 0 },
+};
+
+static int8_t grunt_pvs_vy[GRUNT_PVS_FRAMES][GRUNT_PVS_VERTICES] = {
+    { 30, 24, 25, 33, 29, 26, 35, 34, 33, 29, 28, 30, 30, 41, 59, 22, 27, 35, 23, 40, 29, 47, 52, 41, 31, 32, 18, 14, 18, 14, 24, 10, 14, 17, 10, 17, 20, 10, 16, 16, 15, 22, 35, 36, 42, 26, 26, 53, 35, 58, 33, 54, 17, 31, 22, 20, 20, 13, 16, 30, 86, 86, 82, 82, 85, 78, 78, 84, 78, 77, 76, 77, 104, 105, 108, 114, 107, 107, 108, 6, 0, 23, 21, -6, 8, -36, -33, -43, -39, -44, -37, -65, -67, -67, -9, 8, -35, -37, -67, -77, -76, -76, -67, -61, -61, -67, 22, 20, 0, -2, 8, -8, -35, -31, -42, -37, -36, -43, -64, -62, -65, 8, -11, -32, -34, -64, -75, -75, -74, -58, -65, -58, -65, 9, 80, 28, 27, 26, 46, 57, 48, 16, 57, 25, 29, 26, 28, 41, 33, 26, 28 },
+    { 25, 19, 20, 27, 25, 21, 30, 28, 28, 25, 22, 26, 30, 42, 60, 22, 28, 36, 24, 40, 30, 48, 53, 38, 30, 28, 18, 15, 17, 14, 22, 12, 16, 19, 12, 19, 22, 13, 18, 19, 17, 24, 35, 35, 41, 26, 26, 53, 36, 58, 34, 54, 19, 33, 23, 21, 21, 13, 16, 31, 85, 85, 82, 82, 85, 78, 78, 83, 77, 76, 76, 76, 103, 104, 108, 113, 106, 107, 108, 6, 0, 23, 21, -5, 8, -36, -33, -43, -39, -44, -37, -65, -67, -67, -9, 9, -35, -37, -68, -77, -76, -77, -67, -61, -61, -67, 22, 20, 0, -2, 8, -8, -35, -31, -42, -37, -36, -43, -64, -62, -65, 8, -11, -32, -33, -64, -75, -75, -74, -58, -64, -58, -64, 9, 80, 28, 27, 26, 47, 57, 48, 16, 57, 25, 28, 26, 29, 41, 32, 26, 28 },
+    { 16, 10, 13, 17, 18, 14, 22, 19, 21, 18, 14, 20, 28, 42, 59, 21, 29, 38, 26, 42, 33, 49, 53, 32, 27, 22, 19, 17, 14, 15, 18, 8, 11, 15, 8, 16, 18, 10, 15, 15, 13, 21, 34, 36, 41, 27, 27, 54, 39, 57, 36, 54, 19, 32, 20, 25, 24, 15, 18, 28, 86, 86, 83, 83, 85, 79, 79, 84, 77, 77, 77, 76, 103, 104, 108, 113, 106, 107, 109, 7, 1, 24, 21, -5, 8, -36, -33, -43, -39, -44, -37, -65, -67, -67, -8, 8, -34, -37, -67, -77, -76, -77, -67, -61, -61, -67, 22, 20, 0, -2, 8, -9, -34, -29, -41, -35, -36, -42, -63, -61, -64, 8, -11, -31, -32, -63, -74, -74, -74, -58, -64, -58, -64, 8, 80, 28, 27, 26, 45, 56, 45, 17, 60, 25, 29, 27, 28, 43, 32, 26, 28 },
+    { 0, -5, -2, 0, 5, 1, 6, 2, 8, 3, -2, 6, 28, 43, 58, 22, 31, 41, 29, 44, 37, 52, 55, 22, 18, 14, 19, 20, 12, 16, 11, -1, 0, 4, -2, 6, 8, 0, 6, 4, 1, 10, 33, 42, 47, 26, 34, 51, 37, 55, 40, 57, 14, 25, 15, 23, 27, 14, 21, 22, 88, 92, 85, 86, 83, 82, 84, 88, 76, 80, 82, 78, 100, 96, 103, 111, 108, 111, 108, 9, 2, 27, 23, -1, 10, -33, -32, -41, -38, -41, -34, -62, -64, -64, -6, 10, -32, -34, -65, -74, -73, -74, -64, -58, -58, -64, 23, 21, -2, -2, 9, -10, -30, -24, -37, -29, -32, -38, -58, -55, -59, 10, -11, -25, -26, -57, -69, -70, -69, -53, -59, -53, -59, 10, 78, 28, 27, 27, 39, 54, 40, 18, 69, 29, 31, 30, 30, 49, 37, 28, 30 },
+    { -12, -19, -15, -14, -6, -10, -7, -13, -4, -11, -17, -7, 29, 45, 58, 23, 33, 42, 30, 46, 38, 53, 57, 14, 10, 7, 18, 20, 10, 16, 3, -5, -5, 0, -6, 3, 5, -3, 3, 0, -3, 7, 34, 45, 50, 28, 37, 54, 42, 57, 45, 60, 14, 24, 14, 28, 33, 18, 25, 20, 91, 92, 86, 86, 85, 85, 84, 87, 77, 83, 83, 77, 97, 96, 105, 111, 105, 111, 110, 10, 3, 28, 24, 0, 12, -32, -30, -40, -37, -39, -32, -61, -63, -63, -5, 12, -30, -33, -63, -73, -72, -72, -63, -57, -57, -63, 23, 22, -5, -3, 10, -11, -27, -19, -33, -24, -29, -34, -53, -51, -54, 12, -11, -21, -22, -52, -65, -65, -64, -48, -54, -49, -55, 12, 75, 29, 28, 28, 37, 52, 40, 19, 73, 30, 32, 32, 33, 52, 40, 30, 30 },
+    { -12, -19, -16, -14, -6, -10, -8, -13, -5, -11, -17, -7, 26, 42, 55, 21, 31, 44, 34, 47, 40, 53, 56, 13, 9, 7, 21, 22, 11, 16, 2, 27, 29, 33, 29, 32, 34, 30, 33, 36, 32, 39, 34, 49, 52, 28, 42, 53, 42, 56, 48, 61, 33, 46, 31, 30, 38, 22, 32, 40, 89, 87, 82, 82, 88, 82, 81, 82, 79, 81, 80, 76, 97, 102, 109, 111, 101, 106, 111, 7, 0, 24, 21, -4, 8, -36, -34, -44, -40, -44, -37, -65, -67, -67, -9, 7, -34, -36, -67, -77, -77, -77, -68, -62, -62, -68, 20, 19, -5, -6, 6, -13, -28, -20, -35, -25, -30, -35, -54, -52, -56, 7, -13, -22, -22, -52, -67, -67, -66, -49, -55, -49, -56, 7, 73, 25, 25, 25, 34, 50, 39, 15, 68, 26, 27, 29, 31, 47, 39, 27, 26 },
+    { -13, -20, -17, -15, -7, -11, -9, -14, -6, -13, -18, -9, 25, 45, 56, 22, 36, 47, 39, 47, 46, 56, 58, 13, 9, 7, 26, 29, 14, 21, 2, 49, 54, 55, 53, 52, 54, 53, 53, 60, 56, 60, 31, 49, 49, 30, 45, 54, 48, 55, 54, 59, 47, 60, 43, 40, 47, 30, 39, 53, 81, 80, 76, 76, 82, 73, 74, 79, 74, 73, 72, 73, 100, 102, 105, 109, 101, 101, 103, 5, -1, 18, 15, -9, 2, -42, -39, -50, -45, -50, -43, -73, -75, -76, -13, 0, -40, -42, -74, -85, -85, -86, -77, -71, -71, -77, 16, 13, -6, -8, 1, -15, -35, -27, -42, -32, -35, -41, -61, -58, -62, 0, -17, -27, -27, -58, -73, -73, -72, -55, -61, -56, -62, 0, 71, 19, 19, 19, 39, 49, 37, 11, 56, 19, 22, 21, 27, 36, 30, 20, 21 },
+    { 14, 7, 9, 15, 15, 11, 18, 16, 18, 13, 10, 15, 21, 42, 55, 18, 33, 40, 34, 42, 43, 52, 54, 30, 22, 22, 27, 28, 18, 21, 15, 36, 41, 43, 39, 40, 42, 38, 40, 45, 43, 47, 25, 43, 41, 25, 40, 48, 44, 49, 50, 52, 36, 49, 35, 37, 44, 26, 36, 45, 68, 72, 68, 67, 65, 63, 64, 73, 60, 61, 62, 63, 89, 83, 85, 96, 95, 92, 86, 8, 0, 13, 9, -7, -1, -49, -47, -57, -54, -57, -49, -81, -83, -83, -13, -5, -47, -50, -82, -93, -92, -93, -83, -77, -78, -84, 10, 8, -10, -11, -3, -20, -43, -36, -50, -41, -43, -48, -70, -68, -71, -5, -22, -35, -35, -67, -83, -83, -82, -67, -73, -67, -73, -5, 66, 16, 14, 11, 42, 44, 33, 7, 43, 12, 18, 13, 23, 26, 19, 11, 17 },
+    { 1, -4, -2, 3, 2, 0, 7, 4, 6, 3, 0, 4, 9, 34, 40, 9, 30, 18, 16, 19, 31, 34, 34, 17, 13, 7, 14, 21, 7, 17, 4, -16, -13, -10, -18, -8, -5, -17, -10, -13, -13, -6, 12, 22, 20, 15, 21, 38, 36, 38, 35, 34, -1, 8, 3, 30, 30, 14, 18, 8, 55, 55, 53, 53, 54, 48, 47, 52, 46, 45, 44, 45, 72, 73, 77, 83, 76, 77, 78, 4, -5, 5, 1, -12, -9, -59, -58, -68, -65, -66, -58, -89, -91, -91, -19, -14, -57, -60, -91, -101, -100, -101, -92, -86, -86, -92, 0, -2, -14, -15, -12, -26, -47, -38, -54, -43, -47, -52, -75, -72, -76, -16, -29, -37, -36, -69, -89, -88, -89, -76, -82, -75, -81, -15, 54, 3, 5, 4, 24, 36, 23, 0, 25, 2, 5, 5, 1, 10, 3, 5, 4 },
+    { -59, -62, -57, -62, -48, -51, -54, -60, -48, -52, -61, -48, 6, 23, 28, 5, 20, -2, -2, 0, 11, 14, 15, -29, -24, -34, -10, 3, -14, 3, -29, -51, -51, -46, -54, -42, -40, -51, -42, -48, -50, -39, 0, 0, 1, -1, -4, 24, 15, 25, 9, 16, -27, -19, -25, 5, 1, -10, -9, -21, 35, 34, 34, 33, 37, 28, 27, 34, 30, 25, 24, 29, 59, 60, 60, 66, 59, 56, 57, -4, -14, -6, -9, -22, -21, -70, -69, -79, -76, -76, -69, -101, -103, -103, -28, -25, -67, -70, -102, -113, -112, -113, -103, -97, -98, -104, -10, -13, -24, -25, -23, -37, -54, -44, -61, -48, -56, -61, -80, -78, -82, -27, -39, -46, -45, -75, -95, -95, -94, -78, -85, -79, -85, -26, 39, -6, -3, -3, 18, 23, 17, -11, 4, -10, -8, -6, -11, -6, -10, -5, -7 },
+    { -68, -69, -65, -73, -56, -58, -64, -71, -57, -61, -70, -56, 0, 17, 20, 0, 16, -9, -7, -7, 6, 7, 6, -39, -31, -41, -15, 0, -19, 0, -34, -60, -61, -55, -62, -50, -48, -58, -50, -55, -59, -47, -5, -6, -6, -4, -9, 18, 12, 19, 5, 8, -32, -25, -33, 5, -1, -11, -11, -30, 25, 24, 24, 23, 27, 17, 16, 24, 20, 14, 14, 18, 49, 50, 50, 56, 49, 46, 47, -5, -15, -9, -12, -23, -24, -74, -74, -84, -81, -81, -73, -106, -107, -108, -29, -29, -72, -75, -107, -118, -117, -117, -108, -102, -103, -109, -15, -17, -28, -28, -27, -41, -56, -46, -63, -50, -59, -63, -82, -79, -84, -31, -43, -48, -46, -76, -97, -97, -96, -79, -85, -79, -85, -30, 31, -10, -7, -7, 12, 18, 12, -15, -6, -15, -12, -11, -18, -14, -17, -9, -11 },
+    { -66, -66, -62, -71, -54, -55, -62, -68, -55, -58, -67, -54, 0, 16, 18, 1, 18, -10, -6, -8, 7, 5, 4, -38, -30, -40, -13, 3, -17, 3, -32, -55, -55, -50, -56, -46, -44, -52, -45, -49, -53, -42, -7, -9, -9, -6, -12, 16, 10, 16, 2, 5, -30, -22, -31, 3, -2, -12, -13, -27, 20, 19, 20, 19, 23, 13, 11, 19, 15, 10, 9, 13, 43, 46, 47, 51, 43, 41, 44, -5, -15, -10, -14, -23, -25, -75, -75, -85, -82, -83, -75, -107, -109, -109, -29, -30, -74, -76, -108, -119, -119, -118, -109, -103, -104, -110, -16, -18, -29, -29, -28, -42, -57, -46, -63, -50, -59, -64, -82, -80, -85, -32, -44, -48, -47, -76, -98, -98, -97, -81, -87, -81, -87, -31, 27, -11, -8, -9, 11, 16, 11, -16, -10, -16, -13, -12, -19, -17, -20, -11, -12 },
+    { -67, -68, -64, -72, -55, -57, -63, -70, -56, -60, -69, -55, 1, 17, 19, 2, 18, -10, -6, -8, 7, 6, 5, -38, -30, -41, -12, 3, -17, 3, -34, -57, -57, -52, -58, -48, -46, -54, -47, -50, -55, -44, -9, -11, -10, -10, -15, 14, 5, 15, -1, 4, -32, -24, -34, -2, -8, -18, -18, -30, 20, 18, 19, 18, 22, 13, 10, 17, 14, 9, 8, 11, 41, 44, 46, 50, 42, 41, 44, -5, -15, -10, -14, -23, -25, -75, -74, -85, -82, -82, -74, -107, -108, -109, -30, -30, -73, -76, -108, -119, -119, -118, -109, -103, -104, -110, -16, -18, -28, -28, -28, -41, -57, -47, -64, -51, -59, -64, -84, -82, -87, -32, -43, -48, -47, -78, -100, -99, -100, -85, -91, -85, -91, -31, 27, -11, -8, -9, 13, 15, 11, -16, -11, -16, -13, -12, -18, -17, -19, -11, -12 },
+    { -65, -66, -62, -69, -53, -55, -60, -67, -53, -57, -66, -53, 0, 17, 20, 0, 17, -10, -7, -7, 7, 6, 6, -36, -29, -40, -14, 1, -19, 0, -33, -66, -69, -63, -69, -57, -56, -63, -55, -61, -67, -54, -8, -10, -9, -11, -15, 14, 5, 16, -1, 5, -36, -31, -39, -4, -9, -20, -20, -37, 19, 16, 18, 16, 22, 12, 9, 15, 13, 9, 6, 9, 39, 43, 45, 48, 39, 39, 43, -4, -14, -10, -14, -22, -25, -75, -74, -85, -81, -83, -75, -107, -108, -109, -29, -30, -73, -76, -108, -119, -119, -118, -109, -103, -104, -110, -16, -18, -28, -28, -28, -42, -58, -48, -65, -52, -60, -65, -85, -83, -87, -32, -43, -49, -48, -79, -101, -100, -101, -86, -92, -86, -92, -31, 26, -10, -8, -10, 14, 15, 13, -16, -12, -16, -13, -13, -18, -17, -19, -12, -12 },
+    { -65, -67, -63, -70, -55, -56, -61, -67, -54, -58, -67, -54, -3, 15, 20, -3, 14, -10, -9, -8, 5, 6, 6, -37, -30, -41, -16, -1, -21, -2, -34, -73, -78, -71, -76, -64, -64, -70, -62, -70, -76, -62, -10, -10, -8, -13, -16, 14, 3, 15, -2, 5, -39, -37, -44, -6, -10, -23, -22, -43, 18, 15, 17, 15, 20, 11, 7, 13, 11, 7, 4, 7, 37, 41, 44, 46, 37, 38, 42, -3, -13, -11, -14, -21, -25, -75, -75, -85, -82, -84, -75, -107, -109, -109, -28, -30, -74, -76, -108, -119, -119, -119, -109, -103, -104, -110, -16, -18, -28, -28, -28, -42, -58, -48, -65, -52, -61, -65, -85, -82, -87, -33, -43, -50, -49, -78, -100, -100, -99, -84, -90, -84, -90, -32, 25, -11, -9, -11, 15, 14, 12, -16, -13, -16, -13, -14, -17, -18, -19, -13, -12 },
+    { -66, -68, -63, -71, -55, -57, -62, -69, -55, -59, -68, -55, -6, 14, 20, -7, 12, -10, -10, -8, 5, 7, 7, -39, -31, -42, -18, -3, -24, -4, -35, -78, -83, -76, -82, -68, -68, -74, -66, -76, -82, -67, -10, -11, -10, -12, -15, 14, 4, 15, -1, 4, -41, -41, -46, -3, -9, -21, -20, -47, 16, 13, 15, 13, 18, 9, 5, 11, 10, 5, 2, 6, 35, 39, 42, 45, 35, 36, 40, -2, -12, -11, -14, -20, -24, -76, -75, -86, -82, -84, -76, -107, -109, -110, -27, -30, -75, -77, -109, -120, -119, -119, -110, -104, -105, -111, -16, -18, -27, -28, -28, -41, -59, -49, -66, -53, -62, -67, -85, -83, -87, -33, -43, -51, -50, -80, -100, -100, -100, -83, -89, -83, -90, -32, 23, -10, -8, -11, 16, 13, 12, -15, -15, -17, -12, -14, -17, -19, -20, -13, -11 },
+    { -69, -69, -65, -74, -57, -58, -66, -72, -58, -62, -71, -57, -5, 15, 23, -7, 10, -8, -10, -5, 4, 9, 10, -41, -33, -43, -21, -6, -25, -7, -35, -73, -80, -73, -78, -64, -65, -70, -62, -73, -79, -65, -3, -8, -7, -4, -12, 19, 10, 20, 2, 7, -36, -38, -41, 2, -4, -14, -15, -44, 21, 18, 20, 17, 22, 14, 10, 16, 13, 10, 7, 9, 38, 42, 46, 49, 39, 41, 45, 0, -10, -7, -11, -18, -21, -72, -71, -82, -78, -81, -72, -104, -106, -106, -25, -27, -71, -74, -105, -116, -116, -116, -106, -100, -101, -107, -12, -14, -24, -25, -24, -38, -57, -47, -64, -52, -60, -65, -84, -82, -86, -29, -40, -50, -49, -79, -99, -99, -98, -82, -89, -83, -89, -28, 28, -7, -5, -8, 20, 18, 17, -12, -10, -13, -8, -11, -13, -15, -16, -10, -8 },
+    { -64, -67, -63, -69, -52, -55, -60, -67, -53, -59, -68, -54, 3, 23, 34, 0, 15, 3, -1, 7, 12, 21, 22, -32, -28, -35, -14, -1, -19, -4, -32, -57, -63, -56, -61, -48, -48, -53, -46, -55, -61, -47, 7, 8, 11, 2, 1, 31, 18, 34, 13, 26, -22, -22, -27, 6, 3, -9, -7, -28, 43, 43, 41, 41, 40, 34, 34, 39, 31, 31, 30, 30, 56, 58, 64, 69, 61, 64, 66, 4, -5, 2, -1, -12, -11, -61, -61, -71, -68, -69, -61, -92, -94, -94, -19, -17, -60, -62, -94, -104, -104, -104, -95, -89, -89, -95, -1, -4, -15, -17, -14, -28, -48, -38, -54, -43, -51, -56, -74, -71, -76, -19, -30, -41, -41, -70, -88, -88, -87, -71, -77, -71, -77, -18, 47, 1, 2, 1, 27, 32, 29, -2, 10, 0, 2, 1, -3, 1, 0, 1, 1 },
+    { -43, -48, -44, -46, -33, -36, -38, -44, -32, -39, -47, -34, 15, 34, 48, 9, 23, 21, 13, 25, 24, 37, 39, -11, -11, -16, 0, 7, -6, 3, -17, -45, -49, -43, -49, -35, -34, -43, -34, -43, -48, -34, 20, 24, 28, 13, 15, 42, 27, 46, 25, 41, -13, -9, -14, 13, 13, 0, 4, -13, 64, 63, 62, 61, 63, 56, 55, 59, 54, 53, 52, 51, 77, 80, 86, 89, 80, 84, 87, 7, -1, 14, 10, -8, 0, -49, -48, -58, -55, -57, -49, -79, -81, -81, -13, -4, -48, -50, -81, -91, -90, -90, -81, -75, -75, -81, 11, 7, -6, -9, -2, -17, -41, -33, -47, -38, -43, -49, -68, -66, -70, -5, -20, -36, -36, -66, -81, -81, -80, -64, -70, -64, -70, -5, 64, 14, 14, 14, 39, 46, 39, 8, 32, 12, 16, 15, 12, 20, 16, 14, 15 },
+    { -21, -26, -23, -23, -13, -17, -16, -21, -11, -17, -25, -13, 25, 44, 58, 20, 33, 35, 26, 38, 36, 49, 51, 6, 5, 0, 13, 19, 6, 15, -1, -23, -24, -18, -26, -13, -11, -22, -13, -19, -23, -11, 31, 38, 42, 24, 30, 52, 37, 56, 38, 54, 1, 10, 3, 23, 26, 11, 17, 7, 80, 80, 77, 77, 79, 72, 72, 78, 71, 70, 70, 70, 96, 97, 101, 107, 100, 102, 102, 9, 2, 23, 19, -3, 7, -39, -38, -47, -44, -48, -40, -69, -71, -71, -8, 6, -39, -42, -72, -81, -80, -80, -71, -65, -65, -71, 21, 17, 0, -2, 7, -8, -36, -30, -43, -37, -37, -44, -65, -63, -66, 5, -12, -32, -34, -65, -76, -76, -76, -60, -66, -60, -66, 6, 77, 25, 25, 24, 45, 56, 46, 16, 50, 23, 26, 25, 23, 35, 28, 24, 25 },
+    { 13, 8, 11, 14, 16, 13, 19, 16, 20, 17, 11, 19, 28, 45, 60, 23, 34, 42, 33, 45, 41, 53, 56, 31, 28, 21, 25, 25, 17, 21, 20, -3, -3, 1, -4, 5, 6, 0, 5, 3, -1, 9, 35, 44, 47, 28, 36, 55, 41, 59, 43, 59, 15, 26, 14, 27, 31, 16, 23, 21, 88, 88, 85, 84, 87, 81, 81, 87, 80, 79, 79, 79, 106, 106, 110, 116, 109, 110, 110, 10, 4, 27, 24, -1, 12, -34, -33, -41, -39, -43, -35, -64, -66, -66, -6, 12, -35, -38, -68, -76, -75, -75, -66, -60, -60, -66, 25, 23, 2, 0, 11, -5, -33, -28, -40, -35, -34, -41, -63, -60, -63, 11, -8, -30, -32, -63, -72, -73, -72, -56, -62, -56, -62, 12, 82, 30, 30, 29, 44, 60, 47, 20, 60, 28, 31, 30, 28, 43, 34, 29, 31 },
+    { 18, 12, 14, 19, 20, 16, 23, 20, 23, 20, 15, 21, 31, 47, 62, 25, 36, 42, 32, 45, 40, 54, 57, 35, 29, 26, 24, 24, 19, 21, 21, 4, 5, 10, 2, 12, 14, 5, 11, 10, 7, 16, 38, 43, 48, 29, 34, 56, 40, 61, 40, 60, 17, 30, 20, 24, 27, 16, 21, 27, 91, 91, 87, 87, 91, 84, 84, 90, 84, 82, 82, 83, 110, 111, 114, 120, 113, 113, 113, 10, 4, 29, 26, 0, 13, -32, -31, -39, -37, -41, -33, -62, -64, -64, -4, 14, -33, -36, -66, -74, -73, -73, -64, -58, -58, -64, 27, 25, 2, 0, 12, -5, -31, -27, -38, -34, -33, -39, -61, -59, -61, 14, -7, -29, -31, -62, -71, -72, -71, -54, -61, -54, -60, 14, 84, 33, 32, 31, 46, 62, 50, 21, 64, 30, 34, 31, 31, 46, 38, 31, 33 },
+    { 13, 6, 8, 14, 15, 11, 18, 15, 18, 12, 9, 15, 33, 46, 63, 26, 34, 38, 27, 43, 35, 51, 55, 31, 23, 24, 20, 19, 18, 18, 16, 8, 10, 14, 6, 15, 18, 7, 13, 12, 11, 18, 39, 40, 46, 29, 29, 55, 37, 61, 35, 58, 16, 29, 22, 21, 22, 14, 18, 30, 90, 90, 86, 86, 90, 83, 83, 89, 83, 81, 81, 82, 110, 110, 113, 119, 112, 112, 112, 9, 3, 27, 25, -2, 12, -33, -32, -40, -38, -41, -34, -63, -65, -65, -5, 13, -33, -36, -66, -75, -73, -74, -64, -58, -58, -64, 26, 24, 1, 0, 11, -6, -32, -28, -39, -35, -33, -40, -62, -60, -62, 13, -8, -30, -32, -62, -72, -73, -72, -56, -62, -56, -62, 13, 83, 32, 31, 30, 47, 61, 51, 20, 63, 29, 33, 31, 30, 45, 38, 30, 32 },
+    { 21, 15, 16, 23, 21, 18, 26, 24, 25, 20, 18, 22, 30, 42, 60, 23, 28, 35, 23, 40, 29, 47, 52, 35, 26, 27, 17, 14, 16, 14, 19, 8, 11, 15, 7, 15, 18, 7, 14, 13, 12, 19, 36, 36, 42, 27, 26, 53, 35, 58, 32, 54, 16, 29, 21, 19, 19, 12, 15, 29, 87, 87, 83, 83, 86, 79, 79, 85, 79, 78, 77, 78, 105, 106, 109, 115, 108, 108, 109, 7, 1, 24, 22, -5, 9, -35, -33, -43, -39, -44, -37, -64, -66, -67, -8, 9, -34, -37, -67, -77, -76, -76, -66, -60, -60, -66, 23, 21, 0, -1, 8, -8, -35, -30, -42, -37, -36, -42, -64, -62, -64, 9, -10, -31, -33, -64, -74, -75, -74, -58, -64, -58, -64, 9, 80, 29, 28, 27, 46, 58, 49, 17, 59, 26, 29, 27, 28, 42, 34, 27, 29 },
+    { 30, 24, 25, 33, 29, 26, 35, 34, 33, 29, 28, 30, 30, 41, 59, 22, 27, 35, 23, 40, 29, 47, 52, 41, 31, 32, 18, 14, 18, 14, 24, 10, 14, 17, 10, 17, 20, 10, 16, 16, 15, 22, 35, 36, 42, 26, 26, 53, 35, 58, 33, 54, 17, 31, 22, 20, 20, 13, 16, 30, 86, 86, 82, 82, 85, 78, 78, 84, 78, 77, 76, 77, 104, 105, 108, 114, 107, 107, 108, 6, 0, 23, 21, -6, 8, -36, -33, -43, -39, -44, -37, -65, -67, -67, -9, 8, -35, -37, -67, -77, -76, -76, -67, -61, -61, -67, 22, 20, 0, -2, 8, -8, -35, -31, -42, -37, -36, -43, -64, -62, -65, 8, -11, -32, -34, -64, -75, -75, -74, -58, -65, -58, -65, 9, 80, 28, 27, 26, 46, 57, 48, 16, 57, 25, 29, 26, 28, 41, 33, 26, 28 },
+    { 19, 13, 15, 21, 20, 17, 24, 22, 23, 19, 16, 20, 29, 42, 58, 22, 28, 36, 24, 41, 31, 48, 53, 34, 25, 25, 18, 15, 16, 14, 18, 6, 9, 12, 6, 13, 16, 6, 12, 12, 10, 18, 34, 38, 44, 26, 28, 53, 36, 57, 36, 55, 16, 29, 20, 22, 23, 14, 18, 27, 87, 87, 83, 83, 85, 79, 79, 84, 77, 78, 77, 77, 102, 102, 107, 113, 106, 108, 108, 7, 0, 24, 21, -5, 9, -35, -33, -43, -39, -43, -36, -64, -66, -66, -8, 9, -34, -36, -66, -76, -75, -75, -66, -60, -60, -66, 22, 20, -2, -3, 8, -9, -33, -28, -40, -34, -35, -41, -62, -60, -63, 9, -11, -30, -31, -61, -73, -73, -72, -56, -63, -56, -63, 9, 78, 28, 27, 26, 43, 55, 46, 16, 61, 26, 29, 27, 29, 43, 34, 27, 28 },
+    { 9, 2, 5, 9, 11, 8, 14, 10, 14, 9, 5, 11, 29, 43, 58, 22, 30, 38, 26, 43, 33, 50, 54, 27, 20, 19, 18, 17, 14, 15, 13, 2, 4, 8, 2, 10, 12, 3, 9, 8, 6, 14, 34, 40, 46, 27, 31, 53, 38, 57, 39, 57, 15, 27, 18, 24, 26, 15, 20, 25, 88, 89, 84, 84, 85, 81, 81, 85, 77, 80, 79, 77, 100, 100, 106, 112, 106, 109, 109, 8, 1, 25, 22, -3, 10, -34, -32, -42, -38, -42, -35, -63, -65, -65, -7, 10, -33, -35, -65, -75, -74, -74, -65, -59, -59, -65, 22, 21, -3, -3, 9, -10, -31, -25, -38, -31, -33, -39, -59, -57, -60, 10, -11, -27, -28, -58, -70, -70, -69, -53, -60, -54, -60, 10, 77, 28, 27, 27, 41, 54, 44, 17, 65, 27, 30, 29, 30, 46, 36, 28, 29 },
+    { -2, -9, -5, -3, 2, -1, 3, -2, 5, -1, -6, 2, 29, 44, 58, 22, 31, 40, 28, 44, 35, 51, 55, 20, 15, 13, 18, 18, 12, 15, 8, -2, -1, 4, -2, 6, 8, 0, 6, 4, 1, 10, 34, 42, 48, 27, 34, 53, 40, 57, 42, 58, 14, 25, 16, 26, 29, 16, 22, 22, 89, 90, 85, 85, 85, 83, 82, 86, 77, 81, 81, 77, 98, 98, 105, 111, 105, 110, 109, 9, 2, 26, 23, -2, 11, -33, -31, -41, -38, -41, -34, -62, -64, -64, -6, 11, -32, -34, -64, -74, -73, -73, -64, -58, -58, -64, 22, 21, -4, -3, 9, -11, -29, -22, -36, -28, -31, -37, -56, -54, -57, 11, -11, -24, -25, -55, -68, -68, -67, -51, -57, -52, -58, 11, 76, 28, 27, 27, 39, 53, 42, 18, 69, 28, 31, 30, 31, 49, 38, 29, 29 },
+    { -12, -19, -15, -14, -6, -10, -7, -13, -4, -11, -17, -7, 29, 45, 58, 23, 33, 42, 30, 46, 38, 53, 57, 14, 10, 7, 18, 20, 10, 16, 3, -5, -5, 0, -6, 3, 5, -3, 3, 0, -3, 7, 34, 45, 50, 28, 37, 54, 42, 57, 45, 60, 14, 24, 14, 28, 33, 18, 25, 20, 91, 92, 86, 86, 85, 85, 84, 87, 77, 83, 83, 77, 97, 96, 105, 111, 105, 111, 110, 10, 3, 28, 24, 0, 12, -32, -30, -40, -37, -39, -32, -61, -63, -63, -5, 12, -30, -33, -63, -73, -72, -72, -63, -57, -57, -63, 23, 22, -5, -3, 10, -11, -27, -19, -33, -24, -29, -34, -53, -51, -54, 12, -11, -21, -22, -52, -65, -65, -64, -48, -54, -49, -55, 12, 75, 29, 28, 28, 37, 52, 40, 19, 73, 30, 32, 32, 33, 52, 40, 30, 30 },
+    { -9, -16, -12, -10, -4, -8, -4, -9, -2, -8, -13, -5, 24, 42, 53, 19, 32, 36, 26, 39, 36, 48, 51, 14, 10, 7, 17, 20, 9, 16, 3, -8, -7, -3, -9, 0, 2, -7, -1, -4, -6, 3, 28, 39, 42, 24, 33, 50, 40, 52, 42, 53, 10, 20, 11, 28, 32, 17, 23, 17, 82, 82, 77, 77, 77, 75, 74, 78, 69, 73, 73, 69, 90, 90, 98, 104, 97, 102, 102, 8, 1, 22, 18, -3, 6, -39, -37, -47, -44, -46, -39, -68, -70, -70, -9, 5, -37, -40, -70, -80, -79, -80, -71, -65, -65, -71, 17, 16, -8, -6, 4, -15, -32, -24, -39, -29, -34, -39, -59, -57, -60, 5, -16, -25, -26, -57, -71, -71, -71, -55, -61, -56, -62, 5, 69, 22, 22, 22, 33, 48, 35, 14, 61, 23, 25, 25, 25, 41, 30, 23, 23 },
+    { -6, -12, -9, -6, -2, -5, 0, -5, 1, -4, -9, -2, 19, 39, 49, 16, 31, 30, 23, 32, 34, 43, 45, 15, 11, 7, 16, 20, 8, 16, 3, -11, -9, -5, -12, -3, 0, -10, -4, -7, -8, 0, 23, 33, 35, 21, 29, 46, 39, 47, 40, 47, 6, 16, 8, 29, 31, 16, 21, 14, 73, 73, 69, 69, 69, 66, 65, 69, 61, 64, 63, 61, 84, 84, 91, 97, 90, 94, 94, 7, -1, 16, 12, -6, 1, -46, -44, -54, -51, -53, -45, -75, -77, -77, -12, -1, -44, -47, -77, -87, -86, -87, -78, -72, -72, -78, 11, 10, -10, -9, -1, -19, -37, -29, -44, -34, -38, -43, -64, -62, -65, -2, -20, -29, -29, -61, -77, -77, -77, -62, -68, -62, -68, -2, 64, 16, 16, 16, 30, 44, 31, 9, 49, 16, 18, 18, 17, 31, 21, 17, 17 },
+    { -3, -8, -6, -2, 0, -3, 3, -1, 3, -1, -5, 1, 14, 36, 44, 12, 30, 24, 19, 25, 32, 38, 39, 16, 12, 7, 15, 20, 7, 16, 3, -14, -11, -8, -15, -6, -3, -14, -7, -10, -11, -3, 17, 27, 27, 18, 25, 42, 37, 42, 37, 40, 2, 12, 5, 29, 30, 15, 19, 11, 64, 64, 61, 61, 61, 57, 56, 60, 53, 54, 53, 53, 78, 78, 84, 90, 83, 85, 86, 5, -3, 10, 6, -9, -4, -53, -51, -61, -58, -60, -52, -82, -84, -84, -16, -8, -51, -54, -84, -94, -93, -94, -85, -79, -79, -85, 5, 4, -12, -12, -7, -23, -42, -34, -49, -39, -43, -48, -70, -67, -71, -9, -25, -33, -33, -65, -83, -83, -83, -69, -75, -69, -75, -9, 59, 9, 10, 10, 27, 40, 27, 4, 37, 9, 11, 11, 9, 20, 12, 11, 10 },
+    { 1, -4, -2, 3, 2, 0, 7, 4, 6, 3, 0, 4, 9, 34, 40, 9, 30, 18, 16, 19, 31, 34, 34, 17, 13, 7, 14, 21, 7, 17, 4, -16, -13, -10, -18, -8, -5, -17, -10, -13, -13, -6, 12, 22, 20, 15, 21, 38, 36, 38, 35, 34, -1, 8, 3, 30, 30, 14, 18, 8, 55, 55, 53, 53, 54, 48, 47, 52, 46, 45, 44, 45, 72, 73, 77, 83, 76, 77, 78, 4, -5, 5, 1, -12, -9, -59, -58, -68, -65, -66, -58, -89, -91, -91, -19, -14, -57, -60, -91, -101, -100, -101, -92, -86, -86, -92, 0, -2, -14, -15, -12, -26, -47, -38, -54, -43, -47, -52, -75, -72, -76, -16, -29, -37, -36, -69, -89, -88, -89, -76, -82, -75, -81, -15, 54, 3, 5, 4, 24, 36, 23, 0, 25, 2, 5, 5, 1, 10, 3, 5, 4 },
+    { -16, -20, -18, -16, -13, -15, -11, -15, -10, -13, -18, -11, 7, 29, 34, 7, 27, 11, 10, 12, 25, 27, 26, 3, 2, -5, 7, 16, 1, 13, -6, -27, -24, -21, -28, -18, -16, -27, -20, -23, -24, -16, 6, 13, 12, 8, 12, 32, 28, 32, 26, 26, -9, 0, -7, 22, 20, 6, 9, -2, 46, 45, 44, 44, 46, 39, 37, 43, 38, 36, 35, 36, 64, 65, 69, 74, 67, 68, 69, 1, -8, 1, -3, -15, -13, -63, -62, -73, -70, -70, -62, -94, -96, -96, -22, -18, -61, -64, -96, -106, -105, -106, -97, -91, -91, -97, -4, -6, -18, -19, -16, -30, -50, -41, -57, -45, -50, -55, -78, -75, -79, -20, -33, -40, -39, -72, -92, -91, -92, -79, -85, -78, -84, -19, 47, -1, 1, 0, 21, 30, 20, -4, 16, -3, 0, 0, -4, 3, -3, 1, 0 },
+    { -33, -36, -33, -35, -27, -29, -28, -33, -25, -29, -35, -26, 5, 25, 29, 5, 24, 4, 5, 5, 19, 20, 19, -11, -9, -17, 1, 12, -5, 10, -15, -37, -35, -31, -38, -28, -26, -36, -29, -32, -34, -25, 1, 5, 5, 2, 3, 26, 20, 26, 17, 19, -17, -8, -16, 14, 11, -2, 0, -11, 37, 36, 36, 35, 38, 30, 28, 34, 30, 27, 26, 28, 56, 58, 61, 66, 59, 59, 61, -1, -10, -3, -7, -18, -17, -67, -66, -77, -74, -74, -66, -98, -100, -100, -25, -22, -65, -68, -100, -110, -110, -110, -101, -95, -95, -101, -8, -10, -21, -22, -20, -34, -52, -43, -59, -47, -53, -58, -80, -77, -82, -24, -36, -43, -42, -74, -95, -94, -95, -81, -87, -80, -86, -23, 40, -4, -2, -3, 18, 25, 17, -8, 7, -7, -4, -4, -9, -4, -8, -3, -4 },
+    { -50, -52, -49, -54, -41, -43, -46, -52, -41, -45, -52, -41, 3, 21, 24, 3, 21, -3, -1, -2, 13, 13, 12, -25, -20, -29, -6, 7, -11, 6, -25, -47, -46, -42, -48, -38, -36, -45, -38, -41, -45, -35, -4, -3, -3, -4, -6, 20, 12, 20, 8, 11, -25, -16, -25, 6, 1, -10, -9, -21, 28, 27, 27, 26, 30, 21, 19, 25, 22, 18, 17, 19, 48, 51, 53, 58, 50, 50, 52, -3, -13, -7, -11, -21, -21, -71, -70, -81, -78, -78, -70, -103, -104, -105, -28, -26, -69, -72, -104, -115, -115, -114, -105, -99, -100, -106, -12, -14, -25, -25, -24, -38, -55, -45, -62, -49, -56, -61, -82, -80, -85, -28, -40, -46, -45, -76, -98, -97, -98, -83, -89, -83, -89, -27, 33, -8, -5, -6, 15, 20, 14, -12, -2, -12, -9, -8, -14, -11, -14, -7, -8 },
+    { -67, -68, -64, -72, -55, -57, -63, -70, -56, -60, -69, -55, 1, 17, 19, 2, 18, -10, -6, -8, 7, 6, 5, -38, -30, -41, -12, 3, -17, 3, -34, -57, -57, -52, -58, -48, -46, -54, -47, -50, -55, -44, -9, -11, -10, -10, -15, 14, 5, 15, -1, 4, -32, -24, -34, -2, -8, -18, -18, -30, 20, 18, 19, 18, 22, 13, 10, 17, 14, 9, 8, 11, 41, 44, 46, 50, 42, 41, 44, -5, -15, -10, -14, -23, -25, -75, -74, -85, -82, -82, -74, -107, -108, -109, -30, -30, -73, -76, -108, -119, -119, -118, -109, -103, -104, -110, -16, -18, -28, -28, -28, -41, -57, -47, -64, -51, -59, -64, -84, -82, -87, -32, -43, -48, -47, -78, -100, -99, -100, -85, -91, -85, -91, -31, 27, -11, -8, -9, 13, 15, 11, -16, -11, -16, -13, -12, -18, -17, -19, -11, -12 },
+    { -68, -69, -65, -73, -56, -58, -64, -71, -57, -61, -70, -56, -1, 16, 20, -1, 16, -10, -7, -8, 6, 6, 6, -39, -31, -42, -15, 0, -19, 0, -35, -61, -63, -58, -63, -52, -51, -58, -51, -56, -61, -50, -8, -11, -10, -9, -15, 15, 6, 16, -1, 4, -33, -28, -36, -1, -7, -17, -18, -34, 20, 18, 19, 17, 22, 13, 10, 16, 13, 9, 7, 10, 40, 43, 46, 49, 41, 41, 44, -4, -14, -10, -14, -22, -24, -75, -74, -85, -81, -82, -74, -107, -108, -109, -29, -30, -73, -76, -108, -119, -119, -118, -109, -103, -104, -110, -15, -17, -27, -28, -27, -41, -57, -47, -64, -52, -60, -65, -84, -82, -87, -32, -43, -49, -48, -79, -100, -99, -100, -85, -91, -85, -91, -31, 27, -10, -8, -9, 14, 15, 12, -15, -11, -16, -12, -12, -17, -17, -19, -11, -11 },
+    { -68, -69, -65, -73, -56, -58, -65, -71, -57, -61, -70, -56, -2, 16, 21, -3, 14, -9, -8, -7, 5, 7, 7, -40, -32, -42, -17, -2, -21, -2, -35, -65, -69, -63, -68, -56, -56, -62, -55, -62, -67, -55, -6, -10, -9, -7, -14, 16, 7, 17, 0, 5, -34, -31, -38, 0, -6, -16, -17, -37, 20, 18, 19, 17, 22, 13, 10, 16, 13, 9, 7, 10, 39, 43, 46, 49, 40, 41, 44, -3, -13, -9, -13, -21, -23, -74, -73, -84, -80, -82, -73, -106, -107, -108, -28, -29, -72, -75, -107, -118, -118, -117, -108, -102, -103, -109, -14, -16, -26, -27, -26, -40, -57, -47, -64, -52, -60, -65, -84, -82, -87, -31, -42, -49, -48, -79, -100, -99, -99, -84, -90, -84, -90, -30, 27, -9, -7, -9, 16, 16, 14, -14, -11, -15, -11, -12, -16, -16, -18, -11, -10 },
+    { -69, -69, -65, -74, -57, -58, -66, -72, -58, -62, -71, -57, -4, 15, 22, -5, 12, -9, -9, -6, 4, 8, 8, -41, -33, -43, -19, -4, -23, -5, -35, -69, -75, -68, -73, -60, -61, -66, -59, -68, -73, -60, -5, -9, -8, -6, -13, 17, 8, 18, 1, 6, -35, -35, -40, 1, -5, -15, -16, -41, 20, 18, 19, 17, 22, 13, 10, 16, 13, 9, 7, 9, 38, 42, 46, 49, 39, 41, 44, -2, -12, -8, -12, -20, -22, -73, -72, -83, -79, -82, -73, -105, -107, -107, -27, -28, -72, -75, -106, -117, -117, -117, -107, -101, -102, -108, -13, -15, -25, -26, -25, -39, -57, -47, -64, -52, -60, -65, -84, -82, -87, -30, -41, -50, -49, -79, -100, -99, -99, -83, -90, -84, -90, -29, 27, -8, -6, -9, 18, 17, 15, -13, -11, -14, -10, -12, -15, -16, -17, -11, -9 },
+    { -69, -69, -65, -74, -57, -58, -66, -72, -58, -62, -71, -57, -5, 15, 23, -7, 10, -8, -10, -5, 4, 9, 10, -41, -33, -43, -21, -6, -25, -7, -35, -73, -80, -73, -78, -64, -65, -70, -62, -73, -79, -65, -3, -8, -7, -4, -12, 19, 10, 20, 2, 7, -36, -38, -41, 2, -4, -14, -15, -44, 21, 18, 20, 17, 22, 14, 10, 16, 13, 10, 7, 9, 38, 42, 46, 49, 39, 41, 45, 0, -10, -7, -11, -18, -21, -72, -71, -82, -78, -81, -72, -104, -106, -106, -25, -27, -71, -74, -105, -116, -116, -116, -106, -100, -101, -107, -12, -14, -24, -25, -24, -38, -57, -47, -64, -52, -60, -65, -84, -82, -86, -29, -40, -50, -49, -79, -99, -99, -98, -82, -89, -83, -89, -28, 28, -7, -5, -8, 20, 18, 17, -12, -10, -13, -8, -11, -13, -15, -16, -10, -8 },
+    { -49, -50, -46, -52, -39, -41, -45, -50, -39, -43, -51, -38, 3, 22, 32, 0, 16, 4, 0, 7, 13, 20, 21, -23, -18, -27, -10, 1, -15, 0, -22, -56, -61, -55, -60, -47, -48, -53, -46, -54, -60, -47, 6, 5, 6, 4, 0, 28, 17, 29, 12, 20, -24, -22, -28, 8, 4, -7, -6, -28, 37, 35, 36, 33, 38, 30, 27, 33, 29, 27, 25, 26, 55, 58, 62, 65, 56, 58, 61, 2, -7, 1, -3, -14, -13, -63, -62, -72, -69, -72, -63, -94, -96, -96, -21, -18, -62, -65, -96, -106, -106, -106, -96, -90, -91, -97, -3, -5, -18, -19, -16, -30, -51, -43, -58, -48, -54, -59, -79, -77, -81, -19, -32, -45, -45, -75, -93, -93, -92, -76, -83, -77, -83, -18, 41, 2, 3, 1, 26, 28, 24, -4, 7, -3, 1, -1, -3, -1, -4, -1, 1 },
+    { -28, -31, -27, -30, -21, -23, -24, -28, -19, -23, -30, -19, 11, 30, 41, 8, 22, 17, 11, 20, 22, 31, 33, -5, -3, -11, 2, 9, -4, 7, -8, -38, -42, -36, -41, -30, -30, -35, -29, -35, -40, -28, 16, 18, 20, 12, 12, 37, 25, 39, 22, 33, -11, -6, -14, 14, 13, 1, 4, -12, 54, 53, 52, 50, 54, 47, 45, 51, 46, 44, 43, 44, 72, 74, 78, 82, 74, 75, 77, 5, -3, 10, 6, -10, -5, -53, -52, -62, -59, -62, -54, -84, -86, -86, -16, -8, -53, -56, -87, -96, -96, -96, -86, -80, -81, -87, 6, 4, -11, -13, -7, -22, -45, -38, -52, -44, -47, -53, -74, -71, -75, -9, -24, -40, -41, -71, -86, -86, -85, -69, -76, -70, -76, -8, 55, 11, 12, 10, 32, 39, 32, 4, 25, 7, 11, 9, 7, 14, 9, 9, 11 },
+    { -8, -12, -8, -8, -3, -5, -3, -6, 0, -3, -10, 0, 19, 37, 50, 15, 28, 29, 22, 32, 31, 42, 44, 13, 12, 5, 13, 17, 6, 14, 6, -21, -23, -18, -23, -13, -12, -18, -12, -16, -21, -10, 25, 31, 33, 20, 24, 46, 33, 49, 32, 46, 2, 10, 0, 20, 22, 8, 13, 4, 71, 70, 68, 67, 70, 64, 63, 69, 63, 61, 61, 61, 89, 90, 94, 99, 91, 92, 93, 7, 0, 18, 15, -6, 3, -44, -43, -52, -49, -53, -45, -74, -76, -76, -11, 2, -44, -47, -78, -86, -86, -86, -76, -70, -71, -77, 15, 13, -5, -7, 2, -14, -39, -33, -46, -40, -41, -47, -69, -66, -69, 1, -16, -35, -37, -67, -79, -80, -79, -63, -69, -63, -69, 2, 68, 20, 21, 19, 38, 49, 39, 12, 42, 17, 21, 19, 17, 28, 21, 19, 21 },
+    { 13, 8, 11, 14, 16, 13, 19, 16, 20, 17, 11, 19, 28, 45, 60, 23, 34, 42, 33, 45, 41, 53, 56, 31, 28, 21, 25, 25, 17, 21, 20, -3, -3, 1, -4, 5, 6, 0, 5, 3, -1, 9, 35, 44, 47, 28, 36, 55, 41, 59, 43, 59, 15, 26, 14, 27, 31, 16, 23, 21, 88, 88, 85, 84, 87, 81, 81, 87, 80, 79, 79, 79, 106, 106, 110, 116, 109, 110, 110, 10, 4, 27, 24, -1, 12, -34, -33, -41, -39, -43, -35, -64, -66, -66, -6, 12, -35, -38, -68, -76, -75, -75, -66, -60, -60, -66, 25, 23, 2, 0, 11, -5, -33, -28, -40, -35, -34, -41, -63, -60, -63, 11, -8, -30, -32, -63, -72, -73, -72, -56, -62, -56, -62, 12, 82, 30, 30, 29, 44, 60, 47, 20, 60, 28, 31, 30, 28, 43, 34, 29, 31 },
+    { 17, 12, 14, 18, 19, 16, 23, 20, 23, 20, 15, 21, 28, 44, 59, 22, 32, 40, 30, 43, 38, 51, 55, 33, 28, 23, 23, 22, 17, 19, 21, 0, 1, 5, -1, 8, 9, 2, 7, 6, 3, 12, 35, 42, 45, 27, 33, 54, 39, 58, 40, 57, 15, 27, 16, 25, 28, 15, 21, 23, 87, 87, 84, 83, 86, 80, 80, 86, 79, 78, 78, 78, 105, 105, 109, 115, 108, 109, 109, 9, 3, 26, 23, -3, 11, -35, -33, -42, -39, -44, -36, -65, -67, -67, -7, 11, -35, -38, -68, -77, -76, -76, -67, -61, -61, -67, 24, 22, 1, -1, 10, -6, -34, -29, -41, -36, -35, -42, -64, -61, -64, 10, -9, -31, -33, -64, -73, -74, -73, -57, -63, -57, -63, 11, 81, 29, 29, 28, 44, 59, 47, 19, 59, 27, 30, 29, 28, 42, 33, 28, 30 },
+    { 21, 16, 18, 23, 22, 19, 27, 25, 26, 23, 19, 24, 29, 43, 59, 22, 30, 38, 28, 42, 35, 50, 54, 36, 29, 26, 21, 19, 17, 17, 22, 3, 5, 9, 3, 11, 13, 5, 10, 9, 7, 15, 35, 40, 44, 27, 31, 54, 38, 58, 38, 56, 16, 28, 18, 23, 25, 14, 19, 25, 87, 87, 83, 83, 86, 79, 79, 85, 79, 78, 77, 78, 105, 105, 109, 115, 108, 108, 109, 8, 2, 25, 22, -4, 10, -35, -33, -42, -39, -44, -36, -65, -67, -67, -8, 10, -35, -38, -68, -77, -76, -76, -67, -61, -61, -67, 23, 21, 1, -1, 9, -7, -34, -30, -41, -36, -35, -42, -64, -61, -64, 9, -10, -31, -33, -64, -74, -74, -73, -57, -64, -57, -64, 10, 81, 29, 28, 27, 45, 58, 47, 18, 58, 26, 30, 28, 28, 42, 33, 27, 29 },
+    { 25, 20, 21, 28, 25, 22, 31, 29, 29, 26, 23, 27, 29, 42, 59, 22, 28, 36, 25, 41, 32, 48, 53, 38, 30, 29, 19, 16, 17, 15, 23, 6, 9, 13, 6, 14, 16, 7, 13, 12, 11, 18, 35, 38, 43, 26, 28, 53, 36, 58, 35, 55, 16, 29, 20, 21, 22, 13, 17, 27, 86, 86, 82, 82, 85, 78, 78, 84, 78, 77, 76, 77, 104, 105, 108, 114, 107, 107, 108, 7, 1, 24, 21, -5, 9, -36, -33, -43, -39, -44, -37, -65, -67, -67, -9, 9, -35, -38, -68, -77, -76, -76, -67, -61, -61, -67, 22, 20, 0, -2, 8, -8, -35, -31, -42, -37, -36, -43, -64, -62, -65, 8, -11, -32, -34, -64, -75, -75, -74, -58, -65, -58, -65, 9, 80, 28, 27, 26, 45, 57, 47, 17, 57, 25, 29, 27, 28, 41, 33, 26, 28 },
+};
+
+static int8_t grunt_pvs_vz[GRUNT_PVS_FRAMES][GRUNT_PVS_VERTICES] = {
+    { 73, 75, 71, 79, 59, 62, 72, 78, 62, 70, 78, 64, -16, -29, -27, -18, -33, -2, -8, -4, -20, -16, -14, 40, 34, 37, 0, -18, 3, -17, 34, 62, 68, 64, 69, 55, 56, 65, 57, 70, 70, 62, -13, 9, 8, -13, 9, -11, -7, -11, 6, 4, 33, 40, 28, -7, 5, -4, 6, 37, 5, 5, 1, 4, 16, 7, 12, 16, 23, 13, 17, 24, 30, 29, 16, 17, 18, 5, 4, 30, 20, 5, -5, 17, 5, -20, -33, -21, -36, -31, -25, -6, -7, -3, 10, -15, -41, -49, -27, -4, 7, 7, 34, 34, 36, 36, 7, -11, 22, 6, 7, 19, -26, -42, -28, -45, -24, -28, -28, -22, -16, -16, 5, -40, -46, -40, -7, -21, -19, 2, 2, 11, 11, -13, -10, -22, -18, -14, -39, -19, -24, 13, 21, 2, -2, 4, -9, 9, 6, -6, -13 },
+    { 71, 73, 69, 78, 58, 60, 71, 77, 61, 69, 76, 63, -16, -30, -28, -19, -34, -3, -10, -6, -23, -17, -16, 39, 33, 36, -1, -21, 1, -19, 32, 68, 75, 70, 75, 61, 61, 70, 62, 75, 76, 67, -12, 9, 9, -14, 8, -11, -9, -10, 4, 5, 35, 43, 32, -10, 3, -5, 5, 41, 6, 6, 2, 5, 17, 7, 13, 17, 23, 14, 17, 25, 31, 30, 17, 18, 19, 6, 5, 30, 20, 5, -5, 17, 5, -20, -33, -21, -36, -31, -25, -6, -7, -3, 10, -16, -41, -49, -27, -4, 7, 7, 34, 34, 36, 36, 7, -11, 22, 6, 7, 19, -26, -42, -29, -46, -25, -29, -29, -23, -17, -16, 5, -41, -47, -41, -8, -22, -19, 1, 1, 10, 10, -14, -10, -22, -18, -15, -39, -19, -23, 13, 21, 2, -2, 4, -10, 9, 6, -7, -13 },
+    { 63, 65, 62, 70, 50, 52, 64, 70, 54, 63, 68, 56, -22, -36, -35, -24, -39, -8, -13, -11, -26, -23, -21, 33, 28, 27, -5, -23, -4, -23, 26, 64, 71, 66, 71, 57, 57, 66, 58, 71, 72, 63, -15, 6, 6, -17, 6, -14, -12, -13, 2, 2, 32, 39, 28, -12, 1, -7, 2, 37, 0, 0, -5, -2, 11, 0, 5, 10, 17, 7, 10, 18, 26, 25, 13, 14, 14, 1, 0, 26, 15, 1, -10, 14, 1, -26, -39, -27, -42, -37, -30, -12, -12, -9, 6, -20, -46, -54, -33, -10, 1, 1, 29, 29, 31, 31, 2, -16, 17, 1, 2, 13, -34, -50, -36, -53, -32, -37, -36, -31, -25, -21, 0, -48, -55, -49, -15, -29, -26, -5, -5, 3, 3, -18, -19, -26, -23, -20, -45, -25, -25, 9, 14, -2, -6, 0, -14, 3, 3, -12, -17 },
+    { 38, 40, 38, 45, 27, 29, 41, 46, 32, 41, 44, 35, -38, -45, -47, -38, -46, -18, -21, -21, -31, -31, -31, 14, 11, 5, -14, -28, -19, -31, 7, 39, 46, 42, 46, 33, 34, 41, 34, 47, 47, 39, -31, -10, -12, -28, -7, -35, -26, -37, -12, -20, 11, 19, 7, -21, -9, -16, -6, 16, -20, -22, -31, -30, -9, -21, -20, -9, -4, -14, -13, -3, 10, 8, -3, 0, 0, -12, -14, 13, 0, -10, -24, 4, -11, -38, -51, -39, -54, -49, -42, -24, -24, -21, -5, -32, -58, -66, -45, -21, -10, -9, 17, 17, 19, 19, -10, -29, 1, -13, -11, -4, -54, -70, -58, -74, -53, -58, -57, -52, -46, -37, -18, -69, -75, -71, -35, -49, -46, -25, -25, -15, -15, -32, -46, -37, -37, -36, -55, -47, -47, -3, -6, -14, -16, -15, -21, -12, -15, -27, -28 },
+    { 21, 22, 22, 27, 14, 15, 26, 29, 19, 27, 27, 22, -38, -35, -39, -35, -33, -13, -13, -16, -18, -22, -23, 6, 7, -3, -8, -15, -18, -21, 1, 28, 35, 31, 35, 22, 23, 30, 23, 36, 36, 29, -39, -18, -21, -36, -14, -44, -33, -47, -19, -31, 1, 10, -1, -28, -15, -23, -13, 6, -26, -32, -39, -41, -14, -27, -31, -19, -11, -21, -24, -12, 4, 5, -4, -2, -5, -16, -15, 11, -2, -11, -26, 5, -13, -37, -50, -38, -53, -48, -41, -23, -23, -20, -6, -33, -57, -65, -44, -21, -9, -9, 18, 18, 20, 20, -12, -30, -3, -17, -15, -11, -61, -76, -65, -81, -60, -66, -64, -59, -53, -40, -24, -75, -82, -79, -42, -56, -53, -31, -31, -22, -22, -35, -53, -36, -38, -39, -45, -50, -56, -5, -14, -16, -15, -18, -17, -17, -24, -30, -27 },
+    { 20, 22, 22, 24, 15, 17, 25, 26, 20, 28, 26, 24, -20, -19, -28, -15, -13, 0, 3, -4, 0, -9, -12, 10, 14, 0, 9, 5, -3, 0, 9, 45, 50, 45, 52, 36, 36, 47, 37, 50, 51, 40, -30, -18, -19, -32, -18, -47, -43, -47, -31, -32, 11, 15, 7, -41, -29, -26, -20, 13, -20, -29, -30, -32, -6, -19, -24, -19, -4, -13, -17, -8, -1, 5, -3, -8, -14, -23, -16, 16, 3, -6, -20, 9, -7, -34, -47, -35, -50, -45, -38, -20, -21, -18, -1, -29, -54, -62, -41, -18, -6, -6, 20, 20, 22, 23, -6, -25, 4, -8, -8, -2, -58, -73, -63, -78, -57, -63, -61, -56, -49, -34, -14, -72, -78, -76, -38, -52, -49, -28, -27, -18, -18, -29, -44, -33, -33, -33, -34, -43, -50, 0, -4, -11, -11, -12, -6, -9, -15, -24, -23 },
+    { 35, 36, 36, 40, 28, 30, 41, 43, 34, 41, 41, 37, -10, -15, -25, -5, -8, 6, 10, 1, 3, -5, -8, 23, 24, 12, 19, 11, 7, 6, 18, 44, 45, 41, 49, 36, 34, 47, 38, 46, 45, 37, -15, 0, -2, -13, 3, -28, -19, -29, -6, -12, 23, 19, 15, -13, -2, -3, 3, 16, -13, -17, -19, -18, 0, -10, -9, -7, 4, -4, -4, 2, 5, 9, -2, -6, -9, -19, -15, 18, 6, -7, -19, 10, -6, -38, -51, -40, -54, -50, -42, -26, -27, -24, 0, -28, -58, -67, -47, -26, -14, -14, 13, 13, 16, 16, -7, -25, 9, -3, -6, 4, -57, -72, -62, -77, -56, -62, -60, -55, -49, -32, -8, -71, -77, -75, -37, -51, -49, -27, -27, -18, -18, -28, -33, -36, -33, -31, -34, -37, -36, 0, 4, -11, -15, -11, -4, -4, -4, -22, -27 },
+    { 74, 76, 74, 81, 63, 65, 77, 82, 67, 77, 81, 71, -3, -11, -14, 0, -8, 15, 14, 11, 4, 2, 1, 48, 47, 41, 24, 11, 19, 8, 43, 52, 53, 50, 58, 46, 45, 58, 50, 58, 54, 50, 5, 22, 16, 13, 29, -2, 12, -5, 23, 8, 41, 38, 30, 23, 32, 28, 34, 31, 2, 4, 0, 1, 10, 5, 10, 15, 18, 11, 14, 22, 25, 20, 6, 10, 14, 0, -4, 27, 15, 0, -12, 24, 3, -27, -40, -28, -43, -38, -31, -15, -16, -13, 14, -18, -47, -55, -36, -15, -3, -3, 24, 24, 26, 26, 0, -17, 17, 4, 2, 12, -48, -63, -53, -68, -46, -52, -52, -47, -40, -24, 0, -62, -68, -66, -29, -44, -41, -20, -19, -10, -10, -20, -14, -27, -26, -25, -24, -23, -18, 9, 18, -4, -7, -5, 3, 5, 6, -16, -18 },
+    { 74, 75, 71, 81, 60, 62, 73, 80, 64, 71, 78, 65, -19, -20, -12, -23, -27, 3, -5, 2, -11, -2, 0, 44, 36, 40, 0, -15, 2, -16, 35, 65, 73, 68, 70, 58, 60, 62, 56, 67, 73, 61, -13, 7, 7, -16, 5, -15, -15, -14, 0, 2, 27, 36, 32, -17, -3, -9, 0, 40, 14, 13, 11, 10, 23, 17, 17, 24, 30, 22, 22, 31, 40, 37, 24, 27, 29, 15, 12, 28, 17, 0, -12, 27, 5, -26, -40, -28, -43, -38, -30, -13, -14, -11, 17, -16, -47, -55, -34, -11, 0, 0, 28, 28, 30, 30, 0, -15, 21, 9, 4, 17, -56, -70, -62, -76, -55, -62, -61, -56, -49, -22, 5, -69, -76, -76, -38, -52, -49, -27, -27, -18, -18, -18, -4, -25, -26, -26, -28, -16, -27, 9, 24, -4, -5, -6, -4, 8, 0, -17, -16 },
+    { 33, 28, 27, 38, 27, 25, 37, 38, 31, 31, 32, 29, -7, 4, 12, -12, -4, 15, 5, 17, 7, 19, 21, 30, 20, 21, 3, -4, 0, -8, 13, 51, 58, 54, 52, 47, 50, 45, 43, 50, 57, 48, 0, 15, 17, -8, 9, 0, -6, 3, 4, 15, 20, 31, 31, -16, -3, -9, 0, 38, 40, 38, 39, 39, 48, 44, 44, 46, 55, 48, 48, 55, 55, 55, 41, 41, 43, 30, 29, 47, 37, 16, 6, 46, 23, -12, -25, -14, -29, -23, -15, 0, 0, 2, 37, 1, -32, -40, -21, 1, 13, 13, 41, 41, 43, 43, 16, 2, 41, 30, 21, 35, -44, -57, -51, -64, -43, -51, -49, -45, -38, -5, 25, -57, -64, -65, -25, -39, -37, -15, -15, -5, -5, -1, 25, -8, -7, -6, -7, 9, -9, 26, 47, 12, 10, 11, 8, 27, 13, 1, 0 },
+    { 36, 32, 33, 41, 31, 30, 42, 43, 36, 39, 38, 37, -2, 12, 18, -5, 5, 21, 13, 22, 17, 25, 27, 35, 29, 23, 12, 7, 4, 2, 21, 50, 59, 55, 53, 48, 51, 46, 45, 53, 58, 51, 1, 18, 20, -5, 12, 7, 0, 9, 10, 21, 23, 36, 32, -9, 1, -6, 2, 41, 45, 42, 45, 44, 54, 50, 48, 49, 60, 53, 52, 58, 59, 61, 48, 45, 45, 33, 35, 48, 38, 16, 6, 47, 24, -9, -23, -11, -26, -21, -13, 2, 1, 4, 39, 2, -30, -38, -18, 3, 15, 15, 43, 43, 45, 45, 16, 3, 42, 32, 22, 36, -45, -58, -53, -66, -45, -54, -51, -46, -39, -5, 27, -58, -65, -67, -26, -41, -38, -16, -16, -7, -7, 0, 32, -6, -7, -6, -3, 14, -5, 26, 48, 12, 11, 10, 8, 27, 14, 1, 1 },
+    { 38, 35, 36, 43, 33, 32, 44, 45, 39, 42, 41, 39, -3, 13, 19, -6, 7, 19, 12, 20, 18, 25, 26, 36, 31, 24, 12, 8, 4, 3, 23, 59, 68, 64, 62, 56, 58, 56, 53, 62, 67, 59, 1, 17, 20, -5, 11, 8, 0, 11, 9, 22, 28, 41, 36, -11, 0, -7, 1, 46, 46, 44, 46, 46, 55, 50, 49, 51, 60, 53, 53, 59, 61, 62, 49, 47, 47, 35, 37, 47, 38, 15, 6, 47, 23, -11, -24, -13, -28, -22, -14, 0, 0, 3, 39, 2, -31, -39, -20, 1, 13, 13, 41, 41, 44, 44, 15, 2, 42, 32, 21, 35, -47, -60, -55, -67, -47, -56, -52, -48, -41, -5, 26, -60, -67, -69, -28, -42, -39, -18, -18, -8, -8, -1, 34, -7, -7, -7, -3, 15, -3, 25, 48, 11, 11, 9, 6, 26, 13, 0, 0 },
+    { 33, 29, 29, 38, 28, 26, 39, 39, 33, 35, 34, 33, -5, 11, 18, -8, 3, 16, 8, 18, 13, 23, 24, 32, 25, 21, 7, 2, 1, -1, 17, 58, 66, 63, 61, 55, 57, 55, 52, 61, 66, 59, 3, 19, 21, -4, 13, 7, -1, 10, 9, 21, 28, 41, 35, -11, 0, -6, 3, 46, 47, 44, 47, 46, 57, 50, 49, 50, 61, 53, 53, 59, 62, 65, 53, 49, 48, 37, 40, 47, 38, 14, 5, 47, 23, -12, -26, -14, -29, -24, -16, -1, -2, 0, 39, 1, -32, -41, -22, 0, 11, 11, 39, 39, 41, 41, 15, 2, 42, 32, 21, 36, -47, -59, -54, -67, -46, -55, -53, -48, -41, -5, 26, -59, -67, -69, -29, -43, -40, -18, -18, -9, -9, -1, 34, -7, -8, -7, -4, 15, -3, 25, 47, 11, 10, 9, 5, 25, 13, 0, 0 },
+    { 32, 27, 27, 37, 27, 25, 37, 38, 31, 33, 32, 31, -5, 8, 16, -8, 0, 17, 8, 18, 12, 21, 23, 31, 23, 21, 7, 1, 1, -3, 15, 47, 55, 53, 50, 46, 49, 45, 44, 52, 56, 51, 4, 21, 23, -1, 16, 8, 1, 12, 12, 23, 23, 38, 30, -8, 4, -3, 6, 41, 47, 46, 47, 47, 55, 50, 50, 53, 61, 53, 54, 61, 64, 65, 52, 51, 51, 39, 39, 46, 38, 14, 5, 47, 23, -12, -26, -14, -29, -24, -16, -1, -2, 1, 39, 1, -33, -41, -22, 0, 12, 12, 40, 40, 42, 42, 14, 2, 41, 32, 21, 35, -46, -59, -54, -66, -46, -55, -52, -47, -40, -5, 26, -59, -67, -68, -28, -42, -39, -17, -17, -8, -8, -1, 35, -8, -8, -7, -5, 15, -1, 25, 47, 11, 10, 9, 4, 25, 13, 0, 0 },
+    { 16, 10, 10, 20, 12, 9, 20, 21, 16, 15, 14, 14, -7, 2, 12, -13, -7, 13, 2, 14, 4, 16, 18, 19, 10, 10, 0, -8, -6, -13, 2, 35, 43, 42, 38, 36, 39, 34, 34, 41, 43, 41, 6, 26, 26, 2, 23, 11, 7, 13, 20, 26, 19, 34, 25, 0, 14, 2, 14, 35, 45, 44, 45, 46, 54, 48, 49, 51, 59, 51, 52, 59, 64, 64, 51, 50, 51, 38, 39, 44, 36, 11, 3, 45, 20, -14, -28, -16, -31, -26, -18, -3, -4, 0, 38, 0, -35, -43, -24, -2, 9, 9, 38, 38, 40, 40, 12, 0, 39, 30, 19, 33, -49, -62, -57, -69, -49, -58, -55, -50, -43, -8, 24, -62, -69, -71, -30, -45, -42, -20, -20, -11, -11, -3, 34, -10, -10, -10, -8, 14, -1, 22, 44, 9, 8, 6, 1, 22, 12, -2, -2 },
+    { 8, 1, 2, 11, 5, 2, 12, 12, 9, 6, 5, 6, -6, 1, 13, -11, -8, 14, 3, 14, 3, 15, 18, 14, 5, 5, -1, -10, -8, -15, -2, 30, 37, 37, 33, 31, 34, 30, 30, 37, 38, 38, 5, 26, 26, 2, 23, 12, 8, 15, 21, 27, 17, 33, 21, 2, 15, 2, 14, 32, 45, 45, 46, 47, 53, 48, 49, 52, 59, 51, 52, 59, 64, 63, 50, 50, 51, 38, 38, 43, 36, 10, 3, 44, 20, -14, -28, -16, -31, -26, -18, -2, -3, 0, 37, 0, -35, -43, -23, 0, 11, 11, 39, 39, 41, 41, 11, 0, 39, 30, 18, 33, -49, -62, -56, -69, -49, -57, -54, -50, -42, -8, 24, -62, -69, -70, -29, -44, -41, -19, -19, -10, -10, -4, 34, -10, -11, -10, -6, 14, 0, 21, 43, 8, 7, 6, 1, 21, 12, -3, -3 },
+    { -10, -17, -16, -8, -11, -14, -6, -7, -7, -11, -13, -10, -7, -3, 9, -13, -14, 12, 0, 13, -2, 12, 15, 1, -7, -6, -7, -16, -15, -21, -14, 0, 6, 7, 1, 4, 7, 0, 3, 7, 7, 10, -2, 12, 15, -10, 5, 4, -6, 8, 3, 18, -4, 11, 0, -18, -7, -18, -7, 10, 42, 41, 42, 43, 51, 44, 45, 48, 56, 48, 48, 55, 61, 62, 50, 49, 48, 36, 37, 40, 33, 7, 0, 40, 16, -17, -31, -20, -35, -30, -22, -5, -7, -3, 34, -4, -38, -47, -27, -4, 7, 7, 35, 35, 37, 37, 8, -3, 36, 26, 15, 30, -50, -64, -58, -71, -50, -59, -55, -51, -44, -11, 21, -64, -71, -72, -31, -45, -42, -21, -21, -11, -11, -7, 30, -14, -14, -14, -9, 10, -5, 18, 40, 5, 4, 3, 0, 18, 7, -6, -6 },
+    { 5, 0, 0, 9, 0, -2, 8, 9, 4, 2, 3, 1, -17, -15, -5, -22, -25, 4, -5, 4, -10, 1, 4, 6, -3, 0, -9, -21, -16, -26, -10, -18, -12, -12, -19, -14, -11, -21, -17, -15, -12, -11, -14, -3, 0, -23, -9, -19, -28, -14, -18, -2, -25, -11, -16, -38, -27, -31, -22, -7, 25, 22, 22, 22, 36, 27, 26, 30, 39, 31, 30, 38, 49, 51, 40, 39, 36, 25, 27, 28, 20, -3, -12, 26, 3, -30, -44, -32, -48, -42, -34, -18, -19, -15, 19, -17, -51, -59, -39, -16, -4, -4, 23, 23, 25, 25, -2, -16, 22, 12, 2, 17, -60, -74, -67, -81, -60, -68, -65, -61, -54, -24, 7, -74, -82, -81, -41, -55, -52, -31, -31, -21, -21, -20, 8, -27, -27, -25, -22, -9, -24, 6, 27, -6, -8, -7, -6, 7, -3, -17, -19 },
+    { 27, 23, 21, 33, 18, 17, 30, 33, 22, 24, 27, 21, -21, -26, -21, -24, -32, -1, -9, -3, -18, -10, -8, 16, 6, 9, -7, -22, -11, -26, 1, 8, 15, 14, 9, 8, 11, 4, 5, 11, 15, 12, -14, 2, 3, -19, 0, -20, -22, -17, -9, -1, -9, 4, 0, -26, -13, -19, -8, 8, 12, 10, 8, 10, 24, 13, 16, 19, 28, 19, 20, 27, 37, 38, 26, 26, 24, 12, 13, 24, 14, -6, -16, 17, -2, -32, -46, -33, -49, -44, -36, -18, -19, -16, 9, -24, -53, -61, -39, -16, -5, -4, 22, 22, 24, 24, -5, -21, 17, 5, -2, 11, -55, -70, -60, -75, -54, -61, -59, -54, -47, -28, 0, -70, -77, -74, -36, -50, -47, -25, -25, -16, -16, -25, -5, -32, -30, -28, -37, -19, -28, 3, 19, -9, -12, -9, -13, 2, -3, -20, -23 },
+    { 44, 42, 41, 51, 33, 33, 47, 51, 38, 44, 47, 39, -23, -29, -27, -25, -32, -2, -8, -5, -17, -13, -12, 25, 19, 16, -2, -18, -7, -21, 13, 45, 53, 50, 50, 41, 43, 45, 41, 53, 54, 48, -12, 10, 7, -9, 12, -13, -6, -14, 7, 2, 20, 32, 21, -3, 9, 0, 11, 31, 2, 2, -1, 0, 13, 4, 8, 12, 19, 10, 12, 20, 28, 28, 15, 16, 16, 3, 3, 21, 11, -6, -17, 11, -4, -28, -41, -29, -44, -39, -33, -13, -14, -11, 3, -26, -49, -56, -34, -13, -1, -1, 26, 26, 28, 28, -4, -22, 14, 0, -3, 9, -43, -59, -46, -63, -42, -47, -46, -40, -34, -28, -3, -58, -65, -59, -24, -38, -36, -14, -14, -5, -5, -25, -15, -33, -31, -28, -42, -25, -28, 2, 15, -9, -13, -8, -14, 0, -1, -19, -24 },
+    { 64, 66, 63, 70, 52, 54, 65, 71, 56, 65, 70, 59, -18, -30, -29, -19, -33, -2, -8, -5, -20, -16, -15, 35, 32, 29, 0, -17, 0, -17, 29, 58, 64, 60, 65, 52, 53, 62, 54, 67, 66, 59, -9, 13, 9, -4, 17, -9, 0, -10, 14, 4, 35, 41, 28, 6, 18, 9, 19, 36, 0, 0, -5, -2, 10, 0, 5, 10, 16, 6, 10, 17, 25, 23, 11, 12, 13, 0, -1, 22, 11, -2, -14, 11, -2, -21, -34, -21, -36, -31, -25, -5, -7, -3, 2, -24, -41, -49, -26, -5, 5, 5, 33, 32, 35, 35, -1, -19, 14, 0, 0, 10, -34, -50, -36, -53, -32, -36, -36, -30, -24, -25, -2, -49, -55, -48, -15, -29, -26, -5, -5, 3, 3, -22, -18, -30, -27, -24, -40, -26, -25, 5, 14, -5, -9, -4, -9, 2, 1, -16, -21 },
+    { 64, 66, 63, 71, 51, 54, 65, 71, 55, 64, 70, 58, -20, -32, -30, -23, -36, -4, -10, -6, -22, -17, -16, 35, 30, 28, -3, -21, -2, -20, 28, 53, 58, 55, 60, 47, 47, 57, 49, 61, 60, 54, -13, 10, 7, -9, 12, -10, -1, -12, 12, 3, 31, 37, 24, 3, 14, 3, 13, 32, -1, -1, -5, -2, 9, 0, 5, 9, 16, 6, 10, 17, 23, 22, 9, 10, 11, -1, -3, 24, 12, 0, -11, 13, 0, -16, -29, -15, -31, -26, -21, 0, -2, 1, 4, -21, -36, -44, -20, -1, 10, 10, 37, 37, 39, 39, 1, -17, 15, 0, 0, 10, -30, -46, -31, -49, -28, -32, -31, -25, -20, -24, -2, -44, -51, -43, -10, -24, -22, -1, -1, 7, 8, -20, -18, -26, -24, -22, -40, -25, -27, 8, 15, -2, -6, -2, -9, 4, 1, -13, -17 },
+    { 61, 62, 59, 69, 48, 50, 62, 68, 52, 60, 66, 54, -25, -34, -31, -27, -39, -6, -14, -8, -25, -19, -17, 33, 26, 27, -7, -25, -6, -25, 24, 51, 57, 54, 58, 45, 46, 54, 46, 59, 59, 52, -19, 4, 2, -18, 4, -15, -10, -16, 3, 0, 24, 33, 20, -9, 3, -8, 2, 29, -1, -1, -5, -2, 9, 0, 6, 9, 16, 7, 10, 18, 23, 21, 8, 9, 10, -2, -3, 25, 13, 0, -11, 13, 0, -19, -32, -19, -34, -29, -24, -4, -5, -2, 4, -21, -40, -47, -24, -3, 7, 7, 35, 35, 37, 37, 2, -16, 15, 0, 1, 12, -29, -45, -31, -48, -27, -31, -31, -25, -19, -22, -1, -44, -50, -43, -10, -25, -22, -1, -1, 8, 8, -19, -17, -26, -24, -21, -42, -24, -31, 8, 15, -2, -6, -1, -11, 4, 0, -12, -17 },
+    { 68, 69, 66, 74, 54, 57, 67, 74, 57, 65, 72, 59, -21, -32, -30, -23, -36, -5, -12, -7, -24, -18, -17, 36, 29, 33, -4, -22, -1, -22, 29, 57, 64, 60, 64, 51, 52, 60, 52, 65, 65, 57, -17, 5, 4, -18, 5, -15, -12, -15, 2, 0, 28, 36, 24, -12, 0, -9, 1, 33, 1, 2, -1, 1, 12, 3, 9, 12, 19, 10, 13, 21, 26, 25, 12, 13, 14, 1, 0, 27, 17, 2, -8, 15, 3, -22, -35, -23, -38, -33, -27, -8, -9, -5, 7, -18, -43, -50, -29, -6, 5, 5, 32, 32, 34, 35, 4, -14, 19, 3, 5, 16, -28, -44, -31, -48, -27, -31, -31, -25, -19, -19, 2, -43, -49, -43, -10, -24, -21, 0, 0, 8, 8, -16, -14, -24, -21, -18, -41, -22, -28, 11, 17, 0, -4, 1, -11, 6, 2, -9, -16 },
+    { 73, 75, 71, 79, 59, 62, 72, 78, 62, 70, 78, 64, -16, -29, -27, -18, -33, -2, -8, -4, -20, -16, -14, 40, 34, 37, 0, -18, 3, -17, 34, 62, 68, 64, 69, 55, 56, 65, 57, 70, 70, 62, -13, 9, 8, -13, 9, -11, -7, -11, 6, 4, 33, 40, 28, -7, 5, -4, 6, 37, 5, 5, 1, 4, 16, 7, 12, 16, 23, 13, 17, 24, 30, 29, 16, 17, 18, 5, 4, 30, 20, 5, -5, 17, 5, -20, -33, -21, -36, -31, -25, -6, -7, -3, 10, -15, -41, -49, -27, -4, 7, 7, 34, 34, 36, 36, 7, -11, 22, 6, 7, 19, -26, -42, -28, -45, -24, -28, -28, -22, -16, -16, 5, -40, -46, -40, -7, -21, -19, 2, 2, 11, 11, -13, -10, -22, -18, -14, -39, -19, -24, 13, 21, 2, -2, 4, -9, 9, 6, -6, -13 },
+    { 60, 61, 58, 66, 47, 50, 60, 65, 51, 59, 65, 53, -22, -31, -30, -23, -33, -5, -10, -7, -20, -18, -17, 31, 27, 27, -2, -18, -3, -18, 25, 53, 59, 55, 60, 46, 47, 56, 48, 61, 61, 53, -20, 2, 0, -19, 3, -20, -14, -20, -1, -5, 25, 32, 20, -13, 0, -9, 1, 29, -3, -5, -9, -8, 8, -2, 1, 7, 14, 4, 6, 15, 23, 23, 11, 12, 12, -1, -1, 25, 14, 1, -11, 14, 0, -25, -38, -26, -41, -36, -29, -11, -11, -8, 6, -20, -45, -53, -32, -9, 3, 3, 30, 30, 32, 32, 2, -16, 15, 0, 1, 11, -35, -51, -38, -54, -33, -38, -37, -32, -26, -22, -3, -49, -55, -50, -16, -30, -28, -7, -7, 2, 2, -19, -21, -26, -23, -21, -41, -27, -32, 8, 12, -3, -6, -2, -11, 2, -2, -12, -17 },
+    { 47, 48, 46, 53, 36, 38, 49, 53, 40, 48, 52, 43, -27, -32, -33, -27, -33, -8, -11, -10, -19, -19, -19, 23, 20, 17, -4, -17, -8, -19, 17, 45, 51, 47, 52, 38, 39, 47, 40, 53, 53, 45, -26, -5, -7, -25, -3, -28, -20, -29, -7, -14, 17, 25, 13, -18, -5, -14, -4, 21, -11, -14, -19, -19, 1, -10, -10, -2, 6, -4, -4, 6, 17, 17, 6, 7, 6, -6, -6, 20, 9, -3, -16, 11, -4, -29, -42, -30, -45, -40, -33, -15, -15, -12, 2, -24, -49, -57, -36, -13, -1, -1, 26, 26, 28, 28, -3, -21, 9, -6, -4, 4, -44, -59, -47, -63, -42, -47, -46, -41, -35, -28, -10, -58, -64, -60, -25, -39, -36, -15, -15, -6, -6, -24, -32, -29, -28, -27, -42, -35, -40, 4, 3, -7, -9, -7, -13, -4, -9, -18, -20 },
+    { 34, 35, 34, 40, 25, 26, 37, 41, 29, 37, 39, 32, -33, -34, -36, -31, -33, -11, -12, -13, -19, -21, -21, 14, 13, 7, -6, -16, -13, -20, 9, 36, 43, 39, 43, 30, 31, 38, 31, 44, 44, 37, -33, -12, -14, -31, -9, -36, -27, -38, -13, -23, 9, 17, 6, -23, -10, -19, -9, 13, -19, -23, -29, -30, -7, -19, -21, -11, -3, -13, -14, -3, 10, 11, 1, 2, 0, -11, -11, 15, 3, -7, -21, 8, -9, -33, -46, -34, -49, -44, -37, -19, -19, -16, -2, -29, -53, -61, -40, -17, -5, -5, 22, 22, 24, 24, -8, -26, 3, -12, -10, -4, -53, -68, -56, -72, -51, -57, -55, -50, -44, -34, -17, -67, -73, -70, -34, -48, -45, -23, -23, -14, -14, -30, -43, -33, -33, -33, -44, -43, -48, -1, -6, -12, -12, -13, -15, -11, -17, -24, -24 },
+    { 21, 22, 22, 27, 14, 15, 26, 29, 19, 27, 27, 22, -38, -35, -39, -35, -33, -13, -13, -16, -18, -22, -23, 6, 7, -3, -8, -15, -18, -21, 1, 28, 35, 31, 35, 22, 23, 30, 23, 36, 36, 29, -39, -18, -21, -36, -14, -44, -33, -47, -19, -31, 1, 10, -1, -28, -15, -23, -13, 6, -26, -32, -39, -41, -14, -27, -31, -19, -11, -21, -24, -12, 4, 5, -4, -2, -5, -16, -15, 11, -2, -11, -26, 5, -13, -37, -50, -38, -53, -48, -41, -23, -23, -20, -6, -33, -57, -65, -44, -21, -9, -9, 18, 18, 20, 20, -12, -30, -3, -17, -15, -11, -61, -76, -65, -81, -60, -66, -64, -59, -53, -40, -24, -75, -82, -79, -42, -56, -53, -31, -31, -22, -22, -35, -53, -36, -38, -39, -45, -50, -56, -5, -14, -16, -15, -18, -17, -17, -24, -30, -27 },
+    { 34, 35, 34, 40, 25, 26, 37, 41, 30, 38, 39, 32, -34, -32, -33, -32, -32, -9, -11, -12, -17, -17, -18, 15, 14, 7, -6, -15, -13, -20, 9, 37, 44, 40, 43, 31, 32, 38, 31, 43, 45, 37, -33, -12, -14, -31, -10, -37, -29, -39, -15, -23, 7, 16, 7, -26, -12, -20, -10, 14, -16, -21, -27, -29, -5, -16, -19, -9, -1, -11, -13, -2, 13, 13, 3, 5, 3, -9, -9, 15, 2, -9, -23, 10, -9, -35, -48, -36, -51, -46, -39, -21, -21, -18, -1, -29, -55, -63, -42, -19, -7, -7, 20, 20, 22, 22, -9, -27, 3, -11, -11, -4, -60, -75, -65, -80, -59, -65, -64, -59, -52, -36, -17, -74, -81, -79, -41, -55, -52, -30, -30, -21, -21, -31, -41, -34, -35, -36, -41, -42, -49, -2, -5, -13, -13, -15, -14, -11, -18, -27, -25 },
+    { 47, 48, 46, 54, 37, 38, 49, 54, 41, 49, 52, 43, -29, -28, -26, -29, -30, -5, -9, -7, -15, -12, -12, 25, 21, 18, -4, -15, -8, -19, 18, 46, 54, 49, 52, 40, 41, 46, 39, 51, 54, 45, -26, -6, -7, -26, -5, -30, -24, -31, -10, -15, 14, 23, 15, -23, -9, -16, -7, 23, -6, -10, -14, -16, 4, -5, -7, 2, 9, 0, -1, 9, 22, 21, 10, 12, 12, -1, -2, 19, 7, -6, -19, 16, -4, -32, -45, -33, -48, -43, -36, -18, -19, -16, 5, -25, -52, -60, -39, -16, -5, -5, 23, 23, 25, 25, -6, -23, 9, -4, -6, 3, -59, -73, -64, -79, -58, -64, -63, -58, -51, -31, -10, -72, -79, -78, -40, -54, -51, -29, -29, -20, -20, -27, -29, -31, -32, -33, -37, -33, -42, 2, 5, -10, -10, -12, -11, -5, -12, -24, -22 },
+    { 60, 61, 58, 67, 48, 50, 61, 67, 52, 60, 65, 54, -24, -24, -19, -26, -29, -1, -7, -3, -13, -7, -6, 34, 28, 29, -2, -15, -3, -18, 26, 55, 63, 58, 61, 49, 50, 54, 47, 59, 63, 53, -20, 0, 0, -21, 0, -23, -20, -23, -5, -7, 20, 29, 23, -20, -6, -13, -4, 31, 4, 1, -2, -3, 13, 6, 5, 13, 19, 11, 10, 20, 31, 29, 17, 19, 20, 7, 5, 23, 12, -3, -16, 21, 0, -29, -43, -31, -46, -41, -33, -16, -17, -14, 11, -21, -50, -58, -37, -14, -3, -3, 25, 25, 27, 27, -3, -19, 15, 2, -1, 10, -58, -72, -63, -78, -57, -63, -62, -57, -50, -27, -3, -71, -78, -77, -39, -53, -50, -28, -28, -19, -19, -23, -17, -28, -29, -30, -33, -25, -35, 5, 14, -7, -8, -9, -8, 1, -6, -21, -19 },
+    { 74, 75, 71, 81, 60, 62, 73, 80, 64, 71, 78, 65, -19, -20, -12, -23, -27, 3, -5, 2, -11, -2, 0, 44, 36, 40, 0, -15, 2, -16, 35, 65, 73, 68, 70, 58, 60, 62, 56, 67, 73, 61, -13, 7, 7, -16, 5, -15, -15, -14, 0, 2, 27, 36, 32, -17, -3, -9, 0, 40, 14, 13, 11, 10, 23, 17, 17, 24, 30, 22, 22, 31, 40, 37, 24, 27, 29, 15, 12, 28, 17, 0, -12, 27, 5, -26, -40, -28, -43, -38, -30, -13, -14, -11, 17, -16, -47, -55, -34, -11, 0, 0, 28, 28, 30, 30, 0, -15, 21, 9, 4, 17, -56, -70, -62, -76, -55, -62, -61, -56, -49, -22, 5, -69, -76, -76, -38, -52, -49, -27, -27, -18, -18, -18, -4, -25, -26, -26, -28, -16, -27, 9, 24, -4, -5, -6, -4, 8, 0, -17, -16 },
+    { 63, 63, 60, 70, 52, 53, 64, 69, 56, 62, 67, 57, -16, -13, -5, -20, -20, 6, -2, 6, -5, 4, 6, 41, 33, 35, 1, -11, 1, -13, 30, 63, 71, 66, 67, 57, 59, 60, 55, 65, 71, 60, -9, 10, 10, -13, 7, -10, -12, -8, 2, 6, 27, 37, 32, -16, -3, -9, 0, 41, 22, 20, 20, 19, 31, 25, 25, 30, 37, 29, 29, 38, 45, 44, 31, 32, 33, 20, 19, 32, 22, 3, -8, 32, 9, -23, -37, -25, -40, -35, -27, -10, -11, -9, 22, -12, -44, -52, -31, -9, 2, 2, 30, 30, 32, 32, 3, -11, 26, 14, 8, 21, -54, -68, -60, -74, -53, -61, -59, -54, -47, -18, 10, -67, -74, -75, -36, -50, -47, -25, -25, -16, -16, -14, 5, -21, -22, -22, -22, -9, -21, 13, 29, -1, -2, -3, -2, 12, 3, -13, -12 },
+    { 53, 52, 50, 59, 44, 44, 56, 59, 48, 53, 56, 49, -12, -5, 3, -16, -12, 9, 1, 10, 1, 10, 12, 38, 30, 30, 3, -7, 1, -9, 26, 61, 69, 65, 65, 56, 58, 58, 54, 64, 69, 60, -5, 13, 14, -10, 9, -4, -8, -2, 4, 11, 27, 38, 33, -14, -2, -8, 1, 43, 30, 28, 29, 28, 40, 33, 33, 37, 45, 37, 37, 45, 51, 51, 38, 38, 38, 26, 26, 37, 27, 7, -4, 37, 14, -19, -33, -21, -36, -31, -23, -7, -8, -6, 28, -8, -40, -48, -28, -6, 5, 5, 33, 33, 35, 35, 7, -7, 31, 20, 12, 26, -52, -65, -58, -72, -51, -59, -57, -52, -45, -14, 15, -64, -72, -73, -34, -48, -45, -23, -23, -14, -14, -10, 15, -16, -17, -17, -16, -1, -15, 17, 35, 3, 2, 1, 0, 16, 6, -9, -8 },
+    { 43, 40, 39, 48, 36, 35, 47, 49, 40, 44, 45, 41, -9, 3, 10, -12, -5, 12, 4, 14, 7, 16, 18, 35, 27, 25, 5, -3, 1, -5, 21, 59, 67, 64, 63, 55, 57, 56, 53, 62, 67, 59, -1, 16, 17, -7, 11, 1, -5, 4, 6, 16, 27, 39, 34, -13, -1, -7, 2, 44, 38, 36, 38, 37, 48, 41, 41, 43, 53, 45, 45, 52, 56, 58, 45, 43, 43, 31, 33, 42, 32, 10, 0, 42, 18, -16, -30, -18, -33, -28, -20, -4, -5, -3, 33, -4, -36, -45, -25, -3, 8, 8, 36, 36, 38, 38, 11, -3, 36, 26, 16, 31, -50, -62, -56, -70, -49, -57, -55, -50, -43, -10, 20, -62, -70, -71, -32, -46, -43, -21, -21, -12, -12, -6, 24, -12, -13, -12, -10, 7, -9, 21, 41, 7, 6, 5, 2, 20, 9, -5, -4 },
+    { 33, 29, 29, 38, 28, 26, 39, 39, 33, 35, 34, 33, -5, 11, 18, -8, 3, 16, 8, 18, 13, 23, 24, 32, 25, 21, 7, 2, 1, -1, 17, 58, 66, 63, 61, 55, 57, 55, 52, 61, 66, 59, 3, 19, 21, -4, 13, 7, -1, 10, 9, 21, 28, 41, 35, -11, 0, -6, 3, 46, 47, 44, 47, 46, 57, 50, 49, 50, 61, 53, 53, 59, 62, 65, 53, 49, 48, 37, 40, 47, 38, 14, 5, 47, 23, -12, -26, -14, -29, -24, -16, -1, -2, 0, 39, 1, -32, -41, -22, 0, 11, 11, 39, 39, 41, 41, 15, 2, 42, 32, 21, 36, -47, -59, -54, -67, -46, -55, -53, -48, -41, -5, 26, -59, -67, -69, -29, -43, -40, -18, -18, -9, -9, -1, 34, -7, -8, -7, -4, 15, -3, 25, 47, 11, 10, 9, 5, 25, 13, 0, 0 },
+    { 22, 17, 17, 26, 18, 16, 27, 27, 23, 23, 22, 22, -6, 7, 15, -10, -2, 15, 6, 16, 9, 20, 21, 24, 17, 14, 3, -3, -3, -6, 9, 43, 51, 49, 46, 42, 44, 41, 39, 47, 51, 46, 1, 17, 19, -6, 11, 6, -3, 9, 7, 20, 20, 33, 26, -13, -2, -9, 0, 37, 45, 43, 45, 45, 55, 48, 48, 49, 59, 51, 51, 58, 61, 64, 52, 49, 48, 36, 39, 45, 36, 12, 3, 45, 21, -14, -28, -16, -31, -26, -18, -2, -4, -1, 37, -1, -34, -43, -24, -1, 10, 10, 38, 38, 40, 40, 13, 0, 40, 30, 19, 34, -48, -61, -55, -68, -47, -56, -54, -49, -42, -7, 24, -61, -68, -70, -30, -44, -41, -19, -19, -10, -10, -3, 33, -9, -10, -9, -6, 13, -4, 23, 45, 9, 8, 7, 3, 23, 11, -2, -2 },
+    { 11, 6, 6, 15, 8, 6, 16, 16, 13, 12, 10, 11, -6, 4, 13, -11, -6, 14, 4, 15, 5, 17, 19, 16, 9, 7, 0, -7, -7, -11, 1, 29, 36, 35, 31, 29, 32, 27, 27, 34, 36, 34, 0, 15, 18, -7, 9, 5, -4, 9, 6, 19, 12, 26, 17, -15, -4, -12, -2, 28, 44, 42, 44, 44, 54, 47, 47, 49, 58, 50, 50, 57, 61, 63, 51, 49, 48, 36, 38, 43, 35, 10, 2, 43, 19, -15, -29, -17, -32, -27, -19, -3, -5, -2, 36, -2, -35, -44, -25, -2, 9, 9, 37, 37, 39, 39, 11, -1, 39, 29, 18, 33, -49, -62, -56, -69, -48, -57, -54, -50, -43, -8, 23, -62, -69, -71, -30, -44, -41, -20, -20, -10, -10, -4, 32, -11, -11, -11, -7, 12, -4, 21, 43, 8, 7, 6, 2, 21, 10, -3, -3 },
+    { 0, -6, -5, 3, -2, -4, 5, 4, 3, 0, -2, 0, -7, 0, 11, -12, -10, 13, 2, 14, 1, 14, 17, 8, 1, 0, -4, -12, -11, -16, -7, 14, 21, 21, 16, 16, 19, 13, 15, 20, 21, 22, -1, 13, 16, -9, 7, 4, -5, 8, 4, 18, 4, 18, 8, -17, -6, -15, -5, 19, 43, 41, 43, 43, 52, 45, 46, 48, 57, 49, 49, 56, 61, 62, 50, 49, 48, 36, 37, 41, 34, 8, 1, 41, 17, -16, -30, -19, -34, -29, -21, -4, -6, -3, 35, -3, -37, -46, -26, -3, 8, 8, 36, 36, 38, 38, 9, -2, 37, 27, 16, 31, -50, -63, -57, -70, -49, -58, -55, -51, -44, -10, 22, -63, -70, -72, -31, -45, -42, -21, -21, -11, -11, -6, 31, -13, -13, -13, -8, 11, -5, 19, 41, 6, 5, 4, 1, 19, 8, -5, -5 },
+    { -10, -17, -16, -8, -11, -14, -6, -7, -7, -11, -13, -10, -7, -3, 9, -13, -14, 12, 0, 13, -2, 12, 15, 1, -7, -6, -7, -16, -15, -21, -14, 0, 6, 7, 1, 4, 7, 0, 3, 7, 7, 10, -2, 12, 15, -10, 5, 4, -6, 8, 3, 18, -4, 11, 0, -18, -7, -18, -7, 10, 42, 41, 42, 43, 51, 44, 45, 48, 56, 48, 48, 55, 61, 62, 50, 49, 48, 36, 37, 40, 33, 7, 0, 40, 16, -17, -31, -20, -35, -30, -22, -5, -7, -3, 34, -4, -38, -47, -27, -4, 7, 7, 35, 35, 37, 37, 8, -3, 36, 26, 15, 30, -50, -64, -58, -71, -50, -59, -55, -51, -44, -11, 21, -64, -71, -72, -31, -45, -42, -21, -21, -11, -11, -7, 30, -14, -14, -14, -9, 10, -5, 18, 40, 5, 4, 3, 0, 18, 7, -6, -6 },
+    { 8, 3, 3, 11, 4, 3, 11, 12, 8, 8, 7, 7, -10, -10, -1, -15, -19, 8, -2, 8, -7, 5, 7, 9, 2, 2, -6, -17, -12, -20, -4, 14, 20, 20, 17, 16, 18, 15, 15, 22, 21, 22, -4, 12, 13, -9, 8, 0, -5, 3, 5, 14, 5, 18, 7, -12, -1, -12, -1, 16, 31, 30, 30, 31, 40, 33, 35, 38, 46, 37, 38, 45, 52, 52, 40, 39, 39, 27, 27, 35, 27, 4, -4, 32, 11, -18, -32, -21, -36, -31, -23, -5, -7, -3, 26, -9, -39, -48, -27, -5, 6, 6, 34, 34, 36, 36, 5, -7, 30, 19, 11, 25, -46, -61, -53, -67, -46, -54, -51, -46, -39, -15, 15, -61, -67, -66, -27, -41, -38, -17, -17, -8, -8, -11, 18, -18, -18, -17, -17, 1, -10, 14, 33, 2, 0, 1, -3, 14, 5, -9, -10 },
+    { 27, 24, 23, 31, 20, 20, 29, 32, 24, 27, 28, 24, -13, -17, -10, -16, -24, 5, -4, 4, -11, -2, 0, 18, 12, 11, -4, -17, -8, -19, 7, 29, 35, 33, 33, 28, 30, 31, 28, 37, 36, 34, -6, 12, 12, -7, 11, -3, -3, -1, 8, 11, 15, 26, 14, -6, 5, -5, 6, 23, 21, 20, 18, 20, 30, 22, 25, 29, 36, 27, 29, 36, 43, 42, 30, 30, 30, 18, 18, 31, 22, 2, -7, 25, 7, -19, -33, -21, -36, -31, -24, -5, -7, -3, 18, -14, -40, -48, -27, -5, 6, 6, 34, 33, 36, 36, 3, -11, 25, 13, 7, 20, -42, -57, -47, -62, -41, -48, -46, -41, -34, -18, 9, -57, -63, -60, -23, -37, -34, -13, -13, -4, -4, -15, 6, -22, -21, -19, -25, -8, -15, 11, 27, 0, -3, -1, -5, 10, 4, -11, -14 },
+    { 45, 45, 43, 50, 36, 37, 47, 51, 40, 46, 49, 41, -16, -24, -20, -18, -29, 1, -6, -1, -16, -9, -8, 26, 22, 20, -2, -17, -4, -18, 18, 43, 49, 46, 49, 40, 41, 46, 41, 52, 51, 46, -8, 12, 10, -6, 14, -6, -2, -6, 11, 7, 25, 33, 21, 0, 11, 2, 12, 29, 10, 10, 6, 9, 20, 11, 15, 19, 26, 16, 19, 26, 34, 32, 20, 21, 21, 9, 8, 26, 16, 0, -11, 18, 2, -20, -34, -21, -36, -31, -25, -5, -7, -3, 10, -19, -41, -49, -27, -5, 5, 5, 33, 32, 35, 35, 1, -15, 19, 6, 3, 15, -38, -54, -42, -58, -37, -42, -41, -36, -29, -22, 3, -53, -59, -54, -19, -33, -30, -9, -9, -1, -1, -19, -6, -26, -24, -22, -33, -17, -20, 8, 20, -3, -6, -3, -7, 6, 2, -14, -18 },
+    { 64, 66, 63, 70, 52, 54, 65, 71, 56, 65, 70, 59, -18, -30, -29, -19, -33, -2, -8, -5, -20, -16, -15, 35, 32, 29, 0, -17, 0, -17, 29, 58, 64, 60, 65, 52, 53, 62, 54, 67, 66, 59, -9, 13, 9, -4, 17, -9, 0, -10, 14, 4, 35, 41, 28, 6, 18, 9, 19, 36, 0, 0, -5, -2, 10, 0, 5, 10, 16, 6, 10, 17, 25, 23, 11, 12, 13, 0, -1, 22, 11, -2, -14, 11, -2, -21, -34, -21, -36, -31, -25, -5, -7, -3, 2, -24, -41, -49, -26, -5, 5, 5, 33, 32, 35, 35, -1, -19, 14, 0, 0, 10, -34, -50, -36, -53, -32, -36, -36, -30, -24, -25, -2, -49, -55, -48, -15, -29, -26, -5, -5, 3, 3, -22, -18, -30, -27, -24, -40, -26, -25, 5, 14, -5, -9, -4, -9, 2, 1, -16, -21 },
+    { 66, 68, 65, 72, 53, 56, 66, 72, 57, 66, 72, 60, -18, -30, -29, -19, -33, -2, -8, -5, -20, -16, -15, 36, 32, 31, 0, -18, 0, -17, 30, 59, 65, 61, 66, 52, 53, 62, 54, 67, 67, 59, -10, 12, 8, -7, 15, -10, -2, -11, 12, 4, 34, 40, 28, 2, 14, 5, 15, 36, 1, 1, -4, -1, 11, 1, 6, 11, 17, 7, 11, 18, 26, 24, 12, 13, 14, 1, 0, 24, 13, -1, -12, 12, -1, -21, -34, -21, -36, -31, -25, -6, -7, -3, 4, -22, -41, -49, -27, -5, 5, 5, 33, 32, 35, 35, 1, -17, 16, 1, 1, 12, -32, -48, -34, -51, -30, -34, -34, -28, -22, -23, -1, -47, -53, -46, -13, -27, -25, -4, -4, 5, 5, -20, -16, -28, -25, -22, -40, -25, -25, 7, 15, -4, -8, -2, -9, 3, 2, -14, -19 },
+    { 68, 70, 67, 74, 55, 58, 68, 74, 59, 67, 74, 61, -17, -30, -28, -19, -33, -2, -8, -5, -20, -16, -15, 37, 33, 33, 0, -18, 1, -17, 31, 60, 66, 62, 67, 53, 54, 63, 55, 68, 68, 60, -11, 11, 8, -9, 13, -10, -4, -11, 10, 4, 34, 40, 28, -1, 11, 2, 12, 36, 2, 2, -2, 1, 13, 3, 8, 13, 19, 9, 13, 20, 27, 26, 13, 14, 15, 2, 1, 26, 15, 1, -10, 14, 1, -21, -34, -21, -36, -31, -25, -6, -7, -3, 6, -20, -41, -49, -27, -5, 6, 6, 33, 33, 35, 35, 3, -15, 18, 3, 3, 14, -30, -46, -32, -49, -28, -32, -32, -26, -20, -21, 1, -45, -51, -44, -11, -25, -23, -2, -2, 7, 7, -18, -14, -26, -23, -19, -40, -23, -25, 9, 17, -2, -6, 0, -9, 5, 3, -11, -17 },
+    { 70, 72, 69, 76, 57, 60, 70, 76, 60, 68, 76, 62, -17, -30, -28, -19, -33, -2, -8, -5, -20, -16, -15, 38, 33, 35, 0, -18, 2, -17, 32, 61, 67, 63, 68, 54, 55, 64, 56, 69, 69, 61, -12, 10, 8, -11, 11, -11, -6, -11, 8, 4, 33, 40, 28, -4, 8, -1, 9, 36, 3, 3, -1, 2, 14, 5, 10, 14, 21, 11, 15, 22, 28, 27, 14, 15, 16, 3, 2, 28, 17, 3, -8, 15, 3, -21, -34, -21, -36, -31, -25, -6, -7, -3, 8, -18, -41, -49, -27, -5, 6, 6, 33, 33, 35, 35, 5, -13, 20, 4, 5, 16, -28, -44, -30, -47, -26, -30, -30, -24, -18, -19, 3, -43, -49, -42, -9, -23, -21, 0, 0, 9, 9, -16, -12, -24, -21, -17, -40, -21, -25, 11, 19, 0, -4, 2, -9, 7, 4, -9, -15 },
+};
+
+static uint8_t grunt_pvs_fi[] = {
+    0, 0, 4, 4, 6, 6, 8, 8, 9, 9, 11, 11, 5, 5, 2, 2, 12, 15, 15, 17, 18, 19, 20, 18, 21, 21, 13, 21, 16, 16, 11, 11, 8, 8, 24, 24, 23, 23, 26, 26, 27, 26, 29, 27, 28, 29, 25, 25, 30, 30, 4, 4, 5, 5, 31, 31, 35, 35, 37, 38, 38, 39, 39, 41, 41, 36, 36, 33, 33, 42, 45, 45, 47, 48, 49, 50, 48, 51, 43, 46, 46, 41, 41, 38, 38, 53, 53, 52, 52, 55, 55, 56, 55, 58, 56, 57, 58, 54, 54, 59, 59, 35, 35, 36, 36, 60, 61, 64, 60, 61, 61, 65, 65, 70, 66, 69, 69, 68, 68, 64, 64, 73, 76, 72, 77, 61, 61, 74, 78, 67, 67, 72, 75, 78, 76, 79, 80, 83, 83, 85, 85, 87, 87, 89, 87, 90, 85, 91, 92, 93, 93, 94, 94, 80, 80, 96, 96, 97, 97, 88, 97, 86, 96, 98, 98, 92, 98, 99, 100, 101, 101, 102, 102, 100, 100, 105, 105, 103, 104, 104, 99, 100, 100, 106, 107, 110, 106, 108, 109, 112, 113, 116, 116, 111, 111, 114, 114, 117, 114, 121, 110, 107, 121, 122, 111, 123, 116, 113, 113, 109, 109, 124, 117, 115, 115, 125, 125, 118, 125, 129, 118, 120, 131, 131, 129, 119, 120, 119, 126, 132, 130, 121, 133, 133, 65, 66, 62, 135, 136, 136, 136, 138, 138, 139, 140, 14, 14, 134, 49, 63, 63, 22, 62, 110, 110, 84, 22, 70, 142, 106, 106, 141, 81, 144, 143, 143, 143, 146, 147, 147, 147, 142, 44, 19, 19, 145, 149, 81, 82, 82, 82, 149, 149, 135, 150, 150, 150, 107, 107, 121, 107, 148, 42, 19, 14
+};
+
+static uint8_t grunt_pvs_fj[] = {
+    1, 3, 2, 0, 3, 7, 0, 6, 7, 10, 6, 9, 9, 2, 10, 1, 13, 13, 16, 18, 15, 17, 18, 17, 19, 17, 21, 22, 21, 20, 23, 8, 25, 4, 26, 23, 28, 25, 15, 28, 26, 18, 27, 20, 29, 16, 29, 30, 27, 24, 30, 5, 24, 11, 32, 34, 33, 31, 34, 31, 37, 34, 40, 37, 39, 39, 33, 40, 32, 43, 43, 46, 48, 45, 47, 48, 47, 47, 51, 51, 50, 52, 38, 54, 35, 55, 52, 57, 54, 45, 57, 55, 48, 56, 50, 58, 46, 58, 59, 56, 53, 59, 36, 53, 41, 61, 63, 60, 62, 66, 67, 68, 69, 66, 67, 71, 70, 72, 71, 73, 68, 72, 72, 71, 78, 78, 60, 78, 60, 77, 61, 76, 74, 74, 77, 80, 82, 81, 79, 80, 86, 86, 88, 87, 85, 85, 79, 92, 88, 87, 91, 84, 83, 95, 94, 83, 90, 90, 89, 97, 96, 96, 94, 89, 93, 98, 97, 100, 93, 98, 99, 92, 101, 104, 105, 103, 102, 92, 91, 103, 101, 102, 101, 107, 109, 106, 108, 109, 113, 113, 115, 114, 112, 112, 108, 118, 115, 114, 119, 110, 111, 121, 122, 111, 116, 116, 117, 124, 123, 123, 122, 117, 120, 125, 124, 126, 120, 125, 127, 118, 128, 131, 132, 129, 130, 118, 119, 129, 128, 130, 128, 133, 84, 95, 62, 51, 63, 136, 133, 95, 137, 136, 139, 140, 137, 139, 134, 49, 140, 49, 51, 62, 134, 141, 84, 81, 69, 51, 70, 143, 141, 81, 145, 143, 147, 148, 145, 147, 142, 44, 148, 44, 51, 69, 142, 149, 42, 82, 149, 137, 95, 140, 137, 150, 12, 146, 144, 144, 106, 107, 150, 42, 140, 12, 138
+};
+
+static uint8_t grunt_pvs_fk[] = {
+    2, 1, 5, 2, 0, 3, 4, 0, 6, 7, 8, 6, 11, 9, 9, 10, 14, 12, 13, 12, 12, 12, 21, 21, 22, 19, 14, 14, 13, 21, 24, 23, 23, 25, 27, 26, 26, 28, 18, 15, 20, 20, 16, 16, 15, 15, 28, 29, 29, 27, 25, 30, 30, 24, 33, 32, 36, 33, 31, 35, 31, 37, 34, 38, 37, 41, 39, 39, 40, 44, 42, 43, 42, 42, 42, 51, 51, 49, 44, 43, 51, 53, 52, 52, 54, 56, 55, 55, 57, 48, 45, 50, 50, 46, 46, 45, 45, 57, 58, 58, 56, 54, 59, 59, 53, 62, 62, 65, 65, 63, 66, 64, 68, 71, 71, 68, 71, 73, 72, 74, 73, 75, 67, 67, 75, 77, 78, 64, 64, 76, 77, 75, 73, 75, 75, 81, 81, 84, 81, 79, 80, 85, 86, 90, 90, 83, 83, 87, 87, 89, 87, 95, 84, 82, 95, 94, 83, 96, 90, 86, 86, 80, 80, 97, 89, 88, 88, 98, 98, 92, 98, 103, 92, 93, 104, 104, 103, 91, 93, 91, 100, 105, 102, 108, 108, 111, 111, 112, 112, 114, 114, 117, 114, 116, 112, 119, 118, 120, 120, 122, 122, 109, 109, 123, 123, 124, 124, 115, 124, 113, 123, 125, 125, 118, 125, 127, 126, 128, 128, 130, 130, 126, 126, 132, 132, 129, 131, 131, 127, 126, 126, 110, 110, 84, 22, 63, 134, 121, 121, 133, 95, 135, 136, 136, 136, 138, 139, 139, 139, 134, 49, 14, 14, 106, 141, 141, 65, 66, 69, 144, 143, 143, 143, 146, 146, 147, 148, 19, 19, 142, 44, 70, 70, 22, 69, 148, 148, 145, 145, 149, 137, 42, 140, 138, 138, 12, 146, 150, 144, 135, 135, 44, 49, 146, 12
+};
+
+// Bit f of set s: face f is in sector s's set
+static const uint8_t grunt_pvs_sets[][GRUNT_PVS_SET_BYTES] = {
+    { 0xff, 0xfc, 0x3f, 0x3e, 0xff, 0xfc, 0xff, 0xff, 0xff, 0x3f, 0xfe, 0x9f, 0xff, 0xff, 0x9f, 0xfd, 0xe7, 0x07, 0xd0, 0xff, 0xef, 0x3f, 0x0e, 0x72, 0xd8, 0xff, 0xff, 0x3f, 0x8e, 0x7f, 0xff, 0xff, 0xfa, 0x07, 0xf8, 0xff, 0x7f },
+    { 0xff, 0xf4, 0x3f, 0x36, 0xff, 0xfc, 0xff, 0xff, 0x7f, 0xbf, 0xff, 0x7f, 0xff, 0xff, 0x1f, 0xfc, 0xef, 0x73, 0xdc, 0xff, 0xef, 0x3f, 0x0e, 0x06, 0x88, 0xff, 0xff, 0x7f, 0x8e, 0xff, 0xff, 0xf7, 0xfa, 0xa7, 0xf9, 0xff, 0x3e },
+    { 0xff, 0xf4, 0x3f, 0xa2, 0xff, 0xf6, 0xed, 0xff, 0xfd, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0xfe, 0xcf, 0x7b, 0x5c, 0xaf, 0x67, 0x1e, 0x0e, 0x06, 0xa0, 0xff, 0xff, 0x7f, 0x8e, 0xfb, 0xff, 0xf7, 0xfa, 0xe7, 0xf9, 0x77, 0x38 },
+    { 0xff, 0x3f, 0x7f, 0xc3, 0xff, 0xf6, 0xcd, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0x7f, 0x7e, 0xcf, 0x79, 0x5c, 0x8e, 0x67, 0x9e, 0x0f, 0x87, 0xe1, 0xfd, 0xdf, 0x65, 0x8e, 0xfb, 0xff, 0xc7, 0xfe, 0xff, 0xf9, 0x77, 0x38 },
+    { 0xff, 0x0f, 0xff, 0xfb, 0xff, 0xf7, 0xcf, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf7, 0x7f, 0x7e, 0xde, 0x79, 0x7f, 0x8e, 0x67, 0x9e, 0x6f, 0x8f, 0xf7, 0xf9, 0x9f, 0x61, 0x8e, 0xfb, 0xff, 0xc7, 0xfe, 0xff, 0xff, 0x77, 0x58 },
+    { 0xff, 0xcf, 0xff, 0xfb, 0xff, 0xf3, 0xdf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0x7f, 0x3f, 0xde, 0xfd, 0x7f, 0x8e, 0x63, 0x9e, 0xef, 0x8f, 0xff, 0x79, 0x9f, 0xe1, 0x8f, 0xdb, 0xe6, 0xc7, 0xff, 0xff, 0xff, 0x7f, 0x59 },
+    { 0xff, 0xff, 0xfd, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfd, 0xff, 0xe7, 0xff, 0x0f, 0xde, 0xfd, 0x7f, 0xae, 0x23, 0xfb, 0xff, 0xaf, 0xff, 0x79, 0x9f, 0xe1, 0xef, 0xdf, 0x24, 0x9e, 0xdf, 0xff, 0xff, 0xff, 0x5f },
+    { 0xff, 0xff, 0xf8, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xfd, 0xff, 0xe7, 0xff, 0x8f, 0xfe, 0xfd, 0xff, 0x67, 0x15, 0xfb, 0xff, 0xef, 0xff, 0x79, 0x9f, 0xe1, 0xef, 0xdf, 0x20, 0x9e, 0xff, 0xff, 0xff, 0xff, 0x7f },
+    { 0xff, 0xff, 0xf8, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf9, 0xff, 0xff, 0xff, 0x8f, 0xfd, 0xff, 0xff, 0x71, 0x15, 0xf1, 0xff, 0xff, 0xff, 0x78, 0x97, 0xe1, 0xef, 0xdf, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x7f },
+    { 0xf6, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xfe, 0xff, 0xe9, 0xff, 0xbf, 0xff, 0x8f, 0xb9, 0xff, 0xff, 0x71, 0x9d, 0xe1, 0xff, 0xfd, 0xff, 0x7e, 0x17, 0xf1, 0xef, 0xdf, 0x08, 0x3e, 0xff, 0xff, 0xff, 0xff, 0x7f },
+    { 0xf0, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xfe, 0xff, 0xff, 0xe7, 0xff, 0xbf, 0xfb, 0xeb, 0x39, 0xee, 0xff, 0x79, 0x9d, 0xe1, 0xff, 0xfd, 0x7f, 0xee, 0x23, 0xfb, 0xef, 0xd7, 0x8a, 0x79, 0xff, 0xff, 0xaf, 0xfb, 0x6f },
+    { 0xb9, 0xff, 0xff, 0xff, 0xcd, 0xff, 0xff, 0x7f, 0xfe, 0xef, 0xfd, 0xe7, 0xff, 0xbf, 0xff, 0xf3, 0x39, 0x8e, 0xff, 0x79, 0x9d, 0xe1, 0xcf, 0xfd, 0x7f, 0xae, 0x23, 0xfe, 0xef, 0xb7, 0xff, 0x79, 0xfd, 0xff, 0xaf, 0xfa, 0x67 },
+    { 0x2f, 0xff, 0xdf, 0xff, 0xbc, 0xff, 0xff, 0x5f, 0xfe, 0xcf, 0xb9, 0xe7, 0xff, 0xff, 0xff, 0xf3, 0x31, 0x8f, 0xef, 0x79, 0x9f, 0x61, 0x8e, 0xf9, 0x7f, 0x8e, 0x63, 0x9e, 0xef, 0xb7, 0xff, 0x79, 0xfd, 0x7f, 0xae, 0xfa, 0x67 },
+    { 0xdf, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0x47, 0xb9, 0x87, 0xff, 0xff, 0xff, 0xf3, 0xf7, 0x87, 0xe3, 0xfd, 0xdf, 0x71, 0x8e, 0x7b, 0x7f, 0x8f, 0x67, 0x9e, 0xef, 0xb7, 0xff, 0x7b, 0xf9, 0x7f, 0xfe, 0xfa, 0x6f },
+    { 0xdf, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xbf, 0xff, 0x6f, 0xbc, 0x9f, 0xff, 0xff, 0x9f, 0xf1, 0xf7, 0x87, 0xa0, 0xff, 0xff, 0x77, 0x8e, 0x7b, 0x5e, 0x8f, 0x6f, 0x9e, 0xaf, 0x37, 0xff, 0xff, 0xf9, 0x1f, 0xde, 0xfa, 0x7f },
+    { 0xff, 0xff, 0xbf, 0x7c, 0xff, 0xfd, 0xff, 0xbf, 0xff, 0x7f, 0xfe, 0x9f, 0xff, 0xff, 0x9f, 0xfd, 0xf7, 0x07, 0x80, 0xff, 0xff, 0x7f, 0x8e, 0x7b, 0x5c, 0x8f, 0x6f, 0x1e, 0x8e, 0x7f, 0xff, 0xff, 0xf9, 0x17, 0xdc, 0xfa, 0x7f },
+};
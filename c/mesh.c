@@ -1,7 +1,13 @@
 #include <math.h>
+#include <stddef.h>
+#include <string.h>
 #include "mesh.h"
 #include "rasterize.h"
 
+#ifndef M_PI
+#define M_PI 3.14159265358979323846  /* Not provided by strict C99 <math.h> */
+#endif
+
 /* LUTs for rotation */
 int8_t rcos[256];
 int8_t rsin[256];
@@ -22,17 +28,117 @@ void init_mesh_tables(void) {
     tables_initialized = 1;
 }
 
-int transform_mesh(const Mesh *m, int16_t *screen_x, int16_t *screen_y) {
+/* Fused object-to-camera transform, built once per mesh by build_transform().
+ * Yaw-only orientation (any camera position and yaw) keeps the original
+ * s0.7 table path, 4 multiplies per vertex; pitch or roll on the mesh or
+ * camera switches to a s1.14 3x3 matrix whose zero entries are skipped. */
+typedef struct {
+    int general;            /* 0 = yaw fast path, 1 = matrix path */
+    int8_t c, s;            /* Fast path: rcos/rsin of the combined yaw */
+    int16_t m[3][3];        /* Matrix path: s1.14 rotation, object -> camera */
+    uint8_t nonzero[3];     /* Matrix path: bit k set if m[row][k] != 0 */
+    int32_t t[3];           /* Mesh origin in camera space */
+} MeshTransform;
+
+/* Y * X * Z rotation (roll first, then pitch, then yaw) as doubles */
+static void rotation_matrix(uint8_t yaw, uint8_t pitch, uint8_t roll, double r[3][3]) {
+    double cy = cos(yaw * 2.0 * M_PI / 256.0), sy = sin(yaw * 2.0 * M_PI / 256.0);
+    double cp = cos(pitch * 2.0 * M_PI / 256.0), sp = sin(pitch * 2.0 * M_PI / 256.0);
+    double cr = cos(roll * 2.0 * M_PI / 256.0), sr = sin(roll * 2.0 * M_PI / 256.0);
+
+    /* Same handedness as the yaw path: x' = c*x + s*z, z' = -s*x + c*z */
+    double ry[3][3] = { { cy, 0, sy }, { 0, 1, 0 }, { -sy, 0, cy } };
+    double rx[3][3] = { { 1, 0, 0 }, { 0, cp, -sp }, { 0, sp, cp } };
+    double rz[3][3] = { { cr, -sr, 0 }, { sr, cr, 0 }, { 0, 0, 1 } };
+    double yx[3][3];
+
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            yx[i][j] = ry[i][0] * rx[0][j] + ry[i][1] * rx[1][j] + ry[i][2] * rx[2][j];
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            r[i][j] = yx[i][0] * rz[0][j] + yx[i][1] * rz[1][j] + yx[i][2] * rz[2][j];
+        }
+    }
+}
+
+static void build_transform(const Mesh *m, MeshTransform *xf) {
+    const Camera *cam = m->camera;
+    int32_t dx = m->px - (cam ? cam->x : 0);
+    int32_t dy = m->py - (cam ? cam->y : 0);
+    int32_t dz = m->pz - (cam ? cam->z : 0);
+    int cam_tilted = cam && (cam->pitch || cam->roll);
+
     init_mesh_tables();
 
-    int8_t c = rcos[m->theta];
-    int8_t s = rsin[m->theta];
+    if (!m->pitch && !m->roll && !cam_tilted) {
+        /* Both rotations are about Y, so they combine into one table angle */
+        uint8_t yaw = m->theta - (cam ? cam->yaw : 0);
+        xf->general = 0;
+        xf->c = rcos[yaw];
+        xf->s = rsin[yaw];
+        if (!cam || cam->yaw == 0) {
+            xf->t[0] = dx;
+            xf->t[1] = dy;
+            xf->t[2] = dz;
+        } else {
+            /* Offset into camera space: rotate by -camera yaw */
+            double a = cam->yaw * 2.0 * M_PI / 256.0;
+            xf->t[0] = (int32_t)lround(cos(a) * dx - sin(a) * dz);
+            xf->t[1] = dy;
+            xf->t[2] = (int32_t)lround(sin(a) * dx + cos(a) * dz);
+        }
+        return;
+    }
 
-    for (int v = 0; v < m->num_vertices; v++) {
-        int8_t lx = m->x[v];  /* Local coordinates */
-        int8_t ly = m->y[v];
-        int8_t lz = m->z[v];
+    /* Camera-space rotation: R_cam^T * R_mesh, and offset R_cam^T * d */
+    double rm[3][3], rc[3][3];
+    double d[3] = { dx, dy, dz };
+    rotation_matrix(m->theta, m->pitch, m->roll, rm);
+    if (cam) {
+        rotation_matrix(cam->yaw, cam->pitch, cam->roll, rc);
+    } else {
+        rotation_matrix(0, 0, 0, rc);
+    }
+
+    xf->general = 1;
+    for (int i = 0; i < 3; i++) {
+        double t = 0;
+        xf->nonzero[i] = 0;
+        for (int j = 0; j < 3; j++) {
+            double e = rc[0][i] * rm[0][j] + rc[1][i] * rm[1][j] + rc[2][i] * rm[2][j];
+            xf->m[i][j] = (int16_t)lround(e * 16384.0);
+            if (xf->m[i][j]) xf->nonzero[i] |= 1 << j;
+            t += rc[j][i] * d[j];
+        }
+        xf->t[i] = (int32_t)lround(t);
+    }
+}
+
+/* One row of the matrix path, skipping zero entries (s1.14 -> s8.0) */
+static int32_t matrix_row(const MeshTransform *xf, int row, int lx, int ly, int lz) {
+    const int16_t *r = xf->m[row];
+    uint8_t nz = xf->nonzero[row];
+    int32_t sum = 0;
+    if (nz & 1) sum += r[0] * lx;
+    if (nz & 2) sum += r[1] * ly;
+    if (nz & 4) sum += r[2] * lz;
+    return sum >> 14;
+}
+
+/* Rotate one vertex and translate it to camera space. The result is kept
+ * in 32 bits: mesh and camera positions up to 64K apart do not wrap.
+ * Returns the rotated z (before adding the mesh offset) for depth sorting. */
+static int16_t world_vertex(const Mesh *m, const MeshTransform *xf, int v,
+                            int32_t *wx, int32_t *wy, int32_t *wz) {
+    int8_t lx = m->x[v];  /* Local coordinates */
+    int8_t ly = m->y[v];
+    int8_t lz = m->z[v];
+    int16_t rot_x, rot_y, rot_z;
 
+    if (!xf->general) {
         /* Rotation around Y axis:
          * world_x = cos(theta)*lx + sin(theta)*lz
          * world_z = -sin(theta)*lx + cos(theta)*lz
@@ -40,12 +146,53 @@ int transform_mesh(const Mesh *m, int16_t *screen_x, int16_t *screen_y) {
          *
          * Arithmetic: s8.0 * s0.7 = s8.7, keep high byte for s8.0 result.
          * Then add 16-bit position offset. */
-        int16_t rot_x = (c * lx + s * lz) >> 7;  /* s8.0 */
-        int16_t rot_z = (-s * lx + c * lz) >> 7; /* s8.0 */
+        int8_t c = xf->c, s = xf->s;
+        rot_x = (c * lx + s * lz) >> 7;  /* s8.0 */
+        rot_z = (-s * lx + c * lz) >> 7; /* s8.0 */
+        rot_y = ly;
+    } else {
+        rot_x = matrix_row(xf, 0, lx, ly, lz);
+        rot_y = matrix_row(xf, 1, lx, ly, lz);
+        rot_z = matrix_row(xf, 2, lx, ly, lz);
+    }
+
+    *wx = rot_x + xf->t[0];
+    *wy = rot_y + xf->t[1];
+    *wz = rot_z + xf->t[2];
+    return rot_z;
+}
+
+void mesh_screen_rect(const int16_t *screen_x, const int16_t *screen_y, int n,
+                      CharRect *r) {
+    int x0 = SCREEN_WIDTH, x1 = -1, y0 = SCREEN_HEIGHT, y1 = -1;
 
-        int16_t world_x = rot_x + m->px;
-        int16_t world_z = rot_z + m->pz;
-        int16_t world_y = ly + m->py;
+    for (int v = 0; v < n; v++) {
+        if (screen_x[v] < x0) x0 = screen_x[v];
+        if (screen_x[v] > x1) x1 = screen_x[v];
+        if (screen_y[v] < y0) y0 = screen_y[v];
+        if (screen_y[v] > y1) y1 = screen_y[v];
+    }
+    /* Pixels lie in [x0, x1) x [y0, y1), so x1 >> 1 is a safe last column */
+    r->col0 = x0 < 0 ? 0 : x0 >> 1;
+    r->col1 = x1 >= SCREEN_WIDTH ? CHAR_WIDTH - 1 : x1 >> 1;
+    r->row0 = y0 < 0 ? 0 : y0 >> 1;
+    r->row1 = y1 >= SCREEN_HEIGHT ? CHAR_HEIGHT - 1 : y1 >> 1;
+}
+
+int transform_mesh(const Mesh *m, int16_t *screen_x, int16_t *screen_y) {
+    return transform_mesh_z(m, screen_x, screen_y, NULL);
+}
+
+int transform_mesh_z(const Mesh *m, int16_t *screen_x, int16_t *screen_y,
+                     int16_t *rot_z_out) {
+    MeshTransform xf;
+    build_transform(m, &xf);
+
+    for (int v = 0; v < m->num_vertices; v++) {
+        int32_t world_x, world_y, world_z;
+        int16_t rot_z = world_vertex(m, &xf, v, &world_x, &world_y, &world_z);
+
+        if (rot_z_out) rot_z_out[v] = rot_z;
 
         /* Perspective projection:
          * screen_x = 40 + (world_x << 8) / world_z
@@ -64,25 +211,559 @@ int transform_mesh(const Mesh *m, int16_t *screen_x, int16_t *screen_y) {
     return 0;
 }
 
-void render_mesh(unsigned char *buf, const Mesh *m) {
-    int16_t screen_x[256];  /* Max 256 vertices */
-    int16_t screen_y[256];
+/* ------------------------------------------------------------------------ */
+/* Clipping                                                                  */
+/* ------------------------------------------------------------------------ */
 
-    if (transform_mesh(m, screen_x, screen_y) < 0) {
-        return;  /* Some vertex behind camera, skip entire mesh */
+/* Clip planes in world space. The guard band planes are the screen edges
+ * pushed out by GUARD_BAND, multiplied through by z so they are linear:
+ *   screen_x >= -GUARD_BAND         <=>  256*x + (40 + GUARD_BAND)*z >= 0
+ *   screen_x <= 80 + GUARD_BAND     <=>  (40 + GUARD_BAND)*z - 256*x >= 0
+ *   screen_y >= -GUARD_BAND         <=>  (25 + GUARD_BAND)*z - 256*y >= 0
+ *   screen_y <= 50 + GUARD_BAND     <=>  256*y + (25 + GUARD_BAND)*z >= 0 */
+#define CLIP_NEAR   0x01
+#define CLIP_LEFT   0x02
+#define CLIP_RIGHT  0x04
+#define CLIP_TOP    0x08
+#define CLIP_BOTTOM 0x10
+#define CLIP_PLANES 5
+
+#define GUARD_X (SCREEN_WIDTH / 2 + GUARD_BAND)
+#define GUARD_Y (SCREEN_HEIGHT / 2 + GUARD_BAND)
+
+/* Triangle clipped by all five planes: at most 3 + 5 vertices */
+#define CLIP_MAX_VERTS 8
+
+/* Clipped vertex: world coordinates in s.8 fixed point */
+typedef struct {
+    int32_t x, y, z;
+} ClipVert;
+
+/* Signed distance-like value of a point to a plane (>= 0 is inside).
+ * Works for integer and s.8 coordinates alike, the planes pass through
+ * the origin except for the near plane whose offset is given in the same
+ * scale. */
+static int64_t plane_dist(int plane, int64_t x, int64_t y, int64_t z, int64_t near) {
+    switch (plane) {
+    case 0:  return z - near;
+    case 1:  return 256 * x + GUARD_X * z;
+    case 2:  return GUARD_X * z - 256 * x;
+    case 3:  return GUARD_Y * z - 256 * y;
+    default: return 256 * y + GUARD_Y * z;
     }
+}
 
-    /* Render each face */
+static uint8_t vertex_outcode(int x, int y, int z) {
+    uint8_t code = 0;
+    for (int p = 0; p < CLIP_PLANES; p++) {
+        if (plane_dist(p, x, y, z, NEAR_Z) < 0) code |= 1 << p;
+    }
+    return code;
+}
+
+/* Intersection of edge a-b with a plane, given both distances (opposite
+ * signs). Endpoints are put in a fixed order first, so a neighbouring face
+ * sharing the edge gets exactly the same point and no crack opens. */
+static ClipVert clip_edge(ClipVert a, ClipVert b, int64_t da, int64_t db) {
+    ClipVert r;
+    if (a.x > b.x || (a.x == b.x && (a.y > b.y || (a.y == b.y && a.z > b.z)))) {
+        ClipVert t = a; a = b; b = t;
+        int64_t d = da; da = db; db = d;
+    }
+    r.x = a.x + (int32_t)(((int64_t)(b.x - a.x) * da) / (da - db));
+    r.y = a.y + (int32_t)(((int64_t)(b.y - a.y) * da) / (da - db));
+    r.z = a.z + (int32_t)(((int64_t)(b.z - a.z) * da) / (da - db));
+    return r;
+}
+
+/* Sutherland-Hodgman: clip a convex polygon against the planes in mask.
+ * Keeps vertex order, so the winding (and backface test) is preserved.
+ * Returns the new vertex count (0 if nothing is left). */
+static int clip_polygon(ClipVert *poly, int n, uint8_t mask) {
+    ClipVert tmp[CLIP_MAX_VERTS];
+
+    for (int p = 0; p < CLIP_PLANES && n > 0; p++) {
+        if (!(mask & (1 << p))) continue;
+
+        int out = 0;
+        ClipVert prev = poly[n - 1];
+        int64_t d_prev = plane_dist(p, prev.x, prev.y, prev.z, NEAR_Z * 256);
+        for (int v = 0; v < n; v++) {
+            ClipVert cur = poly[v];
+            int64_t d_cur = plane_dist(p, cur.x, cur.y, cur.z, NEAR_Z * 256);
+            if ((d_prev < 0) != (d_cur < 0)) {
+                tmp[out++] = clip_edge(prev, cur, d_prev, d_cur);
+            }
+            if (d_cur >= 0) tmp[out++] = cur;
+            prev = cur;
+            d_prev = d_cur;
+        }
+        memcpy(poly, tmp, out * sizeof(poly[0]));
+        n = out;
+    }
+    return n;
+}
+
+/* Clip one face and set up the resulting triangle fan.
+ * Returns the number of triangles written (at most room). */
+static int setup_clipped_face(const MeshWork *w, int vi, int vj, int vk,
+                              uint8_t mask, unsigned char color,
+                              TriEdges *tris, int room) {
+    ClipVert poly[CLIP_MAX_VERTS];
+    int sx[CLIP_MAX_VERTS], sy[CLIP_MAX_VERTS];
+    int idx[3] = { vi, vj, vk };
+    int n = 0;
+
+    for (int v = 0; v < 3; v++) {
+        poly[v].x = w->world_x[idx[v]] * 256;
+        poly[v].y = w->world_y[idx[v]] * 256;
+        poly[v].z = w->world_z[idx[v]] * 256;
+    }
+    int count = clip_polygon(poly, 3, mask);
+
+    /* Project: same rounding as transform_mesh for unclipped vertices */
+    for (int v = 0; v < count; v++) {
+        sx[v] = 40 + (int)(((int64_t)poly[v].x * 256) / poly[v].z);
+        sy[v] = 25 - (int)(((int64_t)poly[v].y * 256) / poly[v].z);
+    }
+
+    /* Fan around the first vertex keeps the original winding */
+    for (int v = 1; v + 1 < count && n < room; v++) {
+        n += setup_triangle(&tris[n], sx[0], sy[0], sx[v], sy[v],
+                            sx[v + 1], sy[v + 1], color);
+    }
+    return n;
+}
+
+static int face_count(const Mesh *m) {
+    return m->num_faces < MESH_MAX_FACES ? m->num_faces : MESH_MAX_FACES;
+}
+
+void compute_face_planes(const Mesh *m, int8_t *nx, int8_t *ny, int8_t *nz,
+                         int16_t *nd) {
     for (int f = 0; f < m->num_faces; f++) {
+        int vi = m->i[f], vj = m->j[f], vk = m->k[f];
+        int ux = m->x[vj] - m->x[vi], uy = m->y[vj] - m->y[vi], uz = m->z[vj] - m->z[vi];
+        int wx = m->x[vk] - m->x[vi], wy = m->y[vk] - m->y[vi], wz = m->z[vk] - m->z[vi];
+
+        /* Normal (v_j - v_i) x (v_k - v_i): front faces see the camera on
+         * its positive side */
+        double cx = (double)uy * wz - (double)uz * wy;
+        double cy = (double)uz * wx - (double)ux * wz;
+        double cz = (double)ux * wy - (double)uy * wx;
+        double len = sqrt(cx * cx + cy * cy + cz * cz);
+
+        if (len == 0.0) {
+            nx[f] = ny[f] = nz[f] = 0;  /* Degenerate: never culled here */
+        } else {
+            nx[f] = (int8_t)lround(cx * 127.0 / len);
+            ny[f] = (int8_t)lround(cy * 127.0 / len);
+            nz[f] = (int8_t)lround(cz * 127.0 / len);
+        }
+        nd[f] = (int16_t)(nx[f] * m->x[vi] + ny[f] * m->y[vi] + nz[f] * m->z[vi]);
+    }
+}
+
+/* Camera position in object space, in s.8, through the exact inverse of
+ * the quantized rotation */
+static void object_camera(const MeshTransform *xf, int64_t cam[3]) {
+    if (!xf->general) {
+        int64_t c = xf->c, s = xf->s;
+        int64_t r2 = c * c + s * s;
+        cam[0] = (int64_t)128 * 256 * (s * xf->t[2] - c * xf->t[0]) / r2;
+        cam[2] = -(int64_t)128 * 256 * (s * xf->t[0] + c * xf->t[2]) / r2;
+        cam[1] = -(int64_t)xf->t[1] * 256;
+    } else {
+        /* Solve M * cam = -t with the adjugate of the s1.14 matrix */
+        double a[3][3], inv[3][3], sol[3];
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) a[i][j] = xf->m[i][j] / 16384.0;
+        }
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                int i1 = (j + 1) % 3, i2 = (j + 2) % 3;
+                int j1 = (i + 1) % 3, j2 = (i + 2) % 3;
+                inv[i][j] = a[i1][j1] * a[i2][j2] - a[i1][j2] * a[i2][j1];
+            }
+        }
+        double det = a[0][0] * inv[0][0] + a[0][1] * inv[1][0] + a[0][2] * inv[2][0];
+        for (int i = 0; i < 3; i++) {
+            sol[i] = -(inv[i][0] * xf->t[0] + inv[i][1] * xf->t[1] +
+                       inv[i][2] * xf->t[2]) / det;
+        }
+        for (int i = 0; i < 3; i++) cam[i] = (int64_t)llround(sol[i] * 256.0);
+    }
+}
+
+/* Error bound for a face plane test from the camera at cam (s.8): int8
+ * normal rounding (<= 0.87 per unit distance from the face), and the
+ * truncating shift in world_vertex (< 2 units) */
+static int64_t cull_margin(const int64_t cam[3]) {
+    /* |camera - v_i| <= |camera| + 222 (the longest int8 vector) */
+    double dist = sqrt((double)cam[0] * cam[0] + (double)cam[1] * cam[1] +
+                       (double)cam[2] * cam[2]) / 256.0 + 222.0;
+    return (int64_t)((0.87 * dist + 2.0 * 128.0) * 256.0) + 256;
+}
+
+/* Which side of face f's plane the camera is on, in s.8 (>= 0 = front) */
+static inline int64_t face_side(const Mesh *m, int f, const int64_t cam[3]) {
+    return m->nx[f] * cam[0] + m->ny[f] * cam[1] + m->nz[f] * cam[2] -
+           (int64_t)m->nd[f] * 256;
+}
+
+/* Object-space backface cull. A face is rejected only when the camera is
+ * behind its plane by more than cull_margin(). Faces close to edge-on are
+ * kept and left to the screen-space test. */
+static void cull_faces(const Mesh *m, const MeshTransform *xf, MeshWork *w) {
+    int num_faces = face_count(m);
+    int64_t cam[3];
+
+    object_camera(xf, cam);
+    int64_t margin = cull_margin(cam);
+    for (int f = 0; f < num_faces; f++) {
+        w->face_front[f] = face_side(m, f, cam) >= -margin;
+    }
+}
+
+int compute_face_pvs(const Mesh *m, const int16_t lo[3], const int16_t hi[3],
+                     uint8_t *pvs) {
+    int num_faces = face_count(m);
+    int added = 0;
+    Mesh view = *m;
+
+    view.pitch = view.roll = 0;
+    view.camera = NULL;
+    for (int sector = 0; sector < PVS_SECTORS; sector++) {
+        uint8_t *set = pvs + sector * PVS_BYTES;
+        for (int step = 0; step < 1 << PVS_SECTOR_SHIFT; step++) {
+            view.theta = (uint8_t)((sector << PVS_SECTOR_SHIFT) + step);
+
+            /* The side is linear in the position, so its maximum over the
+             * box is at a corner, and so is the largest margin. Each corner
+             * is viewed with this file's truncated rcos/rsin and with
+             * mesh.asm's rounded ones, which differ by up to 1. */
+            double angle = view.theta * 2.0 * M_PI / 256.0;
+            int8_t asm_c = (int8_t)lround(cos(angle) * 127.0);
+            int8_t asm_s = (int8_t)lround(sin(angle) * 127.0);
+            int64_t best[MESH_MAX_FACES], margin = 0;
+            for (int corner = 0; corner < 16; corner++) {
+                MeshTransform xf;
+                int64_t cam[3];
+                view.px = (corner & 1) ? hi[0] : lo[0];
+                view.py = (corner & 2) ? hi[1] : lo[1];
+                view.pz = (corner & 4) ? hi[2] : lo[2];
+                build_transform(&view, &xf);
+                if (corner & 8) {
+                    xf.c = asm_c;
+                    xf.s = asm_s;
+                }
+                object_camera(&xf, cam);
+                int64_t cm = cull_margin(cam);
+                if (cm > margin) margin = cm;
+                for (int f = 0; f < num_faces; f++) {
+                    int64_t side = face_side(m, f, cam);
+                    if (corner == 0 || side > best[f]) best[f] = side;
+                }
+            }
+            for (int f = 0; f < num_faces; f++) {
+                if (best[f] >= -margin && !(set[f >> 3] & (1 << (f & 7)))) {
+                    set[f >> 3] |= 1 << (f & 7);
+                    added++;
+                }
+            }
+        }
+    }
+    return added;
+}
+
+/* Compute a vertex's outcode, and its screen position if it is inside the
+ * near plane and guard band */
+static void project_vertex(MeshWork *w, int v) {
+    w->num_projected++;
+
+    int world_x = w->world_x[v], world_y = w->world_y[v], world_z = w->world_z[v];
+    w->outcode[v] = vertex_outcode(world_x, world_y, world_z);
+    if (w->outcode[v] == 0) {
+        w->screen_x[v] = 40 + ((world_x << 8) / world_z);
+        w->screen_y[v] = 25 - ((world_y << 8) / world_z);
+    }
+}
+
+/* Project a vertex on first use this frame (bitset test kept inline) */
+static inline void need_vertex(MeshWork *w, int v) {
+    if (!(w->projected[v >> 3] & (1 << (v & 7)))) {
+        w->projected[v >> 3] |= 1 << (v & 7);
+        project_vertex(w, v);
+    }
+}
+
+/* Screen edges a vertex projects beyond, from world coordinates without
+ * the divide. screen_x = 40 + q with q = 256x/z truncated toward zero, so
+ * screen_x < 0 <=> q <= -41 <=> 256x <= -41z, and likewise for the others.
+ * A triangle whose vertices are all beyond one edge draws nothing. */
+#define OFF_LEFT   0x01     /* screen_x < 0 */
+#define OFF_RIGHT  0x02     /* screen_x >= 80 */
+#define OFF_TOP    0x04     /* screen_y < 0 */
+#define OFF_BOTTOM 0x08     /* screen_y >= 50 */
+
+static uint8_t vertex_offscreen(int64_t x, int64_t y, int64_t z) {
+    uint8_t code = 0;
+    if (256 * x <= -(SCREEN_WIDTH / 2 + 1) * z) code |= OFF_LEFT;
+    if (256 * x >= (SCREEN_WIDTH / 2) * z) code |= OFF_RIGHT;
+    if (256 * y >= (SCREEN_HEIGHT / 2 + 1) * z) code |= OFF_TOP;
+    if (256 * y <= -(SCREEN_HEIGHT / 2) * z) code |= OFF_BOTTOM;
+    return code;
+}
+
+/* Transform all vertices to world space and run the object-space cull.
+ * Eager mode then projects every vertex used by a surviving face; lazy mode
+ * only computes outcodes and offscreen codes and leaves the divides to
+ * need_vertex() in the setup pass. */
+static void transform_vertices(const Mesh *m, MeshWork *w) {
+    MeshTransform xf;
+    int num_vertices = m->num_vertices < MESH_MAX_VERTICES
+                     ? m->num_vertices : MESH_MAX_VERTICES;
+    uint8_t used[MESH_MAX_VERTICES];
+
+    build_transform(m, &xf);
+    if (m->nx) {
+        cull_faces(m, &xf, w);
+    } else {
+        memset(w->face_front, 1, sizeof(w->face_front));
+    }
+    int use_pvs = m->pvs && !xf.general && !m->camera;
+    if (use_pvs) {
+        const uint8_t *set = m->pvs + (m->theta >> PVS_SECTOR_SHIFT) * PVS_BYTES;
+        int num_faces = face_count(m);
+        for (int f = 0; f < num_faces; f++) {
+            if (!(set[f >> 3] & (1 << (f & 7)))) w->face_front[f] = 0;
+        }
+    }
+    w->num_projected = 0;
+
+    for (int v = 0; v < num_vertices; v++) {
+        w->rot_z[v] = world_vertex(m, &xf, v, &w->world_x[v], &w->world_y[v],
+                                   &w->world_z[v]);
+    }
+    if (m->lazy_projection) {
+        memset(w->projected, 0, sizeof(w->projected));
+        for (int v = 0; v < num_vertices; v++) {
+            w->outcode[v] = vertex_outcode(w->world_x[v], w->world_y[v],
+                                           w->world_z[v]);
+            w->offscreen[v] = vertex_offscreen(w->world_x[v], w->world_y[v],
+                                               w->world_z[v]);
+        }
+        return;
+    }
+
+    if (m->nx || use_pvs) {
+        int num_faces = face_count(m);
+        memset(used, 0, sizeof(used));
+        for (int f = 0; f < num_faces; f++) {
+            if (w->face_front[f]) {
+                used[m->i[f]] = 1;
+                used[m->j[f]] = 1;
+                used[m->k[f]] = 1;
+            }
+        }
+    } else {
+        memset(used, 1, sizeof(used));
+    }
+    for (int v = 0; v < num_vertices; v++) {
+        if (used[v]) project_vertex(w, v);
+    }
+}
+
+/* Counting sort pass: scatter src[] into dst[] by ascending key byte */
+static void radix_pass(const uint16_t *src, uint16_t *dst, const uint16_t *key,
+                       int shift, int n) {
+    int count[256] = {0};
+    int pos = 0;
+
+    for (int f = 0; f < n; f++) count[(key[src[f]] >> shift) & 0xff]++;
+    for (int b = 0; b < 256; b++) {
+        int c = count[b];
+        count[b] = pos;
+        pos += c;
+    }
+    for (int f = 0; f < n; f++) {
+        dst[count[(key[src[f]] >> shift) & 0xff]++] = src[f];
+    }
+}
+
+/* Same key as compute_face_z_0: the asm stores (rot_z ^ SORT_XOR) per
+ * vertex, which maps signed z to unsigned with far faces first. Its
+ * lsr/lsr/adc leaves bit 1 of z in carry, so the j and k terms round up
+ * when that bit is set. */
+static void face_keys_8(const Mesh *m, const int16_t *rot_z, uint16_t *face_z, int n) {
+    for (int f = 0; f < n; f++) {
+        uint8_t zi = (uint8_t)rot_z[m->i[f]] ^ 0x7f;
+        uint8_t zj = (uint8_t)rot_z[m->j[f]] ^ 0x7f;
+        uint8_t zk = (uint8_t)rot_z[m->k[f]] ^ 0x7f;
+        face_z[f] = (zi >> 2) + ((zj + 2) >> 2) + ((zk + 2) >> 2);
+    }
+}
+
+int sort_faces_8(const Mesh *m, const int16_t *rot_z, uint16_t *order) {
+    uint16_t index[MESH_MAX_FACES];
+    uint16_t face_z[MESH_MAX_FACES];
+    int n = face_count(m);
+
+    face_keys_8(m, rot_z, face_z, n);
+    for (int f = 0; f < n; f++) index[f] = (uint16_t)f;
+
+    radix_pass(index, order, face_z, 0, n);
+    return n;
+}
+
+int repair_faces_8(const Mesh *m, const int16_t *rot_z, uint16_t *order, int max_moves) {
+    uint16_t face_z[MESH_MAX_FACES];
+    int n = face_count(m);
+    int moves = 0;
+
+    face_keys_8(m, rot_z, face_z, n);
+
+    /* Insertion sort, as sort_faces_0 with INCREMENTAL_SORT: an element
+     * already in place costs one compare */
+    for (int pos = 1; pos < n; pos++) {
+        uint16_t face = order[pos];
+        uint16_t key = face_z[face];
+        int slot = pos;
+        while (slot > 0 && face_z[order[slot - 1]] > key) {
+            if (++moves > max_moves) return -1;
+            order[slot] = order[slot - 1];
+            slot--;
+        }
+        order[slot] = face;
+    }
+    return moves;
+}
+
+int bucket_faces_8(const Mesh *m, const int16_t *rot_z, uint16_t *order) {
+    uint16_t face_z[MESH_MAX_FACES];
+    int16_t head[256], next[MESH_MAX_FACES];
+    int n = face_count(m);
+    int pos = 0;
+
+    face_keys_8(m, rot_z, face_z, n);
+    for (int b = 0; b < 256; b++) head[b] = -1;
+
+    /* As bucket_faces: page 1 first, each page from its last face down, so
+     * every list is pushed in descending and read in ascending id order */
+    for (int page = (n - 1) >> 8; page >= 0; page--) {
+        int last = n - 1 < (page << 8) + 255 ? n - 1 : (page << 8) + 255;
+        for (int f = last; f >= page << 8; f--) {
+            next[f] = head[face_z[f]];
+            head[face_z[f]] = (int16_t)f;
+        }
+    }
+    for (int b = 0; b < 256; b++) {
+        for (int f = head[b]; f >= 0; f = next[f]) order[pos++] = (uint16_t)f;
+    }
+    return n;
+}
+
+int sort_faces_16(const Mesh *m, const int16_t *rot_z, uint16_t *order) {
+    uint16_t index[MESH_MAX_FACES];
+    uint16_t face_z[MESH_MAX_FACES];
+    int n = face_count(m);
+
+    /* Larger z is farther away, so invert the sum for an ascending sort */
+    for (int f = 0; f < n; f++) {
+        int z = rot_z[m->i[f]] + rot_z[m->j[f]] + rot_z[m->k[f]];
+        face_z[f] = (uint16_t)(0x8000 - z);
+        index[f] = (uint16_t)f;
+    }
+
+    /* LSD radix: low byte first, then high byte (both passes stable) */
+    radix_pass(index, order, face_z, 0, n);
+    radix_pass(order, index, face_z, 8, n);
+    memcpy(order, index, n * sizeof(order[0]));
+    return n;
+}
+
+/* Transform a mesh and set up its faces in draw order, clipping where
+ * needed. tris must have room for MESH_MAX_TRIS entries. */
+static int setup_faces(const Mesh *m, MeshWork *w, TriEdges *tris) {
+    int num_faces = face_count(m);
+    int n = 0;
+
+    transform_vertices(m, w);
+
+    if (m->depth_sort == DEPTH_SORT_8) {
+        sort_faces_8(m, w->rot_z, w->order);
+    } else if (m->depth_sort == DEPTH_SORT_16) {
+        sort_faces_16(m, w->rot_z, w->order);
+    } else {
+        for (int f = 0; f < num_faces; f++) w->order[f] = (uint16_t)f;
+    }
+
+    /* Setup pass: setup_triangle handles backface culling */
+    for (int o = 0; o < num_faces && n < MESH_MAX_TRIS; o++) {
+        int f = w->order[o];
+        if (!w->face_front[f]) continue;
+
         int vi = m->i[f];
         int vj = m->j[f];
         int vk = m->k[f];
+        uint8_t ci = w->outcode[vi], cj = w->outcode[vj], ck = w->outcode[vk];
+
+        if ((ci | cj | ck) == 0) {
+            /* Common case: all vertices inside, already projected (lazy:
+             * projected here unless the face is off screen) */
+            if (m->lazy_projection) {
+                if (w->offscreen[vi] & w->offscreen[vj] & w->offscreen[vk]) continue;
+                need_vertex(w, vi);
+                need_vertex(w, vj);
+                need_vertex(w, vk);
+            }
+            n += setup_triangle(&tris[n],
+                                w->screen_x[vi], w->screen_y[vi],
+                                w->screen_x[vj], w->screen_y[vj],
+                                w->screen_x[vk], w->screen_y[vk],
+                                m->col[f]);
+        } else if ((ci & cj & ck) == 0) {
+            /* Straddles a plane: clip and fan */
+            n += setup_clipped_face(w, vi, vj, vk, ci | cj | ck, m->col[f],
+                                    &tris[n], MESH_MAX_TRIS - n);
+        }
+        /* else: all three vertices outside one plane, nothing visible */
+    }
+
+    return n;
+}
+
+int setup_mesh(const Mesh *m, TriEdges *tris) {
+    MeshWork w;
+    return setup_faces(m, &w, tris);
+}
+
+void render_mesh_scratch(unsigned char *buf, const Mesh *m, MeshScratch *s) {
+    int n = setup_faces(m, &s->work, s->tris);
+
+    if (m->span_buffer) {
+        /* Nearest first, behind what is already drawn */
+        clear_coverage(&s->cover);
+        for (int t = n - 1; t >= 0; t--) {
+            raster_triangle_front(buf, &s->tris[t], &s->cover);
+        }
+        if (m->extents) coverage_extents(&s->cover, m->extents);
+        return;
+    }
 
-        /* draw_triangle handles backface culling internally */
-        draw_triangle(buf,
-                      screen_x[vi], screen_y[vi],
-                      screen_x[vj], screen_y[vj],
-                      screen_x[vk], screen_y[vk],
-                      m->col[f]);
+    /* Raster pass in painter's order */
+    if (m->extents) {
+        for (int t = 0; t < n; t++) {
+            raster_triangle_track(buf, &s->tris[t], m->extents);
+        }
+        return;
+    }
+    for (int t = 0; t < n; t++) {
+        raster_triangle(buf, &s->tris[t]);
     }
 }
+
+void render_mesh(unsigned char *buf, const Mesh *m) {
+    MeshScratch s;
+    render_mesh_scratch(buf, m, &s);
+}
@@ -2,6 +2,36 @@
 #define MESH_H
 
 #include <stdint.h>
+#include "rasterize.h"
+
+/* Mesh size limits (8-bit vertex indices; faces match the asm dual-mesh limit) */
+#define MESH_MAX_VERTICES 256
+#define MESH_MAX_FACES    512
+
+/* Set-up triangles per mesh: a face clipped by the near plane or guard band
+ * becomes a fan of up to 6 triangles. Pieces beyond this budget are dropped. */
+#define MESH_MAX_TRIS     (2 * MESH_MAX_FACES)
+
+/* Near plane: vertices with world z below this are clipped away */
+#define NEAR_Z 8
+
+/* Face ordering for setup_mesh()/render_mesh() */
+#define DEPTH_SORT_NONE 0   /* Draw faces in index order */
+#define DEPTH_SORT_8    1   /* 8-bit centroid-z counting sort, as in mesh.asm */
+#define DEPTH_SORT_16   2   /* 16-bit centroid-z, two-pass radix sort */
+
+/* Potentially visible sets: a face bitset per rotation sector of
+ * 1 << PVS_SECTOR_SHIFT theta steps, see compute_face_pvs() */
+#define PVS_SECTOR_SHIFT 4
+#define PVS_SECTORS      (256 >> PVS_SECTOR_SHIFT)
+#define PVS_BYTES        (MESH_MAX_FACES / 8)
+
+/* Viewer position and orientation in world space (angles 0-255 = 0 to 2pi,
+ * applied like a mesh's: roll, then pitch, then yaw) */
+typedef struct {
+    int16_t x, y, z;
+    uint8_t yaw, pitch, roll;
+} Camera;
 
 /* Mesh structure for 3D rendering with C64-style fixed-point arithmetic */
 typedef struct {
@@ -17,8 +47,50 @@ typedef struct {
     /* Transform: position and rotation */
     int16_t px, py, pz;     /* 16-bit world position */
     uint8_t theta;          /* 8-bit rotation (0-255 = 0 to 2pi) */
+    uint8_t pitch, roll;    /* X and Z rotation, applied before theta (0 = none) */
+    const Camera *camera;   /* NULL = at the world origin looking down +z */
+
+    uint8_t depth_sort;     /* DEPTH_SORT_*, default (0) is index order */
+    uint8_t span_buffer;    /* 1 = render_mesh draws front to back, each pixel once */
+    uint8_t lazy_projection; /* 1 = project vertices on first use by a face */
+    RowExtents *extents;    /* Non-NULL: render_mesh widens these to what it draws */
+
+    /* Optional face planes for object-space culling (NULL = screen space only):
+     * int8 normal n (|n| ~ 127) and offset d = n . v, see compute_face_planes() */
+    int8_t *nx, *ny, *nz;
+    int16_t *nd;
+
+    /* Optional potentially visible sets (NULL = none): PVS_SECTORS bitsets
+     * of PVS_BYTES from compute_face_pvs(). Faces not in the set for
+     * theta >> PVS_SECTOR_SHIFT are skipped. Used only without pitch, roll
+     * or camera, inside the position box the sets were built for. */
+    const uint8_t *pvs;
 } Mesh;
 
+/* Per-vertex and per-face working arrays for setup_mesh() */
+typedef struct {
+    int16_t screen_x[MESH_MAX_VERTICES];
+    int16_t screen_y[MESH_MAX_VERTICES];
+    int16_t rot_z[MESH_MAX_VERTICES];
+    int32_t world_x[MESH_MAX_VERTICES];
+    int32_t world_y[MESH_MAX_VERTICES];
+    int32_t world_z[MESH_MAX_VERTICES];
+    uint8_t outcode[MESH_MAX_VERTICES];     /* CLIP_* planes the vertex is outside */
+    uint8_t offscreen[MESH_MAX_VERTICES];   /* Screen edges the vertex is beyond (lazy) */
+    uint8_t projected[MESH_MAX_VERTICES / 8]; /* Bitset: screen_x/y valid (lazy) */
+    uint8_t face_front[MESH_MAX_FACES];     /* Face survived object-space culling */
+    int num_projected;                      /* Vertices projected this frame */
+    uint16_t order[MESH_MAX_FACES];
+} MeshWork;
+
+/* Per-thread working storage for render_mesh_scratch(). Callers rendering
+ * many frames keep one per thread instead of ~45KB of stack per frame. */
+typedef struct {
+    MeshWork work;
+    TriEdges tris[MESH_MAX_TRIS];
+    Coverage cover;         /* Span buffer for m->span_buffer */
+} MeshScratch;
+
 /* LUTs for rotation: 0.9*cos(theta) and 0.9*sin(theta) in s0.7 format
  * Range approximately -115 to +115. Factor 0.9 for PAL aspect ratio. */
 extern int8_t rcos[256];
@@ -27,15 +99,105 @@ extern int8_t rsin[256];
 /* Initialize rcos/rsin lookup tables. Call once before using mesh functions. */
 void init_mesh_tables(void);
 
+/* Precompute face planes for object-space culling: per face an int8 normal
+ * of length ~127 (zero for degenerate faces) and int16 offset d = n . v_i.
+ * Arrays must hold num_faces entries. Assign them to m->nx/ny/nz/nd to
+ * enable the cull. */
+void compute_face_planes(const Mesh *m, int8_t *nx, int8_t *ny, int8_t *nz,
+                         int16_t *nd);
+
+/* Build potentially visible sets for positions (px, py, pz) in the box
+ * lo..hi: a face joins a sector's set if the object-space cull of
+ * setup_mesh() would keep it for some theta of the sector and some position
+ * in the box, with either the rcos/rsin tables here or mesh.asm's rounded
+ * ones. The mesh needs face planes; its theta, position, pitch, roll
+ * and camera are ignored. Bits are ORed into pvs (PVS_SECTORS * PVS_BYTES,
+ * cleared by the caller), so calling once per animation frame gives the
+ * union over frames. Returns the number of (sector, face) bits set here. */
+int compute_face_pvs(const Mesh *m, const int16_t lo[3], const int16_t hi[3],
+                     uint8_t *pvs);
+
 /* Transform mesh vertices from local to screen coordinates.
- * Applies Y-axis rotation and perspective projection.
+ * Applies the mesh rotation and position, the camera transform, and
+ * perspective projection, without clipping. Yaw-only setups (no pitch or
+ * roll on mesh or camera) use the s0.7 rcos/rsin path; otherwise a s1.14
+ * 3x3 matrix composed once per mesh.
  * Results stored in screen_x[], screen_y[] arrays (must be num_vertices long).
  * Returns 0 on success, -1 if any vertex is behind camera (z <= 0). */
 int transform_mesh(const Mesh *m, int16_t *screen_x, int16_t *screen_y);
 
+/* Characters that can hold pixels of triangles between the given screen
+ * vertices: their bounding box, clamped to the screen (empty for n = 0).
+ * Same rectangle as mesh_screen_bounds in mesh.asm. With transform_mesh()
+ * output it covers everything render_mesh() draws, as long as no vertex is
+ * behind the camera (no near-plane clipping). */
+void mesh_screen_rect(const int16_t *screen_x, const int16_t *screen_y, int n,
+                      CharRect *r);
+
+/* Same as transform_mesh(), also storing each vertex's rotated Z in camera
+ * space (before adding the mesh offset) in rot_z[] for depth sorting. */
+int transform_mesh_z(const Mesh *m, int16_t *screen_x, int16_t *screen_y,
+                     int16_t *rot_z);
+
+/* Depth sort faces back-to-front into order[] (num_faces entries, capped at
+ * MESH_MAX_FACES). Both sorts are stable, so equal depths keep index order.
+ *
+ * sort_faces_8 matches mesh.asm: key = sum of (rot_z ^ $7f) >> 2 over the
+ * three vertices, using the low byte of rot_z (the j and k terms rounded
+ * as compute_face_z_0's carries do), then a counting sort with ascending
+ * key (largest z first). For a two-sub-mesh asm build with MERGED_SORT,
+ * whose bucket_faces sorts all faces at once, the order is the same, see
+ * bucket_faces_8().
+ * sort_faces_16 uses the full sum of the three rot_z values as a 16-bit key
+ * and sorts with two 8-bit radix passes. */
+int sort_faces_8(const Mesh *m, const int16_t *rot_z, uint16_t *order);
+int sort_faces_16(const Mesh *m, const int16_t *rot_z, uint16_t *order);
+
+/* Frame-coherent version of sort_faces_8: repair order[], a permutation of
+ * the faces such as last frame's result, into back-to-front order for this
+ * frame's keys by insertion sort. Faces with equal keys keep their current
+ * order, so the result may order ties differently from sort_faces_8. Gives
+ * up after max_moves single-place moves, leaving order[] a permutation in
+ * no particular order; re-sort it with sort_faces_8() then.
+ * Returns the number of moves, or -1 if it gave up. */
+int repair_faces_8(const Mesh *m, const int16_t *rot_z, uint16_t *order, int max_moves);
+
+/* Model of bucket_faces in mesh.asm (MERGED_SORT): sort_faces_8's keys,
+ * with a linked list of 9-bit face ids (id >> 8 = sub-mesh page) per key,
+ * drawn in ascending key order. Returns the number of faces. */
+int bucket_faces_8(const Mesh *m, const int16_t *rot_z, uint16_t *order);
+
+/* Transform the mesh and set up its faces for rasterization, in draw order
+ * (index order, or back-to-front when m->depth_sort is set).
+ * With face planes set, faces pointing away from the camera are rejected in
+ * object space first, and vertices used only by them are never projected.
+ * Faces outside m->pvs for the current sector are rejected likewise.
+ * With m->lazy_projection, a vertex is instead projected the first time a
+ * face needs its screen position in the setup pass (tracked in a bitset).
+ * Faces lying entirely beyond one screen edge are found from world
+ * coordinates and skipped first, so vertices used only by them, or only by
+ * faces the near plane or guard band reject, cost no divide. Frames are the
+ * same as without it.
+ * Faces crossing the near plane or the guard band are clipped in world space
+ * and fanned into several triangles; faces entirely outside are dropped, as
+ * are backfacing and empty ones. At most MESH_MAX_FACES faces are used.
+ * tris must have room for MESH_MAX_TRIS entries.
+ * Returns the number of triangles written. */
+int setup_mesh(const Mesh *m, TriEdges *tris);
+
 /* Render all faces of a mesh to the screen buffer.
  * Uses backface culling from the rasterizer.
- * Face colors come from mesh->col array. */
+ * Face colors come from mesh->col array.
+ * With m->span_buffer, the set-up triangles are drawn in reverse, front to
+ * back, through a span buffer (raster_triangle_front), so each covered pixel
+ * is written once; the screen is the same as in painter's order. Use it with
+ * a depth sort. render_mesh_tiled() ignores it.
+ * With m->extents, each character row's extent is widened to the characters
+ * drawn, never narrowed: clear_extents() on the next frame for the same
+ * buffer then replaces clear_screen(). */
 void render_mesh(unsigned char *buf, const Mesh *m);
 
+/* Same as render_mesh(), using caller-provided scratch storage */
+void render_mesh_scratch(unsigned char *buf, const Mesh *m, MeshScratch *s);
+
 #endif /* MESH_H */
@@ -0,0 +1,266 @@
+#define _POSIX_C_SOURCE 200809L  /* sysconf, pthreads */
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "parallel.h"
+#include "rasterize.h"
+
+struct WorkerPool {
+    pthread_t *threads;
+    int num_threads;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work_ready;  /* Signalled when tasks are posted or on shutdown */
+    pthread_cond_t work_done;   /* Signalled when the last task finishes */
+
+    /* Current job, protected by lock */
+    pool_task_fn fn;
+    void *ctx;
+    int num_tasks;
+    int next_task;
+    int pending;                /* Tasks not yet finished */
+    int shutdown;
+};
+
+typedef struct {
+    WorkerPool *pool;
+    int worker;
+} WorkerArg;
+
+static void *worker_main(void *p) {
+    WorkerArg *arg = p;
+    WorkerPool *pool = arg->pool;
+    int worker = arg->worker;
+    free(arg);
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->next_task >= pool->num_tasks) {
+            pthread_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (pool->shutdown) break;
+
+        /* Take the next task and run it without holding the lock */
+        int task = pool->next_task++;
+        pool_task_fn fn = pool->fn;
+        void *ctx = pool->ctx;
+        pthread_mutex_unlock(&pool->lock);
+
+        fn(ctx, task, worker);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->pending == 0) {
+            pthread_cond_signal(&pool->work_done);
+        }
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+WorkerPool *pool_create(int num_threads) {
+    if (num_threads <= 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (int)cpus : 1;
+    }
+
+    WorkerPool *pool = calloc(1, sizeof(*pool));
+    if (!pool) return NULL;
+    pool->threads = calloc(num_threads, sizeof(pthread_t));
+    if (!pool->threads) {
+        free(pool);
+        return NULL;
+    }
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work_ready, NULL);
+    pthread_cond_init(&pool->work_done, NULL);
+
+    for (int w = 0; w < num_threads; w++) {
+        WorkerArg *arg = malloc(sizeof(*arg));
+        if (!arg) break;
+        arg->pool = pool;
+        arg->worker = w;
+        if (pthread_create(&pool->threads[w], NULL, worker_main, arg) != 0) {
+            free(arg);
+            break;
+        }
+        pool->num_threads++;
+    }
+
+    if (pool->num_threads == 0) {
+        pool_destroy(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+void pool_destroy(WorkerPool *pool) {
+    if (!pool) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->work_ready);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int w = 0; w < pool->num_threads; w++) {
+        pthread_join(pool->threads[w], NULL);
+    }
+
+    pthread_cond_destroy(&pool->work_done);
+    pthread_cond_destroy(&pool->work_ready);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+int pool_size(const WorkerPool *pool) {
+    return pool ? pool->num_threads : 1;
+}
+
+void pool_run(WorkerPool *pool, pool_task_fn fn, void *ctx, int num_tasks) {
+    if (num_tasks <= 0) return;
+
+    if (!pool) {
+        for (int task = 0; task < num_tasks; task++) {
+            fn(ctx, task, 0);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->num_tasks = num_tasks;
+    pool->next_task = 0;
+    pool->pending = num_tasks;
+    pthread_cond_broadcast(&pool->work_ready);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->work_done, &pool->lock);
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Tile-binned frame renderer                                                */
+/* ------------------------------------------------------------------------ */
+
+typedef struct {
+    unsigned char *buf;
+    const TriEdges *tris;
+    const uint16_t *bin_items;          /* Triangle indices, grouped by band */
+    int bin_start[CHAR_HEIGHT + 1];     /* Band b owns bin_items[start[b]..start[b+1]) */
+    int band_row[CHAR_HEIGHT + 1];      /* Band b covers char rows [row[b], row[b+1]) */
+} TiledFrame;
+
+static void raster_band(void *ctx, int band, int worker) {
+    TiledFrame *frame = ctx;
+    int y_lo = frame->band_row[band] * 2;
+    int y_hi = frame->band_row[band + 1] * 2;
+    (void)worker;
+
+    for (int b = frame->bin_start[band]; b < frame->bin_start[band + 1]; b++) {
+        raster_triangle_rows(frame->buf, &frame->tris[frame->bin_items[b]],
+                             y_lo, y_hi);
+    }
+}
+
+/* Clamp a scanline to its character row on screen */
+static int char_row_of(int y) {
+    if (y < 0) return 0;
+    if (y >= SCREEN_HEIGHT) return CHAR_HEIGHT - 1;
+    return y >> 1;
+}
+
+void render_mesh_tiled(WorkerPool *pool, unsigned char *buf, const Mesh *m,
+                       int num_bands) {
+    TriEdges tris[MESH_MAX_TRIS];
+    uint16_t bin_items[MESH_MAX_TRIS * CHAR_HEIGHT];
+    int band_of_row[CHAR_HEIGHT];
+    int count[CHAR_HEIGHT + 1] = {0};
+    TiledFrame frame;
+
+    if (num_bands < 1) num_bands = 1;
+    if (num_bands > CHAR_HEIGHT) num_bands = CHAR_HEIGHT;
+
+    int n = setup_mesh(m, tris);
+    if (n == 0) return;
+
+    /* Split the character rows as evenly as possible */
+    for (int b = 0; b <= num_bands; b++) {
+        frame.band_row[b] = b * CHAR_HEIGHT / num_bands;
+    }
+    for (int b = 0; b < num_bands; b++) {
+        for (int r = frame.band_row[b]; r < frame.band_row[b + 1]; r++) {
+            band_of_row[r] = b;
+        }
+    }
+
+    /* Bin by y-extent: count, prefix sum, then fill in painter's order */
+    for (int t = 0; t < n; t++) {
+        int first = band_of_row[char_row_of(tris[t].ay)];
+        int last = band_of_row[char_row_of(tris[t].cy - 1)];
+        for (int b = first; b <= last; b++) count[b]++;
+    }
+    frame.bin_start[0] = 0;
+    for (int b = 0; b < num_bands; b++) {
+        frame.bin_start[b + 1] = frame.bin_start[b] + count[b];
+        count[b] = frame.bin_start[b];  /* Reuse as fill cursor */
+    }
+    for (int t = 0; t < n; t++) {
+        int first = band_of_row[char_row_of(tris[t].ay)];
+        int last = band_of_row[char_row_of(tris[t].cy - 1)];
+        for (int b = first; b <= last; b++) bin_items[count[b]++] = (uint16_t)t;
+    }
+
+    frame.buf = buf;
+    frame.tris = tris;
+    frame.bin_items = bin_items;
+    pool_run(pool, raster_band, &frame, num_bands);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Frame-parallel batch renderer                                             */
+/* ------------------------------------------------------------------------ */
+
+typedef struct {
+    const RenderJob *jobs;
+    unsigned char *out;
+    unsigned char background;
+    MeshScratch *scratch;               /* One per worker */
+} FrameBatch;
+
+static void render_job(void *ctx, int job, int worker) {
+    FrameBatch *batch = ctx;
+    const RenderJob *j = &batch->jobs[job];
+    unsigned char *buf = batch->out + (size_t)job * SCREEN_SIZE;
+
+    /* Copy the mesh header only; vertex and face arrays are shared */
+    Mesh m = *j->mesh;
+    m.theta = j->theta;
+    m.px = j->px;
+    m.py = j->py;
+    m.pz = j->pz;
+
+    clear_screen(buf, batch->background);
+    render_mesh_scratch(buf, &m, &batch->scratch[worker]);
+}
+
+int render_frames(WorkerPool *pool, const RenderJob *jobs, int num_jobs,
+                  unsigned char *out, unsigned char background) {
+    FrameBatch batch;
+
+    if (num_jobs <= 0) return 0;
+
+    batch.scratch = malloc((size_t)pool_size(pool) * sizeof(MeshScratch));
+    if (!batch.scratch) return -1;
+    batch.jobs = jobs;
+    batch.out = out;
+    batch.background = background;
+
+    /* Build the shared rotation tables before any worker reads them */
+    init_mesh_tables();
+
+    pool_run(pool, render_job, &batch, num_jobs);
+    free(batch.scratch);
+    return 0;
+}
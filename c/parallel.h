@@ -0,0 +1,53 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include "mesh.h"
+
+/* Fixed-size pool of worker threads (POSIX threads) */
+typedef struct WorkerPool WorkerPool;
+
+/* Task callback: task is 0..num_tasks-1, worker is 0..pool_size()-1 */
+typedef void (*pool_task_fn)(void *ctx, int task, int worker);
+
+/* Create a pool with num_threads workers (0 = one per online CPU).
+ * Returns NULL if no thread could be started. */
+WorkerPool *pool_create(int num_threads);
+
+/* Stop and join all workers, then free the pool */
+void pool_destroy(WorkerPool *pool);
+
+/* Number of worker threads (1 for a NULL pool) */
+int pool_size(const WorkerPool *pool);
+
+/* Run fn for every task index and wait until all have finished.
+ * Tasks are handed out dynamically, in increasing index order.
+ * A NULL pool runs all tasks on the calling thread as worker 0. */
+void pool_run(WorkerPool *pool, pool_task_fn fn, void *ctx, int num_tasks);
+
+/* Tile-binned parallel version of render_mesh().
+ * The screen is split into num_bands horizontal bands of whole character
+ * rows (1..CHAR_HEIGHT). Faces are set up once, binned by their y-extent,
+ * and the bands are rasterized in parallel. Each band draws its faces in
+ * painter's order and owns its screen bytes, so the output is identical
+ * to render_mesh(). */
+void render_mesh_tiled(WorkerPool *pool, unsigned char *buf, const Mesh *m,
+                       int num_bands);
+
+/* One frame of a batch: the mesh (e.g. an animation frame's geometry)
+ * with the transform to render it at. The mesh's own theta/px/py/pz are
+ * ignored. */
+typedef struct {
+    const Mesh *mesh;
+    uint8_t theta;
+    int16_t px, py, pz;
+} RenderJob;
+
+/* Frame-parallel batch renderer for turntable and animation sweeps.
+ * Job n is rendered into out + n * SCREEN_SIZE after clearing it to the
+ * background color. Jobs are independent and spread over the pool; each
+ * worker reuses one MeshScratch, so no allocation happens per frame.
+ * Returns 0 on success, -1 if the scratch could not be allocated. */
+int render_frames(WorkerPool *pool, const RenderJob *jobs, int num_jobs,
+                  unsigned char *out, unsigned char background);
+
+#endif /* PARALLEL_H */
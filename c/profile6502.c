@@ -0,0 +1,129 @@
+/* profile6502.c - Headless cycle profiler for the 6502 renderer
+ *
+ * Runs an assembled demo (.prg) on the sim6502 core and reports exact
+ * cycle counts per frame and per routine. A frame ends when _anim_loop
+ * stores to buf_ready; the page flip is applied at once (as if vblank
+ * came immediately), so the loop never waits and IRQ time is excluded.
+ * See asm_harness.h.
+ *
+ * Usage: ./profile6502 [-n frames] program.prg labels.txt
+ * Labels come from 64tass -l (see asm/Makefile).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "asm_harness.h"
+
+#define PAL_CLOCK 985248            /* PAL C64 CPU clock, Hz */
+
+typedef struct {
+    uint16_t addr;
+    uint64_t self, inclusive;
+    uint32_t calls;
+} RoutineRow;
+
+/* Exact label, else the nearest code label below plus an offset (for
+ * local routines such as _rm_draw_face_0, which 64tass does not list) */
+static void routine_name(const SimLabels *labels, uint16_t addr, char *out, size_t size) {
+    const char *exact = sim_label_name(labels, addr);
+    const SimLabel *best = NULL;
+
+    if (exact) {
+        snprintf(out, size, "%s", exact);
+        return;
+    }
+    for (int n = 0; n < labels->count; n++) {
+        const SimLabel *l = &labels->labels[n];
+        if (l->value > addr || l->value < 0x0800) continue;
+        if (!best || l->value > best->value) best = l;
+    }
+    if (best) snprintf(out, size, "%s+%d", best->name, addr - best->value);
+    else snprintf(out, size, "sub_%04x", addr);
+}
+
+static int by_inclusive(const void *a, const void *b) {
+    const RoutineRow *ra = a, *rb = b;
+    uint64_t ka = ra->inclusive > ra->self ? ra->inclusive : ra->self;
+    uint64_t kb = rb->inclusive > rb->self ? rb->inclusive : rb->self;
+    if (ka != kb) return ka < kb ? 1 : -1;
+    return ra->addr - rb->addr;
+}
+
+int main(int argc, char **argv) {
+    int frames = 8;
+    int arg = 1;
+
+    if (arg + 1 < argc && strcmp(argv[arg], "-n") == 0) {
+        frames = atoi(argv[arg + 1]);
+        arg += 2;
+    }
+    if (argc - arg != 2 || frames < 1) {
+        fprintf(stderr, "Usage: %s [-n frames] program.prg labels.txt\n", argv[0]);
+        return 1;
+    }
+    const char *prg = argv[arg], *label_path = argv[arg + 1];
+
+    static AsmHarness h;
+    SimProfile *profile = calloc(1, sizeof(SimProfile));
+    uint8_t *entries = calloc(65536, 1);
+    if (!profile || !entries) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    /* The first frame includes initialization; counting starts after it */
+    if (asm_harness_open(&h, prg, label_path) < 0) return 1;
+    printf("%s: init + first frame %llu cycles\n", prg, (unsigned long long)h.cpu.cycles);
+
+    /* Every listed label is a routine entry for JMP tail calls */
+    for (int n = 0; n < h.labels.count; n++) entries[h.labels.labels[n].value] = 1;
+    h.cpu.profile = profile;
+    h.cpu.tail_calls = entries;
+
+    uint64_t total = 0;
+    for (int f = 0; f < frames; f++) {
+        int64_t c = asm_run_frame(&h);
+        if (c < 0) {
+            fprintf(stderr, "%s: frame %d did not finish (PC=$%04x)\n", prg, f + 1, h.cpu.pc);
+            return 1;
+        }
+        printf("frame %3d: %9lld cycles\n", f + 1, (long long)c);
+        total += c;
+    }
+    double per_frame = (double)total / frames;
+    printf("average:   %11.1f cycles/frame = %.2f FPS (PAL, no IRQ or vsync wait)\n\n",
+           per_frame, PAL_CLOCK / per_frame);
+
+    /* Routines: every JSR target seen, plus top-level code as address 0 */
+    int num_rows = 0;
+    RoutineRow *rows = malloc(65536 * sizeof(RoutineRow));
+    if (!rows) return 1;
+    for (int a = 0; a < 65536; a++) {
+        if (!profile->self[a] && !profile->calls[a]) continue;
+        rows[num_rows].addr = (uint16_t)a;
+        rows[num_rows].self = profile->self[a];
+        rows[num_rows].inclusive = a ? profile->inclusive[a] : total;
+        rows[num_rows].calls = profile->calls[a];
+        num_rows++;
+    }
+    qsort(rows, num_rows, sizeof(RoutineRow), by_inclusive);
+
+    printf("%-24s %5s %12s %14s %14s %6s\n", "routine", "addr", "calls/frame",
+           "self/frame", "incl/frame", "incl%");
+    for (int r = 0; r < num_rows; r++) {
+        char name[64];
+        if (rows[r].addr == 0) snprintf(name, sizeof(name), "(main loop)");
+        else routine_name(&h.labels, rows[r].addr, name, sizeof(name));
+
+        printf("%-24s $%04x %12.1f %14.1f %14.1f %5.1f%%\n", name, rows[r].addr,
+               (double)rows[r].calls / frames, (double)rows[r].self / frames,
+               (double)rows[r].inclusive / frames, 100.0 * rows[r].inclusive / total);
+    }
+
+    free(rows);
+    free(entries);
+    free(profile);
+    asm_harness_close(&h);
+    return 0;
+}
@@ -3,50 +3,70 @@
 #include <string.h>
 #include "rasterize.h"
 
-/* Lookup tables for bit patterns */
-static unsigned char top_row_mask[4];    /* Mask for top row pixels */
-static unsigned char bottom_row_mask[4]; /* Mask for bottom row pixels */
+/* Lookup tables for bit patterns, indexed by (left << 1) | right:
+ * 00 = neither, 01 = right only, 10 = left only, 11 = both */
+static const unsigned char top_row_mask[4] = {
+    0, PIXEL_TR_MASK, PIXEL_TL_MASK, PIXEL_TL_MASK | PIXEL_TR_MASK
+};
+static const unsigned char bottom_row_mask[4] = {
+    0, PIXEL_BR_MASK, PIXEL_BL_MASK, PIXEL_BL_MASK | PIXEL_BR_MASK
+};
+
+/* Lookup table for row offset: y * CHAR_WIDTH (avoids multiply by 40).
+ * Constant so the span helpers never need a lazy-init check. */
+static const int row_offset[CHAR_HEIGHT] = {
+      0,  40,  80, 120, 160, 200, 240, 280, 320, 360, 400, 440, 480,
+    520, 560, 600, 640, 680, 720, 760, 800, 840, 880, 920, 960
+};
 
-/* Lookup table for row offset: y * CHAR_WIDTH (avoids multiply by 40) */
-static int row_offset[CHAR_HEIGHT];
-
-static int tables_initialized = 0;
-
-static void init_tables(void) {
-    if (tables_initialized) return;
-
-    /* For top row (left pixel, right pixel): */
-    /* 00 = neither, 01 = right only, 10 = left only, 11 = both */
-    top_row_mask[0] = 0;                                      /* neither */
-    top_row_mask[1] = PIXEL_TR_MASK;                          /* right only */
-    top_row_mask[2] = PIXEL_TL_MASK;                          /* left only */
-    top_row_mask[3] = PIXEL_TL_MASK | PIXEL_TR_MASK;          /* both */
-
-    /* Same for bottom row */
-    bottom_row_mask[0] = 0;
-    bottom_row_mask[1] = PIXEL_BR_MASK;
-    bottom_row_mask[2] = PIXEL_BL_MASK;
-    bottom_row_mask[3] = PIXEL_BL_MASK | PIXEL_BR_MASK;
+void clear_screen(unsigned char *buf, unsigned char color) {
+    /* Color occupies 2 bits, replicate to all 4 pixel positions */
+    unsigned char byte = (color << PIXEL_TL_SHIFT) |
+                         (color << PIXEL_TR_SHIFT) |
+                         (color << PIXEL_BL_SHIFT) |
+                         (color << PIXEL_BR_SHIFT);
+    memset(buf, byte, SCREEN_SIZE);
+}
 
-    /* Row offsets: 0, 40, 80, 120, ... */
-    for (int y = 0; y < CHAR_HEIGHT; y++) {
-        row_offset[y] = y * CHAR_WIDTH;
+void clear_rect(unsigned char *buf, const CharRect *r, unsigned char color) {
+    unsigned char byte = (color << PIXEL_TL_SHIFT) |
+                         (color << PIXEL_TR_SHIFT) |
+                         (color << PIXEL_BL_SHIFT) |
+                         (color << PIXEL_BR_SHIFT);
+    if (r->col0 > r->col1) return;
+    for (int row = r->row0; row <= r->row1; row++) {
+        memset(buf + row_offset[row] + r->col0, byte, r->col1 - r->col0 + 1);
     }
+}
 
-    tables_initialized = 1;
+void reset_extents(RowExtents *e) {
+    memset(e->col0, CHAR_WIDTH, sizeof(e->col0));
+    memset(e->col1, 0, sizeof(e->col1));
 }
 
-void clear_screen(unsigned char *buf, unsigned char color) {
-    /* Color occupies 2 bits, replicate to all 4 pixel positions */
+void clear_extents(unsigned char *buf, RowExtents *e, unsigned char color) {
     unsigned char byte = (color << PIXEL_TL_SHIFT) |
                          (color << PIXEL_TR_SHIFT) |
                          (color << PIXEL_BL_SHIFT) |
                          (color << PIXEL_BR_SHIFT);
-    memset(buf, byte, SCREEN_SIZE);
+    for (int row = 0; row < CHAR_HEIGHT; row++) {
+        if (e->col0[row] <= e->col1[row]) {
+            memset(buf + row_offset[row] + e->col0[row], byte,
+                   e->col1[row] - e->col0[row] + 1);
+        }
+    }
+    reset_extents(e);
+}
+
+/* Widen the extent of scanline y's character row to span [xl, xr) */
+static void track_span(RowExtents *e, int y, int xl, int xr) {
+    if (xl >= xr) return;
+    int row = y >> 1;
+    if (xl >> 1 < e->col0[row]) e->col0[row] = (uint8_t)(xl >> 1);
+    if ((xr - 1) >> 1 > e->col1[row]) e->col1[row] = (uint8_t)((xr - 1) >> 1);
 }
 
 void set_pixel(unsigned char *buf, int x, int y, unsigned char color) {
-    init_tables();
     if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) return;
 
     int char_x = x >> 1;
@@ -71,7 +91,6 @@ void set_pixel(unsigned char *buf, int x, int y, unsigned char color) {
 }
 
 unsigned char get_pixel(const unsigned char *buf, int x, int y) {
-    init_tables();
     if (x < 0 || x >= SCREEN_WIDTH || y < 0 || y >= SCREEN_HEIGHT) return 0;
 
     int char_x = x >> 1;
@@ -91,13 +110,45 @@ unsigned char get_pixel(const unsigned char *buf, int x, int y) {
     return (buf[offset] >> shift) & 3;
 }
 
+/* Word-at-a-time fill for the full characters of a single-row span:
+ * each byte becomes (byte & keep) | bits. Eight characters per 64-bit
+ * load/store (SWAR), then a 32-bit step and a byte tail. Spans are at most
+ * 40 characters, so this is at most five wide stores per row.
+ * memcpy keeps the unaligned accesses well-defined; compilers lower it to
+ * plain loads and stores. */
+static void fill_masked(unsigned char *p, int n, unsigned char keep,
+                        unsigned char bits) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    uint64_t keep64 = ones * keep;
+    uint64_t bits64 = ones * bits;
+
+    while (n >= 8) {
+        uint64_t w;
+        memcpy(&w, p, 8);
+        w = (w & keep64) | bits64;
+        memcpy(p, &w, 8);
+        p += 8;
+        n -= 8;
+    }
+    if (n >= 4) {
+        uint32_t w;
+        memcpy(&w, p, 4);
+        w = (w & (uint32_t)keep64) | (uint32_t)bits64;
+        memcpy(p, &w, 4);
+        p += 4;
+        n -= 4;
+    }
+    while (n-- > 0) {
+        *p = (*p & keep) | bits;
+        p++;
+    }
+}
+
 /* Draw a horizontal span on a TOP row (y is even).
  * Only modifies top 4 bits of each character byte, preserving bottom row.
  * Assumes all coordinates are on-screen.
  */
-static void draw_span_top(unsigned char *buf, int y, int xl, int xr, unsigned char color) {
-    init_tables();
-
+void draw_span_top(unsigned char *buf, int y, int xl, int xr, unsigned char color) {
     if (xl >= xr) return;  /* Empty interval */
 
     int char_y = y >> 1;
@@ -121,8 +172,9 @@ static void draw_span_top(unsigned char *buf, int y, int xl, int xr, unsigned ch
     }
 
     /* Full chars (both pixels, preserve bottom row) */
-    for (int char_x = full_start; char_x < full_end; char_x++) {
-        row[char_x] = (row[char_x] & ~mask_full) | color_bits;
+    if (full_start < full_end) {
+        fill_masked(row + full_start, full_end - full_start,
+                    (unsigned char)~mask_full, color_bits);
     }
 
     /* Right partial (xr is odd → only left pixel) */
@@ -135,9 +187,7 @@ static void draw_span_top(unsigned char *buf, int y, int xl, int xr, unsigned ch
  * Only modifies bottom 4 bits of each character byte, preserving top row.
  * Assumes all coordinates are on-screen.
  */
-static void draw_span_bottom(unsigned char *buf, int y, int xl, int xr, unsigned char color) {
-    init_tables();
-
+void draw_span_bottom(unsigned char *buf, int y, int xl, int xr, unsigned char color) {
     if (xl >= xr) return;  /* Empty interval */
 
     int char_y = y >> 1;
@@ -161,8 +211,9 @@ static void draw_span_bottom(unsigned char *buf, int y, int xl, int xr, unsigned
     }
 
     /* Full chars (both pixels, preserve top row) */
-    for (int char_x = full_start; char_x < full_end; char_x++) {
-        row[char_x] = (row[char_x] & ~mask_full) | color_bits;
+    if (full_start < full_end) {
+        fill_masked(row + full_start, full_end - full_start,
+                    (unsigned char)~mask_full, color_bits);
     }
 
     /* Right partial (xr is odd → only left pixel) */
@@ -181,10 +232,8 @@ static void draw_span_bottom(unsigned char *buf, int y, int xl, int xr, unsigned
  *   2. Middle full chars: write color_pattern directly (no masking)
  *   3. Right partial char (if xr is odd): only left pixel active
  */
-static void draw_dual_row_simple(unsigned char *buf, int y, int xl, int xr,
-                                 unsigned char color) {
-    init_tables();
-
+void draw_dual_row_simple(unsigned char *buf, int y, int xl, int xr,
+                          unsigned char color) {
     if (xl >= xr) return;  /* Empty interval */
 
     int char_y = y >> 1;
@@ -211,9 +260,10 @@ static void draw_dual_row_simple(unsigned char *buf, int y, int xl, int xr,
         row[char_start] = (row[char_start] & ~mask) | (color_pattern & mask);
     }
 
-    /* Full characters: all 4 pixels, no masking needed */
-    for (int char_x = full_start; char_x < full_end; char_x++) {
-        row[char_x] = color_pattern;
+    /* Full characters: all 4 pixels, no masking needed, so this is a
+     * plain byte fill (memset is already vectorized by the C library) */
+    if (full_start < full_end) {
+        memset(row + full_start, color_pattern, full_end - full_start);
     }
 
     /* Right partial character (xr is odd → only left pixel active) */
@@ -308,15 +358,135 @@ static void swap_int(int *a, int *b) {
     int t = *a; *a = *b; *b = t;
 }
 
-void draw_triangle(unsigned char *buf, int ax, int ay, int bx, int by,
+/* Scissor a span [xl, xr) to the screen width (may leave it empty) */
+static void clip_span(int *xl, int *xr) {
+    if (*xl < 0) *xl = 0;
+    if (*xr > SCREEN_WIDTH) *xr = SCREEN_WIDTH;
+}
+
+void clear_coverage(Coverage *c) {
+    memset(c, 0, sizeof(*c));
+}
+
+/* Bits xl <= x < xr of the 64-pixel word starting at pixel base */
+static uint64_t word_mask(int base, int xl, int xr) {
+    int lo = xl > base ? xl - base : 0;
+    int hi = xr < base + 64 ? xr - base : 64;
+    if (lo >= hi) return 0;
+    uint64_t upper = hi == 64 ? ~0ULL : (1ULL << hi) - 1;
+    return upper & ~((1ULL << lo) - 1);
+}
+
+/* Front-to-back span: draw the runs of [xl, xr) on scanline y that are not
+ * covered yet, then mark the whole span covered */
+static void draw_span_uncovered(unsigned char *buf, Coverage *c, int y, int xl, int xr,
+                                unsigned char color) {
+    uint64_t *row = c->bits[y];
+    uint64_t span0 = word_mask(0, xl, xr), span1 = word_mask(64, xl, xr);
+
+    if ((span0 & ~row[0]) == 0 && (span1 & ~row[1]) == 0) return;  /* Hidden */
+
+    for (int x = xl; x < xr; ) {
+        while (x < xr && (row[x >> 6] >> (x & 63) & 1)) x++;
+        int start = x;
+        while (x < xr && !(row[x >> 6] >> (x & 63) & 1)) x++;
+        if (start == x) break;
+        if (y & 1) draw_span_bottom(buf, y, start, x, color);
+        else draw_span_top(buf, y, start, x, color);
+    }
+    row[0] |= span0;
+    row[1] |= span1;
+}
+
+/* Rasterize one trapezoid from scanline y to y_end (exclusive), drawing only
+ * scanlines inside the window [y_lo, y_hi). The window bounds are even, so a
+ * dual-row pair is never split; rows outside it are stepped over in one go
+ * (x + n*dx equals n single-row steps exactly).
+ * The long edge state is passed by pointer because it carries over from the
+ * top trapezoid into the bottom one (recomputing it would round differently).
+ * With a coverage mask, each scanline is drawn on its own, skipping pixels
+ * already covered (the spans are the same as the dual-row path's).
+ * With row extents, each drawn span also widens its character row's extent.
+ * Returns the scanline where the walk stopped (always y_end). */
+static int raster_trapezoid(unsigned char *buf, int y, int y_end,
+                            int *x_long_io, int dx_long, int x_short, int dx_short,
+                            int b_on_left, unsigned char color, int y_lo, int y_hi,
+                            Coverage *cover, RowExtents *ext) {
+    int x_long = *x_long_io;
+
+    /* Skip scanlines above the window */
+    if (y < y_lo) {
+        int n = (y_end < y_lo ? y_end : y_lo) - y;
+        x_long += n * dx_long;
+        x_short += n * dx_short;
+        y += n;
+    }
+
+    while (y < y_end && y < y_hi) {
+        int y_next = y + 1;
+
+        /* Get x endpoints for current scanline [xl, xr) */
+        int xl = (b_on_left ? x_short : x_long) >> 8;
+        int xr = (b_on_left ? x_long : x_short) >> 8;
+        if (xl > xr) swap_int(&xl, &xr);
+        clip_span(&xl, &xr);
+        if (ext) track_span(ext, y, xl, xr);
+
+        if (cover) {
+            if (xl < xr) draw_span_uncovered(buf, cover, y, xl, xr, color);
+            x_long += dx_long;
+            x_short += dx_short;
+            y++;
+        } else if (((y & 1) == 0) && (y_next < y_end)) {
+            /* Two rows at once: advance to get second row endpoints */
+            int x_long2 = x_long + dx_long;
+            int x_short2 = x_short + dx_short;
+
+            int xl2 = (b_on_left ? x_short2 : x_long2) >> 8;
+            int xr2 = (b_on_left ? x_long2 : x_short2) >> 8;
+            if (xl2 > xr2) swap_int(&xl2, &xr2);
+            clip_span(&xl2, &xr2);
+            if (ext) track_span(ext, y_next, xl2, xr2);
+
+            draw_dual_row_intervals(buf, y, xl, xr, xl2, xr2, color);
+
+            x_long += dx_long << 1;
+            x_short += dx_short << 1;
+            y += 2;
+        } else if (((y & 1) == 0) && (y_next >= y_end)) {
+            /* Single row at even y - draw top row only */
+            draw_span_top(buf, y, xl, xr, color);
+            x_long += dx_long;
+            x_short += dx_short;
+            y++;
+        } else {
+            /* Odd y - draw single span on bottom row */
+            draw_span_bottom(buf, y, xl, xr, color);
+            x_long += dx_long;
+            x_short += dx_short;
+            y++;
+        }
+    }
+
+    /* Skip scanlines below the window (keeps x_long right for the next trapezoid) */
+    if (y < y_end) {
+        x_long += (y_end - y) * dx_long;
+        y = y_end;
+    }
+
+    *x_long_io = x_long;
+    return y;
+}
+
+int setup_triangle(TriEdges *t, int ax, int ay, int bx, int by,
                    int cx, int cy, unsigned char color) {
     /* Backface culling: check winding order BEFORE sorting.
      * det(B-A, C-A) = (bx-ax)*(cy-ay) - (by-ay)*(cx-ax)
      * If det < 0, triangle is backfacing (clockwise), reject it.
-     * Fits in 16 bits: coords are 0-79 x 0-49, max det magnitude ~7742. */
+     * Fits in 32 bits: coords are within the guard band. */
     int det = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
     if (det < 0) {
-        return;  /* Backface: clockwise winding, cull */
+        return 0;  /* Backface: clockwise winding, cull */
     }
 
     /* Sort vertices by y-coordinate: A.y <= B.y <= C.y
@@ -330,113 +500,126 @@ void draw_triangle(unsigned char *buf, int ax, int ay, int bx, int by,
 
     /* Degenerate: all points on same scanline */
     if (ay == cy) {
-        return;  /* Zero-height triangle, nothing to draw */
+        return 0;  /* Zero-height triangle, nothing to draw */
     }
 
     /* b_on_left: derived from original det and swap parity.
      * Each swap negates the cross product sign.
      * det >= 0, so b_on_left = true iff odd number of swaps. */
-    int b_on_left = (swaps & 1);
+    t->b_on_left = (uint8_t)(swaps & 1);
+    t->color = color;
+    t->ay = (int16_t)ay;
+    t->by = (int16_t)by;
+    t->cy = (int16_t)cy;
 
     /* Compute edge slopes in 8.8 fixed point: 256 * dx / dy */
-    int dx_ac = ((cx - ax) << 8) / (cy - ay);
+    t->dx_ac = ((cx - ax) << 8) / (cy - ay);
 
     /* Start positions: at scanline ay, we sample at ay + 0.5
      * So x = ax + slope * 0.5 = ax + dx/2 */
-    int x_long = (ax << 8) + (dx_ac >> 1);
-    int x_short;
+    t->x_long = (ax << 8) + (t->dx_ac >> 1);
+
+    /* Top short edge (A-B), only walked when ay < by */
+    if (ay < by) {
+        t->dx_ab = ((bx - ax) << 8) / (by - ay);
+        t->x_top = (ax << 8) + (t->dx_ab >> 1);
+    } else {
+        t->dx_ab = 0;
+        t->x_top = 0;
+    }
 
-    int y = ay;
+    /* Bottom short edge (B-C), starts at B sampling at by + 0.5 */
+    if (by < cy) {
+        t->dx_bc = ((cx - bx) << 8) / (cy - by);
+        t->x_bot = (bx << 8) + (t->dx_bc >> 1);
+    } else {
+        t->dx_bc = 0;
+        t->x_bot = 0;
+    }
+
+    return 1;
+}
+
+static void raster_rows(unsigned char *buf, const TriEdges *t, int y_lo, int y_hi,
+                        Coverage *cover, RowExtents *ext) {
+    int x_long = t->x_long;
+    int y = t->ay;
+
+    /* Nothing to do if the triangle misses the window */
+    if (t->cy <= y_lo || t->ay >= y_hi) return;
 
     /* Top trapezoid: from A.y to B.y */
-    if (ay < by) {
-        int dx_ab = ((bx - ax) << 8) / (by - ay);
-        x_short = (ax << 8) + (dx_ab >> 1);
-
-        while (y < by) {
-            int y_next = y + 1;
-
-            /* Get x endpoints for current scanline [xl, xr) */
-            int xl = (b_on_left ? x_short : x_long) >> 8;
-            int xr = (b_on_left ? x_long : x_short) >> 8;
-            if (xl > xr) swap_int(&xl, &xr);
-
-            /* Check if we can process two rows */
-            if (((y & 1) == 0) && (y_next < by)) {
-                /* Advance to get second row endpoints */
-                int x_long2 = x_long + dx_ac;
-                int x_short2 = x_short + dx_ab;
-
-                int xl2 = (b_on_left ? x_short2 : x_long2) >> 8;
-                int xr2 = (b_on_left ? x_long2 : x_short2) >> 8;
-                if (xl2 > xr2) swap_int(&xl2, &xr2);
-
-                draw_dual_row_intervals(buf, y, xl, xr, xl2, xr2, color);
-
-                x_long += dx_ac << 1;
-                x_short += dx_ab << 1;
-                y += 2;
-            } else if (((y & 1) == 0) && (y_next >= by)) {
-                /* Single row at even y - draw top row only */
-                draw_span_top(buf, y, xl, xr, color);
-                x_long += dx_ac;
-                x_short += dx_ab;
-                y++;
-            } else {
-                /* Odd y - draw single span on bottom row */
-                draw_span_bottom(buf, y, xl, xr, color);
-                x_long += dx_ac;
-                x_short += dx_ab;
-                y++;
-            }
+    if (t->ay < t->by) {
+        y = raster_trapezoid(buf, y, t->by, &x_long, t->dx_ac,
+                             t->x_top, t->dx_ab, t->b_on_left, t->color,
+                             y_lo, y_hi, cover, ext);
+    }
+
+    /* Bottom trapezoid: from B.y to C.y.
+     * x_long continues from where the top trapezoid left off.
+     * For flat-top triangles (ay == by), x_long was initialized correctly. */
+    if (t->by < t->cy) {
+        raster_trapezoid(buf, y, t->cy, &x_long, t->dx_ac,
+                         t->x_bot, t->dx_bc, t->b_on_left, t->color,
+                         y_lo, y_hi, cover, ext);
+    }
+}
+
+void raster_triangle_rows(unsigned char *buf, const TriEdges *t,
+                          int y_lo, int y_hi) {
+    raster_rows(buf, t, y_lo, y_hi, NULL, NULL);
+}
+
+void raster_triangle(unsigned char *buf, const TriEdges *t) {
+    raster_rows(buf, t, 0, SCREEN_HEIGHT, NULL, NULL);
+}
+
+void raster_triangle_track(unsigned char *buf, const TriEdges *t, RowExtents *ext) {
+    raster_rows(buf, t, 0, SCREEN_HEIGHT, NULL, ext);
+}
+
+void raster_triangle_front(unsigned char *buf, const TriEdges *t, Coverage *cover) {
+    raster_rows(buf, t, 0, SCREEN_HEIGHT, cover, NULL);
+}
+
+void coverage_extents(const Coverage *c, RowExtents *ext) {
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) {
+            if (c->bits[y][x >> 6] >> (x & 63) & 1) track_span(ext, y, x, x + 1);
         }
     }
+}
 
-    /* Bottom trapezoid: from B.y to C.y */
-    if (by < cy) {
-        int dx_bc = ((cx - bx) << 8) / (cy - by);
-
-        /* x_long continues from where the top trapezoid left off.
-         * Do NOT recompute - that would accumulate rounding differently.
-         * For flat-top triangles (ay == by), x_long was initialized correctly. */
-
-        /* Short edge starts at B, sampling at by + 0.5 */
-        x_short = (bx << 8) + (dx_bc >> 1);
-
-        while (y < cy) {
-            int y_next = y + 1;
-
-            /* [xl, xr) */
-            int xl = (b_on_left ? x_short : x_long) >> 8;
-            int xr = (b_on_left ? x_long : x_short) >> 8;
-            if (xl > xr) swap_int(&xl, &xr);
-
-            if (((y & 1) == 0) && (y_next < cy)) {
-                int x_long2 = x_long + dx_ac;
-                int x_short2 = x_short + dx_bc;
-
-                int xl2 = (b_on_left ? x_short2 : x_long2) >> 8;
-                int xr2 = (b_on_left ? x_long2 : x_short2) >> 8;
-                if (xl2 > xr2) swap_int(&xl2, &xr2);
-
-                draw_dual_row_intervals(buf, y, xl, xr, xl2, xr2, color);
-
-                x_long += dx_ac << 1;
-                x_short += dx_bc << 1;
-                y += 2;
-            } else if (((y & 1) == 0) && (y_next >= cy)) {
-                /* Single row at even y - draw top row only */
-                draw_span_top(buf, y, xl, xr, color);
-                x_long += dx_ac;
-                x_short += dx_bc;
-                y++;
-            } else {
-                /* Odd y - draw single span on bottom row */
-                draw_span_bottom(buf, y, xl, xr, color);
-                x_long += dx_ac;
-                x_short += dx_bc;
-                y++;
-            }
+void draw_triangle(unsigned char *buf, int ax, int ay, int bx, int by,
+                   int cx, int cy, unsigned char color) {
+    TriEdges t;
+    if (setup_triangle(&t, ax, ay, bx, by, cx, cy, color)) {
+        raster_triangle(buf, &t);
+    }
+}
+
+/* Triangles set up per pass of draw_triangles (keeps the edge table on the stack) */
+#define BATCH_SIZE 64
+
+void draw_triangles(unsigned char *buf, const int16_t *sx, const int16_t *sy,
+                    const uint8_t *fi, const uint8_t *fj, const uint8_t *fk,
+                    const uint8_t *col, int count) {
+    TriEdges edges[BATCH_SIZE];
+
+    for (int base = 0; base < count; base += BATCH_SIZE) {
+        int end = base + BATCH_SIZE < count ? base + BATCH_SIZE : count;
+        int n = 0;
+
+        /* Setup pass: cull, sort and compute slopes for the whole batch */
+        for (int f = base; f < end; f++) {
+            int vi = fi[f], vj = fj[f], vk = fk[f];
+            n += setup_triangle(&edges[n], sx[vi], sy[vi], sx[vj], sy[vj],
+                                sx[vk], sy[vk], col[f]);
+        }
+
+        /* Raster pass: surviving triangles in submission order */
+        for (int t = 0; t < n; t++) {
+            raster_triangle(buf, &edges[t]);
         }
     }
 }
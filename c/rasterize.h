@@ -1,6 +1,8 @@
 #ifndef RASTERIZE_H
 #define RASTERIZE_H
 
+#include <stdint.h>
+
 /* Screen dimensions */
 #define SCREEN_WIDTH  80   /* Chunky pixels */
 #define SCREEN_HEIGHT 50   /* Chunky pixels */
@@ -8,6 +10,12 @@
 #define CHAR_HEIGHT   25   /* Characters */
 #define SCREEN_SIZE   1000 /* Bytes in buffer */
 
+/* Guard band: triangle vertices may lie up to this many pixels outside the
+ * screen on any side. Spans are scissored to the screen, and the bound keeps
+ * the 8.8 edge walk and backface determinant inside 32 bits. Geometry
+ * beyond it must be clipped first (see setup_mesh). */
+#define GUARD_BAND 512
+
 /* Fixed-point 8.8 format */
 #define FP_SHIFT 8
 #define FP_ONE   (1 << FP_SHIFT)
@@ -38,10 +46,100 @@
 /* Clear the screen buffer to a single color (0-3) */
 void clear_screen(unsigned char *buf, unsigned char color);
 
-/* Draw a filled triangle with vertices (ax,ay), (bx,by), (cx,cy) and color (0-3) */
+/* Character rectangle, rows row0..row1 and columns col0..col1 inclusive
+ * (empty if row0 > row1 or col0 > col1) */
+typedef struct {
+    int row0, row1, col0, col1;
+} CharRect;
+
+/* Clear only the characters of a rectangle (dirty-rectangle clear) */
+void clear_rect(unsigned char *buf, const CharRect *r, unsigned char color);
+
+/* Characters written in each character row, columns col0[r]..col1[r]
+ * inclusive (empty while col0[r] > col1[r]). Filled in by
+ * raster_triangle_track() and cleared again by clear_extents(), so a buffer
+ * is cleared row by row where its last frame drew instead of whole. */
+typedef struct {
+    uint8_t col0[CHAR_HEIGHT], col1[CHAR_HEIGHT];
+} RowExtents;
+
+/* Mark every row empty (col0 = CHAR_WIDTH, col1 = 0, as in rasterizer.asm) */
+void reset_extents(RowExtents *e);
+
+/* Clear the characters of every row extent to color, then reset them */
+void clear_extents(unsigned char *buf, RowExtents *e, unsigned char color);
+
+/* Draw a filled triangle with vertices (ax,ay), (bx,by), (cx,cy) and color (0-3).
+ * Vertices may be off-screen within GUARD_BAND; output is clipped to the screen. */
 void draw_triangle(unsigned char *buf, int ax, int ay, int bx, int by,
                    int cx, int cy, unsigned char color);
 
+/* Span fillers used by the rasterizer, for benchmarks. Pixels xl <= x < xr
+ * of one scanline (top: y even, bottom: y odd) or of both scanlines of the
+ * character row at even y (dual row), keeping the other pixels of each byte.
+ * Coordinates must be on-screen. */
+void draw_span_top(unsigned char *buf, int y, int xl, int xr, unsigned char color);
+void draw_span_bottom(unsigned char *buf, int y, int xl, int xr, unsigned char color);
+void draw_dual_row_simple(unsigned char *buf, int y, int xl, int xr, unsigned char color);
+
+/* Packed edge table entry: one set-up triangle, ready to rasterize.
+ * Vertices are sorted by y; x positions and slopes are 8.8 fixed point,
+ * sampled at scanline centers. */
+typedef struct {
+    int32_t x_long, dx_ac;  /* Long edge A-C */
+    int32_t x_top, dx_ab;   /* Short edge A-B (top trapezoid) */
+    int32_t x_bot, dx_bc;   /* Short edge B-C (bottom trapezoid) */
+    int16_t ay, by, cy;     /* Sorted scanlines */
+    uint8_t b_on_left;      /* 1 if B is on the left of the long edge */
+    uint8_t color;
+} TriEdges;
+
+/* Cull, y-sort and compute slopes for one triangle.
+ * Returns 1 if *t was filled in, 0 if the triangle is backfacing or empty. */
+int setup_triangle(TriEdges *t, int ax, int ay, int bx, int by,
+                   int cx, int cy, unsigned char color);
+
+/* Rasterize a triangle prepared by setup_triangle() */
+void raster_triangle(unsigned char *buf, const TriEdges *t);
+
+/* Rasterize only scanlines y_lo <= y < y_hi of a set-up triangle.
+ * y_lo and y_hi must be even (character-row aligned), so no screen byte is
+ * shared with rows outside the window. Output inside the window is identical
+ * to raster_triangle(). */
+void raster_triangle_rows(unsigned char *buf, const TriEdges *t,
+                          int y_lo, int y_hi);
+
+/* Same as raster_triangle(), also widening each character row's extent to
+ * the characters written (NULL extents: no tracking) */
+void raster_triangle_track(unsigned char *buf, const TriEdges *t, RowExtents *ext);
+
+/* Span buffer for front-to-back drawing: bit x of bits[y] is set once
+ * pixel (x, y) has been drawn. 80 bits per scanline (two words). */
+typedef struct {
+    uint64_t bits[SCREEN_HEIGHT][2];
+} Coverage;
+
+/* Mark every pixel uncovered */
+void clear_coverage(Coverage *c);
+
+/* Rasterize a set-up triangle behind everything drawn so far: only pixels
+ * not yet covered are written, and the triangle's pixels become covered.
+ * Drawing triangles front to back this way gives the same screen as
+ * raster_triangle() back to front, writing each pixel once. */
+void raster_triangle_front(unsigned char *buf, const TriEdges *t, Coverage *cover);
+
+/* Widen each character row's extent to the covered pixels (the characters
+ * written by raster_triangle_front() since the coverage was cleared) */
+void coverage_extents(const Coverage *c, RowExtents *ext);
+
+/* Draw a batch of indexed triangles.
+ * sx/sy are screen coordinates per vertex (SoA), fi/fj/fk index them per face,
+ * col is the color per face. Faces are drawn in index order (painter's order),
+ * same output as calling draw_triangle() for each face. */
+void draw_triangles(unsigned char *buf, const int16_t *sx, const int16_t *sy,
+                    const uint8_t *fi, const uint8_t *fj, const uint8_t *fk,
+                    const uint8_t *col, int count);
+
 /* Set a single chunky pixel (for reference rasterizer) */
 void set_pixel(unsigned char *buf, int x, int y, unsigned char color);
 
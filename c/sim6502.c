@@ -0,0 +1,598 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim6502.h"
+
+/* Addressing modes */
+enum {
+    IMP, IMM, ZP, ZPX, ZPY, ABS, ABX, ABY, IND, IZX, IZY, REL
+};
+
+/* Mode and base cycle count per opcode; 0 cycles = undocumented */
+static const uint8_t mode_table[256] = {
+/*       0    1    2    3    4    5    6    7    8    9    A    B    C    D    E    F */
+/*0*/  IMP, IZX, IMP, IMP, IMP, ZP,  ZP,  IMP, IMP, IMM, IMP, IMP, IMP, ABS, ABS, IMP,
+/*1*/  REL, IZY, IMP, IMP, IMP, ZPX, ZPX, IMP, IMP, ABY, IMP, IMP, IMP, ABX, ABX, IMP,
+/*2*/  ABS, IZX, IMP, IMP, ZP,  ZP,  ZP,  IMP, IMP, IMM, IMP, IMP, ABS, ABS, ABS, IMP,
+/*3*/  REL, IZY, IMP, IMP, IMP, ZPX, ZPX, IMP, IMP, ABY, IMP, IMP, IMP, ABX, ABX, IMP,
+/*4*/  IMP, IZX, IMP, IMP, IMP, ZP,  ZP,  IMP, IMP, IMM, IMP, IMP, ABS, ABS, ABS, IMP,
+/*5*/  REL, IZY, IMP, IMP, IMP, ZPX, ZPX, IMP, IMP, ABY, IMP, IMP, IMP, ABX, ABX, IMP,
+/*6*/  IMP, IZX, IMP, IMP, IMP, ZP,  ZP,  IMP, IMP, IMM, IMP, IMP, IND, ABS, ABS, IMP,
+/*7*/  REL, IZY, IMP, IMP, IMP, ZPX, ZPX, IMP, IMP, ABY, IMP, IMP, IMP, ABX, ABX, IMP,
+/*8*/  IMP, IZX, IMP, IMP, ZP,  ZP,  ZP,  IMP, IMP, IMP, IMP, IMP, ABS, ABS, ABS, IMP,
+/*9*/  REL, IZY, IMP, IMP, ZPX, ZPX, ZPY, IMP, IMP, ABY, IMP, IMP, IMP, ABX, IMP, IMP,
+/*A*/  IMM, IZX, IMM, IMP, ZP,  ZP,  ZP,  IMP, IMP, IMM, IMP, IMP, ABS, ABS, ABS, IMP,
+/*B*/  REL, IZY, IMP, IMP, ZPX, ZPX, ZPY, IMP, IMP, ABY, IMP, IMP, ABX, ABX, ABY, IMP,
+/*C*/  IMM, IZX, IMP, IMP, ZP,  ZP,  ZP,  IMP, IMP, IMM, IMP, IMP, ABS, ABS, ABS, IMP,
+/*D*/  REL, IZY, IMP, IMP, IMP, ZPX, ZPX, IMP, IMP, ABY, IMP, IMP, IMP, ABX, ABX, IMP,
+/*E*/  IMM, IZX, IMP, IMP, ZP,  ZP,  ZP,  IMP, IMP, IMM, IMP, IMP, ABS, ABS, ABS, IMP,
+/*F*/  REL, IZY, IMP, IMP, IMP, ZPX, ZPX, IMP, IMP, ABY, IMP, IMP, IMP, ABX, ABX, IMP,
+};
+
+static const uint8_t cycle_table[256] = {
+/*     0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F */
+/*0*/  7, 6, 0, 0, 0, 3, 5, 0, 3, 2, 2, 0, 0, 4, 6, 0,
+/*1*/  2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,
+/*2*/  6, 6, 0, 0, 3, 3, 5, 0, 4, 2, 2, 0, 4, 4, 6, 0,
+/*3*/  2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,
+/*4*/  6, 6, 0, 0, 0, 3, 5, 0, 3, 2, 2, 0, 3, 4, 6, 0,
+/*5*/  2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,
+/*6*/  6, 6, 0, 0, 0, 3, 5, 0, 4, 2, 2, 0, 5, 4, 6, 0,
+/*7*/  2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,
+/*8*/  0, 6, 0, 0, 3, 3, 3, 0, 2, 0, 2, 0, 4, 4, 4, 0,
+/*9*/  2, 6, 0, 0, 4, 4, 4, 0, 2, 5, 2, 0, 0, 5, 0, 0,
+/*A*/  2, 6, 2, 0, 3, 3, 3, 0, 2, 2, 2, 0, 4, 4, 4, 0,
+/*B*/  2, 5, 0, 0, 4, 4, 4, 0, 2, 4, 2, 0, 4, 4, 4, 0,
+/*C*/  2, 6, 0, 0, 3, 3, 5, 0, 2, 2, 2, 0, 4, 4, 6, 0,
+/*D*/  2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,
+/*E*/  2, 6, 0, 0, 3, 3, 5, 0, 2, 2, 2, 0, 4, 4, 6, 0,
+/*F*/  2, 5, 0, 0, 0, 4, 6, 0, 2, 4, 0, 0, 0, 4, 7, 0,
+};
+
+void sim_init(Sim6502 *cpu) {
+    memset(cpu, 0, sizeof(*cpu));
+    cpu->s = 0xff;
+    cpu->p = SIM_FLAG_U | SIM_FLAG_I;
+}
+
+int sim_load_prg(Sim6502 *cpu, const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return -1;
+
+    int lo = fgetc(f), hi = fgetc(f);
+    if (lo == EOF || hi == EOF) {
+        fclose(f);
+        return -1;
+    }
+    int addr = lo | (hi << 8);
+    size_t n = fread(cpu->mem + addr, 1, sizeof(cpu->mem) - addr, f);
+    fclose(f);
+    return n > 0 ? addr : -1;
+}
+
+int sim_basic_sys(const Sim6502 *cpu) {
+    /* Skip the next-line link and line number, then find the SYS token */
+    for (int a = 0x0805; a < 0x0900 && cpu->mem[a]; a++) {
+        if (cpu->mem[a] != 0x9e) continue;
+        int value = 0, digits = 0;
+        for (a++; cpu->mem[a] == ' '; a++) {}
+        for (; cpu->mem[a] >= '0' && cpu->mem[a] <= '9'; a++, digits++) {
+            value = value * 10 + (cpu->mem[a] - '0');
+        }
+        return digits && value < 65536 ? value : -1;
+    }
+    return -1;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Memory and stack                                                          */
+/* ------------------------------------------------------------------------ */
+
+static inline uint8_t read8(const Sim6502 *cpu, uint16_t addr) {
+    return cpu->mem[addr];
+}
+
+static inline void write8(Sim6502 *cpu, uint16_t addr, uint8_t value) {
+    cpu->mem[addr] = value;
+    if (cpu->on_write) cpu->on_write(cpu, addr, value);
+}
+
+static inline uint8_t fetch8(Sim6502 *cpu) {
+    return cpu->mem[cpu->pc++];
+}
+
+static inline uint16_t fetch16(Sim6502 *cpu) {
+    uint16_t lo = fetch8(cpu);
+    return lo | (fetch8(cpu) << 8);
+}
+
+static inline void push8(Sim6502 *cpu, uint8_t value) {
+    write8(cpu, 0x0100 | cpu->s--, value);
+}
+
+static inline uint8_t pull8(Sim6502 *cpu) {
+    return cpu->mem[0x0100 | ++cpu->s];
+}
+
+/* ------------------------------------------------------------------------ */
+/* Call tracking for the profile                                             */
+/* ------------------------------------------------------------------------ */
+
+static void enter_call(Sim6502 *cpu, uint16_t target, uint64_t start) {
+    if (cpu->depth >= SIM_MAX_CALL_DEPTH) return;
+    cpu->call_target[cpu->depth] = target;
+    cpu->call_sp[cpu->depth] = cpu->s;
+    cpu->call_start[cpu->depth] = start;
+    cpu->depth++;
+    if (cpu->profile) cpu->profile->calls[target]++;
+}
+
+/* After an RTS: close every call whose return address is now off the
+ * stack (including frames abandoned with PLA/TXS) */
+static void leave_calls(Sim6502 *cpu, uint64_t end) {
+    while (cpu->depth > 0 && cpu->call_sp[cpu->depth - 1] <= cpu->s) {
+        cpu->depth--;
+        if (cpu->profile) {
+            cpu->profile->inclusive[cpu->call_target[cpu->depth]] +=
+                end - cpu->call_start[cpu->depth];
+        }
+    }
+}
+
+/* JMP into another routine: the callee will return for the current frame.
+ * A jump to the current routine's own entry is a loop (e.g. _trap_loop). */
+static void tail_call(Sim6502 *cpu, uint16_t target, uint64_t now) {
+    if (cpu->depth == 0) return;
+    int top = cpu->depth - 1;
+    if (cpu->call_target[top] == target) return;
+    cpu->profile->inclusive[cpu->call_target[top]] += now - cpu->call_start[top];
+    cpu->call_target[top] = target;
+    cpu->call_start[top] = now;
+    cpu->profile->calls[target]++;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Addressing                                                                */
+/* ------------------------------------------------------------------------ */
+
+static inline int page_crossed(uint16_t a, uint16_t b) {
+    return (a ^ b) & 0xff00;
+}
+
+/* Effective address. Indexed reads take an extra cycle when the index
+ * crosses a page; stores and read-modify-write always pay it (in the
+ * base cycle count), so they pass penalty = 0. */
+static uint16_t address(Sim6502 *cpu, int mode, int penalty, int *extra) {
+    uint16_t base, addr;
+    uint8_t zp;
+
+    switch (mode) {
+    case ZP:
+        return fetch8(cpu);
+    case ZPX:
+        return (uint8_t)(fetch8(cpu) + cpu->x);
+    case ZPY:
+        return (uint8_t)(fetch8(cpu) + cpu->y);
+    case ABS:
+        return fetch16(cpu);
+    case ABX:
+        base = fetch16(cpu);
+        addr = base + cpu->x;
+        if (penalty && page_crossed(base, addr)) (*extra)++;
+        return addr;
+    case ABY:
+        base = fetch16(cpu);
+        addr = base + cpu->y;
+        if (penalty && page_crossed(base, addr)) (*extra)++;
+        return addr;
+    case IZX:
+        zp = fetch8(cpu) + cpu->x;
+        return read8(cpu, zp) | (read8(cpu, (uint8_t)(zp + 1)) << 8);
+    case IZY:
+        zp = fetch8(cpu);
+        base = read8(cpu, zp) | (read8(cpu, (uint8_t)(zp + 1)) << 8);
+        addr = base + cpu->y;
+        if (penalty && page_crossed(base, addr)) (*extra)++;
+        return addr;
+    default:
+        return 0;
+    }
+}
+
+static inline uint8_t operand(Sim6502 *cpu, int mode, int *extra) {
+    if (mode == IMM) return fetch8(cpu);
+    return read8(cpu, address(cpu, mode, 1, extra));
+}
+
+/* ------------------------------------------------------------------------ */
+/* ALU                                                                       */
+/* ------------------------------------------------------------------------ */
+
+static inline void set_nz(Sim6502 *cpu, uint8_t value) {
+    cpu->p &= ~(SIM_FLAG_N | SIM_FLAG_Z);
+    cpu->p |= value & SIM_FLAG_N;
+    if (value == 0) cpu->p |= SIM_FLAG_Z;
+}
+
+static inline void set_flag(Sim6502 *cpu, uint8_t flag, int on) {
+    if (on) cpu->p |= flag;
+    else cpu->p &= ~flag;
+}
+
+static void adc(Sim6502 *cpu, uint8_t v) {
+    int c = cpu->p & SIM_FLAG_C;
+    int sum = cpu->a + v + c;
+
+    if (!(cpu->p & SIM_FLAG_D)) {
+        set_flag(cpu, SIM_FLAG_V, ~(cpu->a ^ v) & (cpu->a ^ sum) & 0x80);
+        set_flag(cpu, SIM_FLAG_C, sum > 0xff);
+        cpu->a = (uint8_t)sum;
+        set_nz(cpu, cpu->a);
+        return;
+    }
+
+    /* NMOS decimal mode: Z from the binary sum, N and V before the high
+     * nibble is adjusted */
+    int lo = (cpu->a & 0x0f) + (v & 0x0f) + c;
+    int hi = (cpu->a & 0xf0) + (v & 0xf0);
+    if (lo > 0x09) {
+        lo += 0x06;
+        hi += 0x10;
+    }
+    set_flag(cpu, SIM_FLAG_Z, (sum & 0xff) == 0);
+    set_flag(cpu, SIM_FLAG_N, hi & 0x80);
+    set_flag(cpu, SIM_FLAG_V, ~(cpu->a ^ v) & (cpu->a ^ hi) & 0x80);
+    if (hi > 0x90) hi += 0x60;
+    set_flag(cpu, SIM_FLAG_C, hi > 0xff);
+    cpu->a = (uint8_t)((hi & 0xf0) | (lo & 0x0f));
+}
+
+static void sbc(Sim6502 *cpu, uint8_t v) {
+    int borrow = !(cpu->p & SIM_FLAG_C);
+    int diff = cpu->a - v - borrow;
+
+    /* Flags are always from the binary difference */
+    set_flag(cpu, SIM_FLAG_V, (cpu->a ^ v) & (cpu->a ^ diff) & 0x80);
+    set_flag(cpu, SIM_FLAG_C, diff >= 0);
+    set_nz(cpu, (uint8_t)diff);
+
+    if (!(cpu->p & SIM_FLAG_D)) {
+        cpu->a = (uint8_t)diff;
+        return;
+    }
+    int lo = (cpu->a & 0x0f) - (v & 0x0f) - borrow;
+    int hi = (cpu->a & 0xf0) - (v & 0xf0);
+    if (lo & 0x10) {
+        lo -= 0x06;
+        hi -= 0x10;
+    }
+    if (hi & 0x100) hi -= 0x60;
+    cpu->a = (uint8_t)((hi & 0xf0) | (lo & 0x0f));
+}
+
+static inline void compare(Sim6502 *cpu, uint8_t reg, uint8_t v) {
+    set_flag(cpu, SIM_FLAG_C, reg >= v);
+    set_nz(cpu, (uint8_t)(reg - v));
+}
+
+/* Shifts and rotates on a value; the caller stores the result */
+static uint8_t shift(Sim6502 *cpu, int op, uint8_t v) {
+    int c = cpu->p & SIM_FLAG_C;
+    uint8_t r;
+
+    switch (op) {
+    case 0:  /* ASL */
+        set_flag(cpu, SIM_FLAG_C, v & 0x80);
+        r = v << 1;
+        break;
+    case 1:  /* ROL */
+        set_flag(cpu, SIM_FLAG_C, v & 0x80);
+        r = (v << 1) | c;
+        break;
+    case 2:  /* LSR */
+        set_flag(cpu, SIM_FLAG_C, v & 0x01);
+        r = v >> 1;
+        break;
+    default: /* ROR */
+        set_flag(cpu, SIM_FLAG_C, v & 0x01);
+        r = (v >> 1) | (c << 7);
+        break;
+    }
+    set_nz(cpu, r);
+    return r;
+}
+
+static int branch(Sim6502 *cpu, int taken) {
+    int8_t offset = (int8_t)fetch8(cpu);
+    if (!taken) return 0;
+    uint16_t target = cpu->pc + offset;
+    int extra = page_crossed(cpu->pc, target) ? 2 : 1;
+    cpu->pc = target;
+    return extra;
+}
+
+/* ------------------------------------------------------------------------ */
+/* Execution                                                                 */
+/* ------------------------------------------------------------------------ */
+
+int sim_step(Sim6502 *cpu) {
+    if (cpu->halted) return 0;
+
+    uint16_t at = cpu->pc;
+    uint8_t op = fetch8(cpu);
+    int mode = mode_table[op];
+    int cycles = cycle_table[op];
+    int extra = 0;
+    uint16_t addr;
+    uint16_t owner = cpu->depth > 0 ? cpu->call_target[cpu->depth - 1] : 0;
+
+    if (cycles == 0 || op == 0x00) {
+        /* BRK or an undocumented opcode: stop at the offending byte */
+        cpu->pc = at;
+        cpu->halted = 1;
+        return 0;
+    }
+
+    switch (op) {
+    /* Loads and stores */
+    case 0xa9: case 0xa5: case 0xb5: case 0xad: case 0xbd: case 0xb9: case 0xa1: case 0xb1:
+        cpu->a = operand(cpu, mode, &extra);
+        set_nz(cpu, cpu->a);
+        break;
+    case 0xa2: case 0xa6: case 0xb6: case 0xae: case 0xbe:
+        cpu->x = operand(cpu, mode, &extra);
+        set_nz(cpu, cpu->x);
+        break;
+    case 0xa0: case 0xa4: case 0xb4: case 0xac: case 0xbc:
+        cpu->y = operand(cpu, mode, &extra);
+        set_nz(cpu, cpu->y);
+        break;
+    case 0x85: case 0x95: case 0x8d: case 0x9d: case 0x99: case 0x81: case 0x91:
+        write8(cpu, address(cpu, mode, 0, &extra), cpu->a);
+        break;
+    case 0x86: case 0x96: case 0x8e:
+        write8(cpu, address(cpu, mode, 0, &extra), cpu->x);
+        break;
+    case 0x84: case 0x94: case 0x8c:
+        write8(cpu, address(cpu, mode, 0, &extra), cpu->y);
+        break;
+
+    /* Register transfers */
+    case 0xaa: cpu->x = cpu->a; set_nz(cpu, cpu->x); break;
+    case 0xa8: cpu->y = cpu->a; set_nz(cpu, cpu->y); break;
+    case 0x8a: cpu->a = cpu->x; set_nz(cpu, cpu->a); break;
+    case 0x98: cpu->a = cpu->y; set_nz(cpu, cpu->a); break;
+    case 0xba: cpu->x = cpu->s; set_nz(cpu, cpu->x); break;
+    case 0x9a: cpu->s = cpu->x; break;
+
+    /* Stack */
+    case 0x48: push8(cpu, cpu->a); break;
+    case 0x08: push8(cpu, cpu->p | SIM_FLAG_B | SIM_FLAG_U); break;
+    case 0x68: cpu->a = pull8(cpu); set_nz(cpu, cpu->a); break;
+    case 0x28: cpu->p = (pull8(cpu) & ~SIM_FLAG_B) | SIM_FLAG_U; break;
+
+    /* Logic and arithmetic */
+    case 0x29: case 0x25: case 0x35: case 0x2d: case 0x3d: case 0x39: case 0x21: case 0x31:
+        cpu->a &= operand(cpu, mode, &extra);
+        set_nz(cpu, cpu->a);
+        break;
+    case 0x09: case 0x05: case 0x15: case 0x0d: case 0x1d: case 0x19: case 0x01: case 0x11:
+        cpu->a |= operand(cpu, mode, &extra);
+        set_nz(cpu, cpu->a);
+        break;
+    case 0x49: case 0x45: case 0x55: case 0x4d: case 0x5d: case 0x59: case 0x41: case 0x51:
+        cpu->a ^= operand(cpu, mode, &extra);
+        set_nz(cpu, cpu->a);
+        break;
+    case 0x69: case 0x65: case 0x75: case 0x6d: case 0x7d: case 0x79: case 0x61: case 0x71:
+        adc(cpu, operand(cpu, mode, &extra));
+        break;
+    case 0xe9: case 0xe5: case 0xf5: case 0xed: case 0xfd: case 0xf9: case 0xe1: case 0xf1:
+        sbc(cpu, operand(cpu, mode, &extra));
+        break;
+    case 0xc9: case 0xc5: case 0xd5: case 0xcd: case 0xdd: case 0xd9: case 0xc1: case 0xd1:
+        compare(cpu, cpu->a, operand(cpu, mode, &extra));
+        break;
+    case 0xe0: case 0xe4: case 0xec:
+        compare(cpu, cpu->x, operand(cpu, mode, &extra));
+        break;
+    case 0xc0: case 0xc4: case 0xcc:
+        compare(cpu, cpu->y, operand(cpu, mode, &extra));
+        break;
+    case 0x24: case 0x2c: {
+        uint8_t v = operand(cpu, mode, &extra);
+        set_flag(cpu, SIM_FLAG_Z, (cpu->a & v) == 0);
+        set_flag(cpu, SIM_FLAG_N, v & 0x80);
+        set_flag(cpu, SIM_FLAG_V, v & 0x40);
+        break;
+    }
+
+    /* Increments and decrements */
+    case 0xe6: case 0xf6: case 0xee: case 0xfe: {
+        addr = address(cpu, mode, 0, &extra);
+        uint8_t v = read8(cpu, addr) + 1;
+        write8(cpu, addr, v);
+        set_nz(cpu, v);
+        break;
+    }
+    case 0xc6: case 0xd6: case 0xce: case 0xde: {
+        addr = address(cpu, mode, 0, &extra);
+        uint8_t v = read8(cpu, addr) - 1;
+        write8(cpu, addr, v);
+        set_nz(cpu, v);
+        break;
+    }
+    case 0xe8: cpu->x++; set_nz(cpu, cpu->x); break;
+    case 0xca: cpu->x--; set_nz(cpu, cpu->x); break;
+    case 0xc8: cpu->y++; set_nz(cpu, cpu->y); break;
+    case 0x88: cpu->y--; set_nz(cpu, cpu->y); break;
+
+    /* Shifts: accumulator and memory forms; op >> 5 selects ASL/ROL/LSR/ROR */
+    case 0x0a: case 0x2a: case 0x4a: case 0x6a:
+        cpu->a = shift(cpu, op >> 5, cpu->a);
+        break;
+    case 0x06: case 0x16: case 0x0e: case 0x1e:
+    case 0x26: case 0x36: case 0x2e: case 0x3e:
+    case 0x46: case 0x56: case 0x4e: case 0x5e:
+    case 0x66: case 0x76: case 0x6e: case 0x7e:
+        addr = address(cpu, mode, 0, &extra);
+        write8(cpu, addr, shift(cpu, op >> 5, read8(cpu, addr)));
+        break;
+
+    /* Jumps and subroutines */
+    case 0x4c:
+        cpu->pc = fetch16(cpu);
+        break;
+    case 0x6c: {
+        /* JMP ($xxFF) reads the high byte from $xx00 */
+        uint16_t ptr = fetch16(cpu);
+        uint16_t hi_addr = (ptr & 0xff00) | (uint8_t)(ptr + 1);
+        cpu->pc = read8(cpu, ptr) | (read8(cpu, hi_addr) << 8);
+        break;
+    }
+    case 0x20: {
+        uint16_t target = fetch16(cpu);
+        uint16_t ret = cpu->pc - 1;
+        enter_call(cpu, target, cpu->cycles);
+        push8(cpu, ret >> 8);
+        push8(cpu, ret & 0xff);
+        cpu->pc = target;
+        break;
+    }
+    case 0x60: {
+        uint16_t lo = pull8(cpu);
+        cpu->pc = (lo | (pull8(cpu) << 8)) + 1;
+        break;
+    }
+    case 0x40: {
+        cpu->p = (pull8(cpu) & ~SIM_FLAG_B) | SIM_FLAG_U;
+        uint16_t lo = pull8(cpu);
+        cpu->pc = lo | (pull8(cpu) << 8);
+        break;
+    }
+
+    /* Branches */
+    case 0x10: extra = branch(cpu, !(cpu->p & SIM_FLAG_N)); break;
+    case 0x30: extra = branch(cpu, cpu->p & SIM_FLAG_N); break;
+    case 0x50: extra = branch(cpu, !(cpu->p & SIM_FLAG_V)); break;
+    case 0x70: extra = branch(cpu, cpu->p & SIM_FLAG_V); break;
+    case 0x90: extra = branch(cpu, !(cpu->p & SIM_FLAG_C)); break;
+    case 0xb0: extra = branch(cpu, cpu->p & SIM_FLAG_C); break;
+    case 0xd0: extra = branch(cpu, !(cpu->p & SIM_FLAG_Z)); break;
+    case 0xf0: extra = branch(cpu, cpu->p & SIM_FLAG_Z); break;
+
+    /* Flags */
+    case 0x18: cpu->p &= ~SIM_FLAG_C; break;
+    case 0x38: cpu->p |= SIM_FLAG_C; break;
+    case 0x58: cpu->p &= ~SIM_FLAG_I; break;
+    case 0x78: cpu->p |= SIM_FLAG_I; break;
+    case 0xb8: cpu->p &= ~SIM_FLAG_V; break;
+    case 0xd8: cpu->p &= ~SIM_FLAG_D; break;
+    case 0xf8: cpu->p |= SIM_FLAG_D; break;
+
+    case 0xea:
+        break;
+    }
+
+    cycles += extra;
+    cpu->cycles += cycles;
+    if (cpu->profile) cpu->profile->self[owner] += cycles;
+    if (op == 0x60) {
+        leave_calls(cpu, cpu->cycles);
+    } else if (op == 0x4c && cpu->profile && cpu->tail_calls && cpu->tail_calls[cpu->pc]) {
+        tail_call(cpu, cpu->pc, cpu->cycles);
+    }
+    return cycles;
+}
+
+int64_t sim_call(Sim6502 *cpu, uint16_t addr, uint64_t max_cycles) {
+    /* Act as a JSR from $FFFD: RTS lands on $FFFF with S restored */
+    const uint16_t ret = 0xffff;
+    uint16_t pc = cpu->pc;
+    uint8_t s = cpu->s;
+    uint64_t start = cpu->cycles;
+
+    enter_call(cpu, addr, start);
+    push8(cpu, (ret - 1) >> 8);
+    push8(cpu, (ret - 1) & 0xff);
+    cpu->pc = addr;
+    cpu->cycles += 6;
+
+    while (!(cpu->pc == ret && cpu->s == s)) {
+        if (!sim_step(cpu) || cpu->cycles - start > max_cycles) return -1;
+    }
+    cpu->pc = pc;
+    return (int64_t)(cpu->cycles - start);
+}
+
+/* ------------------------------------------------------------------------ */
+/* Label files                                                               */
+/* ------------------------------------------------------------------------ */
+
+int sim_load_labels(SimLabels *labels, const char *path) {
+    FILE *f = fopen(path, "r");
+    char line[256];
+    int capacity = 256;
+
+    labels->count = 0;
+    labels->labels = malloc(capacity * sizeof(SimLabel));
+    if (!f || !labels->labels) {
+        if (f) fclose(f);
+        free(labels->labels);
+        labels->labels = NULL;
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), f)) {
+        char name[sizeof(labels->labels[0].name)];
+        char value[32];
+        unsigned long v;
+        char *end;
+
+        /* "name = $hex" or "name = decimal"; 64tass pads with tabs and may
+         * omit the space before '=' for long names */
+        char *eq = strchr(line, '=');
+        if (!eq) continue;
+        *eq = '\0';
+        if (sscanf(line, "%47s", name) != 1 || sscanf(eq + 1, "%31s", value) != 1) continue;
+        if (value[0] == '$') v = strtoul(value + 1, &end, 16);
+        else v = strtoul(value, &end, 10);
+        if (*end != '\0' || end == value || v > 0xffff) continue;
+
+        if (labels->count == capacity) {
+            SimLabel *grown = realloc(labels->labels, 2 * capacity * sizeof(SimLabel));
+            if (!grown) break;
+            labels->labels = grown;
+            capacity *= 2;
+        }
+        strcpy(labels->labels[labels->count].name, name);
+        labels->labels[labels->count].value = (uint16_t)v;
+        labels->count++;
+    }
+
+    fclose(f);
+    return 0;
+}
+
+void sim_free_labels(SimLabels *labels) {
+    free(labels->labels);
+    labels->labels = NULL;
+    labels->count = 0;
+}
+
+int sim_label_value(const SimLabels *labels, const char *name) {
+    for (int n = 0; n < labels->count; n++) {
+        if (strcmp(labels->labels[n].name, name) == 0) return labels->labels[n].value;
+    }
+    return -1;
+}
+
+const char *sim_label_name(const SimLabels *labels, uint16_t addr) {
+    const char *fallback = NULL;
+    for (int n = 0; n < labels->count; n++) {
+        if (labels->labels[n].value != addr) continue;
+        if (strncmp(labels->labels[n].name, "smc_", 4) != 0) return labels->labels[n].name;
+        if (!fallback) fallback = labels->labels[n].name;
+    }
+    return fallback;
+}
@@ -0,0 +1,99 @@
+#ifndef SIM6502_H
+#define SIM6502_H
+
+#include <stdint.h>
+
+/* Status register flags */
+#define SIM_FLAG_C 0x01
+#define SIM_FLAG_Z 0x02
+#define SIM_FLAG_I 0x04
+#define SIM_FLAG_D 0x08
+#define SIM_FLAG_B 0x10
+#define SIM_FLAG_U 0x20
+#define SIM_FLAG_V 0x40
+#define SIM_FLAG_N 0x80
+
+/* Routines tracked on the shadow call stack (JSR nesting depth) */
+#define SIM_MAX_CALL_DEPTH 64
+
+typedef struct Sim6502 Sim6502;
+
+/* Called after every memory write (stores and read-modify-write results) */
+typedef void (*sim_write_fn)(Sim6502 *cpu, uint16_t addr, uint8_t value);
+
+/* Per-routine cycle counters, indexed by JSR target address.
+ * Self cycles are spent while the routine is the innermost active JSR;
+ * inclusive cycles also count its callees and are added on return. */
+typedef struct {
+    uint64_t self[65536];
+    uint64_t inclusive[65536];
+    uint32_t calls[65536];
+} SimProfile;
+
+/* NMOS 6502 with a flat 64KB RAM and no I/O. Cycle counts are exact for
+ * the documented opcodes, including page-crossing and branch penalties.
+ * Undocumented opcodes and BRK halt the CPU. Decimal mode is supported. */
+struct Sim6502 {
+    uint8_t a, x, y, s, p;
+    uint16_t pc;
+    uint64_t cycles;
+    int halted;                 /* Set on BRK or an undocumented opcode */
+
+    sim_write_fn on_write;      /* NULL = no hook */
+    void *user;
+
+    SimProfile *profile;        /* NULL = no per-routine accounting */
+    const uint8_t *tail_calls;  /* Optional 64K map: a JMP to a non-zero entry
+                                 * ends the current routine and enters that one */
+    int depth;                  /* Active JSRs on the shadow stack (0 = top level) */
+    uint16_t call_target[SIM_MAX_CALL_DEPTH];
+    uint8_t call_sp[SIM_MAX_CALL_DEPTH];     /* S before the JSR pushed */
+    uint64_t call_start[SIM_MAX_CALL_DEPTH];
+
+    uint8_t mem[65536];
+};
+
+/* Clear memory and registers (S = $FF, I set) */
+void sim_init(Sim6502 *cpu);
+
+/* Load a .prg file (2-byte little-endian load address, then data).
+ * Returns the load address, or -1 on error. */
+int sim_load_prg(Sim6502 *cpu, const char *path);
+
+/* Address from the "SYS nnnn" line of a BASIC stub at $0801, or -1 */
+int sim_basic_sys(const Sim6502 *cpu);
+
+/* Execute one instruction. Returns its cycle count, 0 if halted. */
+int sim_step(Sim6502 *cpu);
+
+/* Call the subroutine at addr and run until it returns (its RTS pops the
+ * return address pushed here), or until max_cycles elapse. PC is then
+ * restored, so a running program can be resumed.
+ * Returns the cycles taken including the JSR and RTS, or -1 if the CPU
+ * halted or ran out of cycles. */
+int64_t sim_call(Sim6502 *cpu, uint16_t addr, uint64_t max_cycles);
+
+/* Symbol table from a 64tass label file (-l), lines "name = $hex" */
+typedef struct {
+    char name[48];
+    uint16_t value;
+} SimLabel;
+
+typedef struct {
+    SimLabel *labels;
+    int count;
+} SimLabels;
+
+/* Read a label file. Returns 0 on success, -1 on error. */
+int sim_load_labels(SimLabels *labels, const char *path);
+
+void sim_free_labels(SimLabels *labels);
+
+/* Value of a label, or -1 if undefined */
+int sim_label_value(const SimLabels *labels, const char *name);
+
+/* Name of a label at exactly addr (NULL if none). When several labels share
+ * the address, the first in the file that is not a "smc_" patch point wins. */
+const char *sim_label_name(const SimLabels *labels, uint16_t addr);
+
+#endif /* SIM6502_H */
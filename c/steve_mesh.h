@@ -0,0 +1,102 @@
+// Generated by gen_steve.py --c-header: 48 vertices, 72 faces, 24 animation frames
+
+#define STEVE_NUM_VERTICES 48
+#define STEVE_NUM_FACES 72
+#define STEVE_NUM_FRAMES 24
+
+static int8_t steve_vertices_x[STEVE_NUM_FRAMES][STEVE_NUM_VERTICES] = {
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+    { -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, -30, 30, 30, -30, 30, 60, 60, 30, 30, 60, 60, 30, -60, -30, -30, -60, -60, -30, -30, -60, 0, 30, 30, 0, 0, 30, 30, 0, -30, 0, 0, -30, -30, 0, 0, -30 },
+};
+
+static int8_t steve_vertices_y[STEVE_NUM_FRAMES][STEVE_NUM_VERTICES] = {
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 60, 60, 60, 60, -30, -30, -30, -30, 60, 60, 60, 60, -30, -30, -30, -30, -30, -30, -30, -30, -120, -120, -120, -120, -30, -30, -30, -30, -120, -120, -120, -120 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 57, 57, 63, 63, -31, -31, -25, -25, 63, 63, 57, 57, -25, -25, -31, -31, -27, -27, -33, -33, -115, -115, -121, -121, -33, -33, -27, -27, -121, -121, -115, -115 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 54, 54, 66, 66, -29, -29, -17, -17, 66, 66, 54, 54, -17, -17, -29, -29, -24, -24, -36, -36, -107, -107, -119, -119, -36, -36, -24, -24, -119, -119, -107, -107 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 52, 52, 68, 68, -24, -24, -9, -9, 68, 68, 52, 52, -9, -9, -24, -24, -22, -22, -38, -38, -99, -99, -114, -114, -38, -38, -22, -22, -114, -114, -99, -99 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 51, 51, 69, 69, -19, -19, -1, -1, 69, 69, 51, 51, -1, -1, -19, -19, -21, -21, -39, -39, -91, -91, -109, -109, -39, -39, -21, -21, -109, -109, -91, -91 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 50, 50, 70, 70, -16, -16, 5, 5, 70, 70, 50, 50, 5, 5, -16, -16, -20, -20, -40, -40, -85, -85, -106, -106, -40, -40, -20, -20, -106, -106, -85, -85 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 49, 49, 71, 71, -14, -14, 7, 7, 71, 71, 49, 49, 7, 7, -14, -14, -19, -19, -41, -41, -83, -83, -104, -104, -41, -41, -19, -19, -104, -104, -83, -83 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 50, 50, 70, 70, -16, -16, 5, 5, 70, 70, 50, 50, 5, 5, -16, -16, -20, -20, -40, -40, -85, -85, -106, -106, -40, -40, -20, -20, -106, -106, -85, -85 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 51, 51, 69, 69, -19, -19, -1, -1, 69, 69, 51, 51, -1, -1, -19, -19, -21, -21, -39, -39, -91, -91, -109, -109, -39, -39, -21, -21, -109, -109, -91, -91 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 52, 52, 68, 68, -24, -24, -9, -9, 68, 68, 52, 52, -9, -9, -24, -24, -22, -22, -38, -38, -99, -99, -114, -114, -38, -38, -22, -22, -114, -114, -99, -99 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 54, 54, 66, 66, -29, -29, -17, -17, 66, 66, 54, 54, -17, -17, -29, -29, -24, -24, -36, -36, -107, -107, -119, -119, -36, -36, -24, -24, -119, -119, -107, -107 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 57, 57, 63, 63, -31, -31, -25, -25, 63, 63, 57, 57, -25, -25, -31, -31, -27, -27, -33, -33, -115, -115, -121, -121, -33, -33, -27, -27, -121, -121, -115, -115 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 60, 60, 60, 60, -30, -30, -30, -30, 60, 60, 60, 60, -30, -30, -30, -30, -30, -30, -30, -30, -120, -120, -120, -120, -30, -30, -30, -30, -120, -120, -120, -120 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 63, 63, 57, 57, -25, -25, -31, -31, 57, 57, 63, 63, -31, -31, -25, -25, -33, -33, -27, -27, -121, -121, -115, -115, -27, -27, -33, -33, -115, -115, -121, -121 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 66, 66, 54, 54, -17, -17, -29, -29, 54, 54, 66, 66, -29, -29, -17, -17, -36, -36, -24, -24, -119, -119, -107, -107, -24, -24, -36, -36, -107, -107, -119, -119 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 68, 68, 52, 52, -9, -9, -24, -24, 52, 52, 68, 68, -24, -24, -9, -9, -38, -38, -22, -22, -114, -114, -99, -99, -22, -22, -38, -38, -99, -99, -114, -114 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 69, 69, 51, 51, -1, -1, -19, -19, 51, 51, 69, 69, -19, -19, -1, -1, -39, -39, -21, -21, -109, -109, -91, -91, -21, -21, -39, -39, -91, -91, -109, -109 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 70, 70, 50, 50, 5, 5, -16, -16, 50, 50, 70, 70, -16, -16, 5, 5, -40, -40, -20, -20, -106, -106, -85, -85, -20, -20, -40, -40, -85, -85, -106, -106 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 71, 71, 49, 49, 7, 7, -14, -14, 49, 49, 71, 71, -14, -14, 7, 7, -41, -41, -19, -19, -104, -104, -83, -83, -19, -19, -41, -41, -83, -83, -104, -104 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 70, 70, 50, 50, 5, 5, -16, -16, 50, 50, 70, 70, -16, -16, 5, 5, -40, -40, -20, -20, -106, -106, -85, -85, -20, -20, -40, -40, -85, -85, -106, -106 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 69, 69, 51, 51, -1, -1, -19, -19, 51, 51, 69, 69, -19, -19, -1, -1, -39, -39, -21, -21, -109, -109, -91, -91, -21, -21, -39, -39, -91, -91, -109, -109 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 68, 68, 52, 52, -9, -9, -24, -24, 52, 52, 68, 68, -24, -24, -9, -9, -38, -38, -22, -22, -114, -114, -99, -99, -22, -22, -38, -38, -99, -99, -114, -114 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 66, 66, 54, 54, -17, -17, -29, -29, 54, 54, 66, 66, -29, -29, -17, -17, -36, -36, -24, -24, -119, -119, -107, -107, -24, -24, -36, -36, -107, -107, -119, -119 },
+    { 120, 120, 120, 120, 60, 60, 60, 60, 60, 60, 60, 60, -30, -30, -30, -30, 63, 63, 57, 57, -25, -25, -31, -31, 57, 57, 63, 63, -31, -31, -25, -25, -33, -33, -27, -27, -121, -121, -115, -115, -27, -27, -33, -33, -115, -115, -121, -121 },
+};
+
+static int8_t steve_vertices_z[STEVE_NUM_FRAMES][STEVE_NUM_VERTICES] = {
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, 3, 3, 33, 33, -15, -15, 15, 15, -33, -33, -3, -3, -15, -15, 15, 15, -33, -33, -3, -3, -15, -15, 15, 15, 3, 3, 33, 33 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -14, -14, 14, 14, 21, 21, 48, 48, -14, -14, 14, 14, -48, -48, -21, -21, -14, -14, 14, 14, -48, -48, -21, -21, -14, -14, 14, 14, 21, 21, 48, 48 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -13, -13, 13, 13, 35, 35, 60, 60, -13, -13, 13, 13, -60, -60, -35, -35, -13, -13, 13, 13, -60, -60, -35, -35, -13, -13, 13, 13, 35, 35, 60, 60 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -12, -12, 12, 12, 45, 45, 68, 68, -12, -12, 12, 12, -68, -68, -45, -45, -12, -12, 12, 12, -68, -68, -45, -45, -12, -12, 12, 12, 45, 45, 68, 68 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -11, -11, 11, 11, 51, 51, 73, 73, -11, -11, 11, 11, -73, -73, -51, -51, -11, -11, 11, 11, -73, -73, -51, -51, -11, -11, 11, 11, 51, 51, 73, 73 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -11, -11, 11, 11, 53, 53, 74, 74, -11, -11, 11, 11, -74, -74, -53, -53, -11, -11, 11, 11, -74, -74, -53, -53, -11, -11, 11, 11, 53, 53, 74, 74 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -11, -11, 11, 11, 51, 51, 73, 73, -11, -11, 11, 11, -73, -73, -51, -51, -11, -11, 11, 11, -73, -73, -51, -51, -11, -11, 11, 11, 51, 51, 73, 73 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -12, -12, 12, 12, 45, 45, 68, 68, -12, -12, 12, 12, -68, -68, -45, -45, -12, -12, 12, 12, -68, -68, -45, -45, -12, -12, 12, 12, 45, 45, 68, 68 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -13, -13, 13, 13, 35, 35, 60, 60, -13, -13, 13, 13, -60, -60, -35, -35, -13, -13, 13, 13, -60, -60, -35, -35, -13, -13, 13, 13, 35, 35, 60, 60 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -14, -14, 14, 14, 21, 21, 48, 48, -14, -14, 14, 14, -48, -48, -21, -21, -14, -14, 14, 14, -48, -48, -21, -21, -14, -14, 14, 14, 21, 21, 48, 48 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, 3, 3, 33, 33, -15, -15, 15, 15, -33, -33, -3, -3, -15, -15, 15, 15, -33, -33, -3, -3, -15, -15, 15, 15, 3, 3, 33, 33 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -33, -33, -3, -3, -15, -15, 15, 15, 3, 3, 33, 33, -15, -15, 15, 15, 3, 3, 33, 33, -15, -15, 15, 15, -33, -33, -3, -3 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -14, -14, 14, 14, -48, -48, -21, -21, -14, -14, 14, 14, 21, 21, 48, 48, -14, -14, 14, 14, 21, 21, 48, 48, -14, -14, 14, 14, -48, -48, -21, -21 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -13, -13, 13, 13, -60, -60, -35, -35, -13, -13, 13, 13, 35, 35, 60, 60, -13, -13, 13, 13, 35, 35, 60, 60, -13, -13, 13, 13, -60, -60, -35, -35 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -12, -12, 12, 12, -68, -68, -45, -45, -12, -12, 12, 12, 45, 45, 68, 68, -12, -12, 12, 12, 45, 45, 68, 68, -12, -12, 12, 12, -68, -68, -45, -45 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -11, -11, 11, 11, -73, -73, -51, -51, -11, -11, 11, 11, 51, 51, 73, 73, -11, -11, 11, 11, 51, 51, 73, 73, -11, -11, 11, 11, -73, -73, -51, -51 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -11, -11, 11, 11, -74, -74, -53, -53, -11, -11, 11, 11, 53, 53, 74, 74, -11, -11, 11, 11, 53, 53, 74, 74, -11, -11, 11, 11, -74, -74, -53, -53 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -11, -11, 11, 11, -73, -73, -51, -51, -11, -11, 11, 11, 51, 51, 73, 73, -11, -11, 11, 11, 51, 51, 73, 73, -11, -11, 11, 11, -73, -73, -51, -51 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -12, -12, 12, 12, -68, -68, -45, -45, -12, -12, 12, 12, 45, 45, 68, 68, -12, -12, 12, 12, 45, 45, 68, 68, -12, -12, 12, 12, -68, -68, -45, -45 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -13, -13, 13, 13, -60, -60, -35, -35, -13, -13, 13, 13, 35, 35, 60, 60, -13, -13, 13, 13, 35, 35, 60, 60, -13, -13, 13, 13, -60, -60, -35, -35 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -14, -14, 14, 14, -48, -48, -21, -21, -14, -14, 14, 14, 21, 21, 48, 48, -14, -14, 14, 14, 21, 21, 48, 48, -14, -14, 14, 14, -48, -48, -21, -21 },
+    { -30, -30, 30, 30, -30, -30, 30, 30, -15, -15, 15, 15, -15, -15, 15, 15, -15, -15, 15, 15, -33, -33, -3, -3, -15, -15, 15, 15, 3, 3, 33, 33, -15, -15, 15, 15, 3, 3, 33, 33, -15, -15, 15, 15, -33, -33, -3, -3 },
+};
+
+static uint8_t steve_faces_i[] = {
+    0, 0, 2, 2, 0, 0, 4, 4, 1, 1, 0, 0, 8, 8, 10, 10, 8, 8, 12, 12, 9, 9, 8, 8, 16, 16, 18, 18, 16, 16, 20, 20, 17, 17, 16, 16, 24, 24, 26, 26, 24, 24, 28, 28, 25, 25, 24, 24, 32, 32, 34, 34, 32, 32, 36, 36, 33, 33, 32, 32, 40, 40, 42, 42, 40, 40, 44, 44, 41, 41, 40, 40
+};
+
+static uint8_t steve_faces_j[] = {
+    1, 5, 3, 7, 3, 2, 5, 6, 2, 6, 4, 7, 9, 13, 11, 15, 11, 10, 13, 14, 10, 14, 12, 15, 17, 21, 19, 23, 19, 18, 21, 22, 18, 22, 20, 23, 25, 29, 27, 31, 27, 26, 29, 30, 26, 30, 28, 31, 33, 37, 35, 39, 35, 34, 37, 38, 34, 38, 36, 39, 41, 45, 43, 47, 43, 42, 45, 46, 42, 46, 44, 47
+};
+
+static uint8_t steve_faces_k[] = {
+    5, 4, 7, 6, 2, 1, 6, 7, 6, 5, 7, 3, 13, 12, 15, 14, 10, 9, 14, 15, 14, 13, 15, 11, 21, 20, 23, 22, 18, 17, 22, 23, 22, 21, 23, 19, 29, 28, 31, 30, 26, 25, 30, 31, 30, 29, 31, 27, 37, 36, 39, 38, 34, 33, 38, 39, 38, 37, 39, 35, 45, 44, 47, 46, 42, 41, 46, 47, 46, 45, 47, 43
+};
+
+static uint8_t steve_faces_col[] = {
+    1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2
+};
@@ -2,15 +2,41 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <math.h>
 #include "rasterize.h"
 #include "mesh.h"
+#include "parallel.h"
 #include "grunt_mesh.h"
+#include "steve_mesh.h"
+#include "grunt_pvs.h"
+#include "sim6502.h"
+#include "asm_harness.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846  /* Not provided by strict C99 <math.h> */
+#endif
+
+/* Edge slope 256 * dx / dy in 8.8 fixed point (dy > 0) */
+typedef int (*slope_fn)(int dx, int dy);
+
+static int exact_slope(int dx, int dy) {
+    return (dx << 8) / dy;
+}
+
+/* div8s_8u_m in macros.asm: |dx| * floor(65536 / dy) / 256, truncated, with
+ * the sign restored. Up to one 8.8 step smaller in magnitude than the exact
+ * quotient. */
+static int recip_slope(int dx, int dy) {
+    if (dy == 1) return dx << 8;
+    int q = (abs(dx) * (65536 / dy)) >> 8;
+    return dx < 0 ? -q : q;
+}
 
 /* Reference rasterizer using simple scanline algorithm with half-pixel sampling.
  * At scanline y, we sample at y + 0.5 to avoid vertex degeneracy.
  * Uses fixed-point 8.8 arithmetic and shifts (not division) to match crasterizer. */
-static void reference_triangle(unsigned char *buf, int ax, int ay, int bx, int by,
-                               int cx, int cy, unsigned char color) {
+static void reference_triangle_slope(unsigned char *buf, int ax, int ay, int bx, int by,
+                                     int cx, int cy, unsigned char color, slope_fn slope) {
     /* Backface culling: check winding order BEFORE sorting */
     int det = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax);
     if (det < 0) {
@@ -28,7 +54,7 @@ static void reference_triangle(unsigned char *buf, int ax, int ay, int bx, int b
     }
 
     /* Compute slope for A-C edge in 8.8 fixed point: 256 * dx / dy */
-    int dx_ac = ((cx - ax) << 8) / (cy - ay);
+    int dx_ac = slope(cx - ax, cy - ay);
 
     /* For each scanline from ay to cy-1 */
     for (int y = ay; y < cy; y++) {
@@ -44,7 +70,7 @@ static void reference_triangle(unsigned char *buf, int ax, int ay, int bx, int b
         if (y < by) {
             /* Top part: use A-B edge */
             if (by != ay) {
-                int dx_ab = ((bx - ax) << 8) / (by - ay);
+                int dx_ab = slope(bx - ax, by - ay);
                 x_other_fp = (ax << 8) + dx_ab * (y - ay) + (dx_ab >> 1);
             } else {
                 x_other_fp = ax << 8;
@@ -52,7 +78,7 @@ static void reference_triangle(unsigned char *buf, int ax, int ay, int bx, int b
         } else {
             /* Bottom part: use B-C edge */
             if (cy != by) {
-                int dx_bc = ((cx - bx) << 8) / (cy - by);
+                int dx_bc = slope(cx - bx, cy - by);
                 x_other_fp = (bx << 8) + dx_bc * (y - by) + (dx_bc >> 1);
             } else {
                 x_other_fp = bx << 8;
@@ -69,6 +95,19 @@ static void reference_triangle(unsigned char *buf, int ax, int ay, int bx, int b
     }
 }
 
+static void reference_triangle(unsigned char *buf, int ax, int ay, int bx, int by,
+                               int cx, int cy, unsigned char color) {
+    reference_triangle_slope(buf, ax, ay, bx, by, cx, cy, color, exact_slope);
+}
+
+/* What rasterizer.asm should draw: reciprocal slopes, and degenerate
+ * (det == 0) triangles are culled along with back faces */
+static void asm_reference_triangle(unsigned char *buf, int ax, int ay, int bx, int by,
+                                   int cx, int cy, unsigned char color) {
+    if ((bx - ax) * (cy - ay) - (by - ay) * (cx - ax) == 0) return;
+    reference_triangle_slope(buf, ax, ay, bx, by, cx, cy, color, recip_slope);
+}
+
 /* Compare two screen buffers, return number of differing bytes */
 int compare_screens(const unsigned char *a, const unsigned char *b) {
     int diff = 0;
@@ -207,37 +246,1998 @@ int run_random_tests(int count) {
     return failures;
 }
 
-/* Exhaustive small region tests */
+/* Guard band tests: vertices off-screen (within GUARD_BAND) must give the
+ * reference result clipped to the screen, with no writes outside the buffer */
+int run_guard_band_tests(int count) {
+    enum { CANARY = 64 };
+    static unsigned char guarded[CANARY + SCREEN_SIZE + CANARY];
+    unsigned char *actual = guarded + CANARY;
+    unsigned char expected[SCREEN_SIZE];
+    int failures = 0;
+
+    printf("\n=== Guard Band Tests (%d cases) ===\n", count);
+
+    for (int i = 0; i < count; i++) {
+        /* Half near the screen, half anywhere in the guard band */
+        int span = (i & 1) ? GUARD_BAND : 40;
+        int v[6];
+        for (int c = 0; c < 6; c++) {
+            int size = (c & 1) ? SCREEN_HEIGHT : SCREEN_WIDTH;
+            v[c] = rand() % (size + 2 * span + 1) - span;
+        }
+        unsigned char color = (rand() % 3) + 1;
+
+        memset(guarded, 0xa5, sizeof(guarded));
+        clear_screen(actual, 0);
+        clear_screen(expected, 0);
+        reference_triangle(expected, v[0], v[1], v[2], v[3], v[4], v[5], color);
+        draw_triangle(actual, v[0], v[1], v[2], v[3], v[4], v[5], color);
+
+        int canary_ok = 1;
+        for (int b = 0; b < CANARY; b++) {
+            if (guarded[b] != 0xa5 || actual[SCREEN_SIZE + b] != 0xa5) canary_ok = 0;
+        }
+        if (!canary_ok || compare_screens(expected, actual) != 0) {
+            failures++;
+            if (failures <= 3) {
+                printf("  Failure: (%d,%d)-(%d,%d)-(%d,%d)%s\n", v[0], v[1],
+                       v[2], v[3], v[4], v[5], canary_ok ? "" : " wrote out of bounds");
+            }
+        }
+    }
+
+    printf("Guard band tests: %d/%d passed\n", count - failures, count);
+    return failures;
+}
+
+/* Exhaustive small region tests: every triangle with vertices in an n x n
+ * pixel region, at the screen center with each x/y alignment and at the four
+ * corners. One task per (region, vertex A) runs on the worker pool. */
+typedef struct {
+    int region_size;
+    int origins[8][2];
+    int *failures;          /* Per task */
+    int (*first)[6];        /* First failing triangle of each task */
+} ExhaustiveRun;
+
+static void exhaustive_task(void *ctx, int task, int worker) {
+    ExhaustiveRun *run = ctx;
+    int n = run->region_size;
+    int ox = run->origins[task / (n * n)][0], oy = run->origins[task / (n * n)][1];
+    int ax = ox + task % n, ay = oy + task / n % n;
+    unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+    (void)worker;
+
+    /* Only the bytes under the region (plus a column either side) are
+     * cleared and compared per triangle; whole screens once per task */
+    int row0 = oy / 2, row1 = (oy + n - 1) / 2;
+    int col0 = ox / 2 > 0 ? ox / 2 - 1 : 0;
+    int col1 = (ox + n - 1) / 2 < CHAR_WIDTH - 1 ? (ox + n - 1) / 2 + 1 : CHAR_WIDTH - 1;
+    int width = col1 - col0 + 1;
+
+    clear_screen(expected, 0);
+    clear_screen(actual, 0);
+    run->failures[task] = 0;
+    for (int t = 0; t < n * n * n * n; t++) {
+        int bx = ox + t % n, by = oy + t / n % n;
+        int cx = ox + t / (n * n) % n, cy = oy + t / (n * n * n);
+
+        for (int row = row0; row <= row1; row++) {
+            memset(expected + row * CHAR_WIDTH + col0, 0, width);
+            memset(actual + row * CHAR_WIDTH + col0, 0, width);
+        }
+        reference_triangle(expected, ax, ay, bx, by, cx, cy, 1);
+        draw_triangle(actual, ax, ay, bx, by, cx, cy, 1);
+
+        int fail = 0;
+        for (int row = row0; row <= row1 && !fail; row++) {
+            fail = memcmp(expected + row * CHAR_WIDTH + col0,
+                          actual + row * CHAR_WIDTH + col0, width) != 0;
+        }
+        if (fail && run->failures[task]++ == 0) {
+            int v[6] = { ax, ay, bx, by, cx, cy };
+            memcpy(run->first[task], v, sizeof(v));
+        }
+    }
+    if (memcmp(expected, actual, SCREEN_SIZE) != 0 && run->failures[task]++ == 0) {
+        int v[6] = { -1, -1, ax, ay, ox, oy };      /* No single triangle known */
+        memcpy(run->first[task], v, sizeof(v));
+    }
+}
+
 int run_exhaustive_tests(int region_size) {
+    int n = region_size;
+    ExhaustiveRun run = {
+        .region_size = n,
+        .origins = {
+            { 34, 20 }, { 35, 20 }, { 34, 21 }, { 35, 21 },
+            { 0, 0 }, { SCREEN_WIDTH - n, 0 }, { 0, SCREEN_HEIGHT - n },
+            { SCREEN_WIDTH - n, SCREEN_HEIGHT - n }
+        }
+    };
+    int num_origins = sizeof(run.origins) / sizeof(run.origins[0]);
+    int num_tasks = num_origins * n * n;
+    int failures = 0, reported = 0;
+
+    run.failures = malloc(num_tasks * sizeof(run.failures[0]));
+    run.first = malloc(num_tasks * sizeof(run.first[0]));
+    if (!run.failures || !run.first) {
+        printf("  Out of memory\n");
+        free(run.failures);
+        free(run.first);
+        return 1;
+    }
+
+    WorkerPool *pool = pool_create(0);
+    printf("\n=== Exhaustive Tests (region %dx%d, %d origins, %d threads) ===\n",
+           n, n, num_origins, pool_size(pool));
+    pool_run(pool, exhaustive_task, &run, num_tasks);
+    pool_destroy(pool);
+
+    for (int task = 0; task < num_tasks; task++) {
+        const int *v = run.first[task];
+        failures += run.failures[task];
+        if (!run.failures[task] || reported++ >= 3) continue;
+        if (v[0] < 0) {
+            printf("  Write outside region (%d,%d) with A=(%d,%d)\n", v[4], v[5], v[2], v[3]);
+        } else {
+            printf("  Failure: (%d,%d)-(%d,%d)-(%d,%d)\n", v[0], v[1], v[2], v[3], v[4], v[5]);
+        }
+    }
+
+    long long tests = (long long)num_tasks * n * n * n * n;
+    printf("Exhaustive tests: %lld/%lld passed\n", tests - failures, tests);
+    free(run.failures);
+    free(run.first);
+    return failures;
+}
+
+/* Background tests: draw over random screen contents and compare whole bytes,
+ * so the spans must preserve the other half-row bit-exactly */
+int run_background_tests(int count) {
+    int failures = 0;
+
+    printf("\n=== Background Tests (%d cases) ===\n", count);
+
+    for (int i = 0; i < count; i++) {
+        unsigned char expected[SCREEN_SIZE];
+        unsigned char actual[SCREEN_SIZE];
+
+        for (int b = 0; b < SCREEN_SIZE; b++) {
+            expected[b] = actual[b] = rand() & 0xff;
+        }
+
+        int ax = rand() % SCREEN_WIDTH, ay = rand() % SCREEN_HEIGHT;
+        int bx = rand() % SCREEN_WIDTH, by = rand() % SCREEN_HEIGHT;
+        int cx = rand() % SCREEN_WIDTH, cy = rand() % SCREEN_HEIGHT;
+        unsigned char color = rand() % 4;
+
+        reference_triangle(expected, ax, ay, bx, by, cx, cy, color);
+        draw_triangle(actual, ax, ay, bx, by, cx, cy, color);
+
+        if (compare_screens(expected, actual) != 0) {
+            failures++;
+            if (failures <= 3) {
+                printf("  Failure: (%d,%d)-(%d,%d)-(%d,%d) color=%d\n",
+                       ax, ay, bx, by, cx, cy, color);
+            }
+        }
+    }
+
+    printf("Background tests: %d/%d passed\n", count - failures, count);
+    return failures;
+}
+
+/* Batch submission tests: draw_triangles() must match per-face draw_triangle() */
+int run_batch_tests(int count) {
+    int failures = 0;
+
+    printf("\n=== Batch Tests (%d batches) ===\n", count);
+
+    for (int n = 0; n < count; n++) {
+        int16_t sx[32], sy[32];
+        uint8_t fi[100], fj[100], fk[100], col[100];
+        unsigned char expected[SCREEN_SIZE];
+        unsigned char actual[SCREEN_SIZE];
+
+        for (int v = 0; v < 32; v++) {
+            sx[v] = rand() % SCREEN_WIDTH;
+            sy[v] = rand() % SCREEN_HEIGHT;
+        }
+        int faces = rand() % 100;
+        for (int f = 0; f < faces; f++) {
+            fi[f] = rand() % 32;
+            fj[f] = rand() % 32;
+            fk[f] = rand() % 32;
+            col[f] = (rand() % 3) + 1;
+        }
+
+        clear_screen(expected, 0);
+        clear_screen(actual, 0);
+        for (int f = 0; f < faces; f++) {
+            draw_triangle(expected, sx[fi[f]], sy[fi[f]], sx[fj[f]], sy[fj[f]],
+                          sx[fk[f]], sy[fk[f]], col[f]);
+        }
+        draw_triangles(actual, sx, sy, fi, fj, fk, col, faces);
+
+        if (compare_screens(expected, actual) != 0) {
+            failures++;
+            if (failures <= 3) {
+                printf("  Batch %d (%d faces): %d bytes differ\n",
+                       n, faces, compare_screens(expected, actual));
+            }
+        }
+    }
+
+    printf("Batch tests: %d/%d passed\n", count - failures, count);
+    return failures;
+}
+
+/* Grunt mesh with alternating face colors (fcol must hold GRUNT_NUM_FACES) */
+static Mesh make_grunt_mesh(uint8_t *fcol) {
+    Mesh grunt = {
+        .i = grunt_faces_i, .j = grunt_faces_j, .k = grunt_faces_k,
+        .col = fcol,
+        .num_faces = GRUNT_NUM_FACES,
+        .x = grunt_vertices_x, .y = grunt_vertices_y, .z = grunt_vertices_z,
+        .num_vertices = GRUNT_NUM_VERTICES,
+        .px = 0, .py = 0, .pz = 1500,
+        .theta = 20
+    };
+    for (int i = 0; i < GRUNT_NUM_FACES; i++) {
+        fcol[i] = 1 + (i % 3);
+    }
+    return grunt;
+}
+
+/* Tiled renderer tests: render_mesh_tiled() must match render_mesh() for
+ * every band split, including painter's-order overdraw across bands */
+int run_tiled_tests(void) {
+    static const int band_counts[] = { 1, 2, 3, 4, 7, 13, 25 };
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    WorkerPool *pool = pool_create(4);
+    int failures = 0;
+    int tests = 0;
+
+    printf("\n=== Tiled Render Tests (%d threads) ===\n", pool_size(pool));
+
+    for (int theta = 0; theta < 256; theta += 5) {
+        unsigned char expected[SCREEN_SIZE];
+        grunt.theta = theta;
+        grunt.pz = 1000 + theta * 4;  /* Vary size, staying on screen */
+
+        clear_screen(expected, 0);
+        render_mesh(expected, &grunt);
+
+        for (size_t b = 0; b < sizeof(band_counts) / sizeof(band_counts[0]); b++) {
+            unsigned char actual[SCREEN_SIZE];
+            clear_screen(actual, 0);
+            render_mesh_tiled(pool, actual, &grunt, band_counts[b]);
+            if (compare_screens(expected, actual) != 0) {
+                failures++;
+                if (failures <= 3) {
+                    printf("  theta=%d bands=%d: %d bytes differ\n", theta,
+                           band_counts[b], compare_screens(expected, actual));
+                }
+            }
+            tests++;
+        }
+    }
+
+    pool_destroy(pool);
+    printf("Tiled render tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Reference stable sort: insertion sort by ascending key */
+static void reference_sort(const int *key, uint16_t *order, int n) {
+    for (int f = 0; f < n; f++) {
+        int o = f;
+        while (o > 0 && key[order[o - 1]] > key[f]) {
+            order[o] = order[o - 1];
+            o--;
+        }
+        order[o] = (uint16_t)f;
+    }
+}
+
+/* Depth sort tests: radix sorts vs a reference stable sort on random
+ * meshes, then a sorted grunt render vs drawing in the reference order */
+int run_depth_sort_tests(int count) {
+    static uint8_t fi[MESH_MAX_FACES], fj[MESH_MAX_FACES], fk[MESH_MAX_FACES];
+    int16_t rot_z[MESH_MAX_VERTICES];
+    int key8[MESH_MAX_FACES], key16[MESH_MAX_FACES];
+    uint16_t expected[MESH_MAX_FACES], actual[MESH_MAX_FACES];
+    Mesh m = { .i = fi, .j = fj, .k = fk };
+    int failures = 0;
+
+    printf("\n=== Depth Sort Tests ===\n");
+
+    for (int t = 0; t < count; t++) {
+        /* Mix narrow and full z ranges to exercise ties and byte wrap */
+        int range = (t & 1) ? 8 : 400;
+        m.num_faces = 1 + rand() % MESH_MAX_FACES;
+        for (int v = 0; v < MESH_MAX_VERTICES; v++) {
+            rot_z[v] = (int16_t)(rand() % (2 * range + 1) - range);
+        }
+        for (int f = 0; f < m.num_faces; f++) {
+            fi[f] = rand() % MESH_MAX_VERTICES;
+            fj[f] = rand() % MESH_MAX_VERTICES;
+            fk[f] = rand() % MESH_MAX_VERTICES;
+            key8[f] = ((((uint8_t)rot_z[fi[f]]) ^ 0x7f) >> 2) +
+                      ((((uint8_t)rot_z[fj[f]] ^ 0x7f) + 2) >> 2) +
+                      ((((uint8_t)rot_z[fk[f]] ^ 0x7f) + 2) >> 2);
+            key16[f] = -(rot_z[fi[f]] + rot_z[fj[f]] + rot_z[fk[f]]);
+        }
+
+        reference_sort(key8, expected, m.num_faces);
+        sort_faces_8(&m, rot_z, actual);
+        if (memcmp(expected, actual, m.num_faces * sizeof(actual[0])) != 0) {
+            failures++;
+            if (failures <= 3) printf("  sort_faces_8 mismatch (%d faces)\n", m.num_faces);
+        }
+
+        reference_sort(key16, expected, m.num_faces);
+        sort_faces_16(&m, rot_z, actual);
+        if (memcmp(expected, actual, m.num_faces * sizeof(actual[0])) != 0) {
+            failures++;
+            if (failures <= 3) printf("  sort_faces_16 mismatch (%d faces)\n", m.num_faces);
+        }
+    }
+
+    /* Whole-mesh render in sorted order, serial and tiled */
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+    int renders = 0;
+    for (int mode = DEPTH_SORT_8; mode <= DEPTH_SORT_16; mode++) {
+        grunt.depth_sort = mode;
+        for (int theta = 0; theta < 256; theta += 16) {
+            unsigned char want[SCREEN_SIZE], got[SCREEN_SIZE];
+            grunt.theta = theta;
+            transform_mesh_z(&grunt, sx, sy, rot_z);
+            for (int f = 0; f < GRUNT_NUM_FACES; f++) {
+                int zi = rot_z[grunt_faces_i[f]];
+                int zj = rot_z[grunt_faces_j[f]];
+                int zk = rot_z[grunt_faces_k[f]];
+                key8[f] = ((((uint8_t)zi) ^ 0x7f) >> 2) +
+                          ((((uint8_t)zj ^ 0x7f) + 2) >> 2) +
+                          ((((uint8_t)zk ^ 0x7f) + 2) >> 2);
+                key16[f] = -(zi + zj + zk);
+            }
+            reference_sort(mode == DEPTH_SORT_8 ? key8 : key16, expected,
+                           GRUNT_NUM_FACES);
+
+            clear_screen(want, 0);
+            for (int o = 0; o < GRUNT_NUM_FACES; o++) {
+                int f = expected[o];
+                int vi = grunt_faces_i[f], vj = grunt_faces_j[f], vk = grunt_faces_k[f];
+                draw_triangle(want, sx[vi], sy[vi], sx[vj], sy[vj],
+                              sx[vk], sy[vk], fcol[f]);
+            }
+
+            clear_screen(got, 0);
+            render_mesh(got, &grunt);
+            if (compare_screens(want, got) != 0) {
+                failures++;
+                if (failures <= 3) printf("  render mode=%d theta=%d differs\n", mode, theta);
+            }
+            clear_screen(got, 0);
+            render_mesh_tiled(NULL, got, &grunt, 5);
+            if (compare_screens(want, got) != 0) {
+                failures++;
+                if (failures <= 3) printf("  tiled mode=%d theta=%d differs\n", mode, theta);
+            }
+            renders += 2;
+        }
+    }
+
+    printf("Depth sort tests: %d/%d passed\n",
+           2 * count + renders - failures, 2 * count + renders);
+    return failures;
+}
+
+/* Frame-coherent sort tests: the baked grunt animation as the demo plays
+ * it (grunt_pvs.h: the next frame and 3 more theta steps per frame, over
+ * all 768 frame and theta pairs), each sub-mesh's order repaired from the
+ * last frame within mesh.asm's move budget. A repair must give
+ * sort_faces_8's keys in order, and one that gives up must have needed
+ * more moves than the budget; the order is then re-sorted, as the asm
+ * does. The assembled radix sort must match sort_faces_8 on the same keys
+ * where the default build can run, and a half turn at once must give up.
+ * What a budget costs is measured on the asm (make profile on an
+ * INCREMENTAL_SORT build). */
+int run_sort_repair_tests(void) {
+    enum { FRAMES = 768, SORT_MAX_MOVES = 640 };    /* As in mesh.asm */
+    static AsmHarness h;
+    uint8_t fcol[GRUNT_PVS_FACES] = { 0 };
+    Mesh grunt = {
+        .i = grunt_pvs_fi, .j = grunt_pvs_fj, .k = grunt_pvs_fk, .col = fcol,
+        .num_faces = GRUNT_PVS_FACES, .num_vertices = GRUNT_PVS_VERTICES, .pz = 200
+    };
+    Mesh half[2];
+    int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES], rot_z[MESH_MAX_VERTICES];
+    uint16_t order[2][MESH_MAX_FACES], sorted[MESH_MAX_FACES], again[MESH_MAX_FACES];
+    int failures = 0, tests = 0, gave_up = 0;
+
+    printf("\n=== Sort Repair Tests ===\n");
+
+    int sim = asm_harness_open(&h, ASM_DEFAULT_PRG, ASM_DEFAULT_LABELS) == 0;
+    int sort_addr = sim ? sim_label_value(&h.labels, "sort_faces_0") : -1;
+    int face_z = sim ? sim_label_value(&h.labels, "face_z_0") : -1;
+    int face_order = sim ? sim_label_value(&h.labels, "face_order_0") : -1;
+    int num_faces = sim ? sim_label_value(&h.labels, "zp_mesh_num_faces_0") : -1;
+    if (sort_addr < 0 || face_z < 0 || face_order < 0 || num_faces < 0) sim = 0;
+
+    for (int frame = 0; frame <= FRAMES; frame++) {
+        grunt.theta = (uint8_t)(20 + 3 * frame);
+        grunt.x = grunt_pvs_vx[frame % GRUNT_PVS_PLAYED];
+        grunt.y = grunt_pvs_vy[frame % GRUNT_PVS_PLAYED];
+        grunt.z = grunt_pvs_vz[frame % GRUNT_PVS_PLAYED];
+        half[0] = half[1] = grunt;
+        half[0].num_faces = GRUNT_PVS_FACES_0;
+        half[1].num_faces = GRUNT_PVS_FACES - GRUNT_PVS_FACES_0;
+        half[1].i += GRUNT_PVS_FACES_0;
+        half[1].j += GRUNT_PVS_FACES_0;
+        half[1].k += GRUNT_PVS_FACES_0;
+        transform_mesh_z(&grunt, sx, sy, rot_z);
+
+        for (int s = 0; s < 2; s++) {
+            int n = half[s].num_faces, ok = 1;
+            uint8_t seen[MESH_MAX_FACES] = {0};
+            uint8_t keys[MESH_MAX_FACES];
+
+            sort_faces_8(&half[s], rot_z, sorted);
+            if (frame == 0) {
+                memcpy(order[s], sorted, n * sizeof(sorted[0]));
+                continue;
+            }
+
+            /* Within the budget, or it needed more */
+            memcpy(again, order[s], n * sizeof(again[0]));
+            int made = repair_faces_8(&half[s], rot_z, order[s], SORT_MAX_MOVES);
+            if (made < 0) {
+                if (repair_faces_8(&half[s], rot_z, again, 1 << 16) <= SORT_MAX_MOVES) ok = 0;
+                memcpy(order[s], sorted, n * sizeof(sorted[0]));
+                gave_up++;
+            } else if (made > SORT_MAX_MOVES) {
+                ok = 0;
+            }
+
+            /* Same keys in the same sequence as a full sort, ties aside */
+            for (int f = 0; f < n; f++) {
+                keys[f] = (uint8_t)(((((uint8_t)rot_z[half[s].i[f]]) ^ 0x7f) >> 2) +
+                                    ((((uint8_t)rot_z[half[s].j[f]] ^ 0x7f) + 2) >> 2) +
+                                    ((((uint8_t)rot_z[half[s].k[f]] ^ 0x7f) + 2) >> 2));
+            }
+            for (int o = 0; o < n; o++) {
+                int f = order[s][o], g = sorted[o];
+                if (f >= n || seen[f] || keys[f] != keys[g]) ok = 0;
+                if (f < n) seen[f] = 1;
+            }
+
+            /* The assembled radix sort on the same keys gives sort_faces_8's order */
+            if (sim) {
+                memcpy(h.cpu.mem + face_z, keys, n);
+                h.cpu.mem[num_faces] = (uint8_t)n;
+                if (sim_call(&h.cpu, (uint16_t)sort_addr, 100000) < 0) ok = 0;
+                for (int o = 0; o < n; o++) {
+                    if (h.cpu.mem[face_order + o] != sorted[o]) ok = 0;
+                }
+            }
+
+            if (!ok) {
+                failures++;
+                if (failures <= 3) {
+                    printf("  frame %d theta=%d sub-mesh %d: bad repair\n", frame, grunt.theta, s);
+                }
+            }
+            tests++;
+        }
+    }
+
+    /* Half a turn at once: far more moves than the budget allows */
+    grunt.theta += 128;
+    transform_mesh_z(&grunt, sx, sy, rot_z);
+    if (repair_faces_8(&half[0], rot_z, order[0], SORT_MAX_MOVES) != -1) {
+        failures++;
+        printf("  half-turn repair did not give up\n");
+    }
+    tests++;
+    if (sim) asm_harness_close(&h);
+
+    printf("Sort repair tests: %d/%d passed (%d repairs over the budget)\n",
+           tests - failures, tests, gave_up);
+    return failures;
+}
+
+/* Merged sort tests: the bucket order of MERGED_SORT (bucket_faces_8) vs
+ * sort_faces_8 over the whole grunt, both pages, at every theta and a few
+ * pitches, then on random meshes of up to MESH_MAX_FACES with many ties */
+int run_merged_sort_tests(int count) {
+    static uint8_t fi[MESH_MAX_FACES], fj[MESH_MAX_FACES], fk[MESH_MAX_FACES];
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    Mesh m = { .i = fi, .j = fj, .k = fk };
+    int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES], rot_z[MESH_MAX_VERTICES];
+    uint16_t expected[MESH_MAX_FACES], actual[MESH_MAX_FACES];
+    int failures = 0, tests = 0;
+
+    printf("\n=== Merged Sort Tests ===\n");
+
+    for (int t = 0; t < 256 * 4 + count; t++) {
+        const Mesh *mesh = &grunt;
+        if (t < 256 * 4) {
+            grunt.theta = (uint8_t)t;
+            grunt.pitch = (uint8_t)((t >> 8) * 24);
+            transform_mesh_z(&grunt, sx, sy, rot_z);
+        } else {
+            /* Narrow z ranges put many faces, of both pages, in one bucket */
+            int range = (t & 1) ? 8 : 400;
+            m.num_faces = 1 + rand() % MESH_MAX_FACES;
+            m.num_vertices = MESH_MAX_VERTICES;
+            for (int v = 0; v < MESH_MAX_VERTICES; v++) rot_z[v] = (int16_t)(rand() % range - range / 2);
+            for (int f = 0; f < m.num_faces; f++) {
+                fi[f] = (uint8_t)rand();
+                fj[f] = (uint8_t)rand();
+                fk[f] = (uint8_t)rand();
+            }
+            mesh = &m;
+        }
+
+        int n = sort_faces_8(mesh, rot_z, expected);
+        int ok = bucket_faces_8(mesh, rot_z, actual) == n &&
+                 memcmp(expected, actual, n * sizeof(expected[0])) == 0;
+        tests++;
+        if (!ok) {
+            failures++;
+            if (failures <= 3) printf("  test %d (%d faces): bucket order differs\n", t, n);
+        }
+    }
+
+    printf("Merged sort tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Clipping tests: camera fly-through and close-ups of the grunt, plus a
+ * screen-filling quad that crosses the near plane */
+int run_clip_tests(void) {
+    enum { CANARY = 64 };
+    static unsigned char guarded[CANARY + SCREEN_SIZE + CANARY];
+    unsigned char *actual = guarded + CANARY;
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+    int failures = 0;
+    int tests = 0;
+
+    printf("\n=== Clipping Tests ===\n");
+
+    /* Fly through the model: never write out of bounds; frames fully in
+     * front of the camera and inside the guard band match the unclipped
+     * pipeline; tiled output matches serial output */
+    for (int pz = 1200; pz >= -200; pz -= 7) {
+        for (int px = -300; px <= 300; px += 150) {
+            unsigned char expected[SCREEN_SIZE], tiled[SCREEN_SIZE];
+            grunt.pz = pz;
+            grunt.px = px;
+            grunt.theta = (uint8_t)(pz + px);
+
+            memset(guarded, 0xa5, sizeof(guarded));
+            clear_screen(actual, 0);
+            render_mesh(actual, &grunt);
+
+            int ok = 1;
+            for (int b = 0; b < CANARY; b++) {
+                if (guarded[b] != 0xa5 || actual[SCREEN_SIZE + b] != 0xa5) ok = 0;
+            }
+
+            clear_screen(tiled, 0);
+            render_mesh_tiled(NULL, tiled, &grunt, 6);
+            if (compare_screens(actual, tiled) != 0) ok = 0;
+
+            if (transform_mesh(&grunt, sx, sy) == 0) {
+                int inside = 1;
+                for (int v = 0; v < GRUNT_NUM_VERTICES; v++) {
+                    if (sx[v] < -GUARD_BAND || sx[v] > SCREEN_WIDTH + GUARD_BAND ||
+                        sy[v] < -GUARD_BAND || sy[v] > SCREEN_HEIGHT + GUARD_BAND) {
+                        inside = 0;
+                    }
+                }
+                if (inside && grunt.pz >= NEAR_Z + 128) {
+                    clear_screen(expected, 0);
+                    for (int f = 0; f < GRUNT_NUM_FACES; f++) {
+                        int vi = grunt_faces_i[f], vj = grunt_faces_j[f], vk = grunt_faces_k[f];
+                        reference_triangle(expected, sx[vi], sy[vi], sx[vj], sy[vj],
+                                           sx[vk], sy[vk], fcol[f]);
+                    }
+                    if (compare_screens(expected, actual) != 0) ok = 0;
+                }
+            }
+
+            if (!ok) {
+                failures++;
+                if (failures <= 3) printf("  Fly-through px=%d pz=%d failed\n", px, pz);
+            }
+            tests++;
+        }
+    }
+
+    /* Quad much larger than the screen, tilted so part of it is behind the
+     * camera. Both windings are present, so one face set survives culling.
+     * The visible part covers the whole screen: no gaps from clipping. */
+    int8_t qx[] = { -127, 127, 127, -127 };
+    int8_t qy[] = { -127, -127, 127, 127 };
+    int8_t qz[] = { 0, 0, 0, 0 };
+    uint8_t qi[] = { 0, 0, 0, 0 };
+    uint8_t qj[] = { 1, 2, 2, 3 };
+    uint8_t qk[] = { 2, 3, 1, 2 };
+    uint8_t qcol[] = { 2, 2, 2, 2 };
+    Mesh quad = {
+        .i = qi, .j = qj, .k = qk, .col = qcol, .num_faces = 4,
+        .x = qx, .y = qy, .z = qz, .num_vertices = 4,
+    };
+    for (int theta = 0; theta < 40; theta += 4) {
+        for (int pz = 12; pz <= 40; pz += 4) {
+            quad.theta = theta;
+            quad.pz = pz;
+            clear_screen(actual, 0);
+            render_mesh(actual, &quad);
+
+            int holes = 0;
+            for (int y = 0; y < SCREEN_HEIGHT; y++) {
+                for (int x = 0; x < SCREEN_WIDTH; x++) {
+                    if (get_pixel(actual, x, y) != 2) holes++;
+                }
+            }
+            if (holes) {
+                failures++;
+                if (failures <= 3) {
+                    printf("  Quad theta=%d pz=%d: %d pixels not covered\n",
+                           theta, pz, holes);
+                }
+            }
+            tests++;
+        }
+    }
+
+    /* Entirely behind the near plane: nothing is drawn */
+    quad.theta = 0;
+    quad.pz = NEAR_Z - 1;
+    clear_screen(actual, 0);
+    render_mesh(actual, &quad);
+    for (int b = 0; b < SCREEN_SIZE; b++) {
+        if (actual[b] != 0) {
+            failures++;
+            printf("  Quad behind the near plane was drawn\n");
+            break;
+        }
+    }
+    tests++;
+
+    printf("Clipping tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Face plane culling tests: every face rejected in object space (but kept
+ * by the screen-space test) must face away from the camera in exact world
+ * space, and rendered frames stay within a few sliver pixels of
+ * screen-space-only culling */
+int run_face_plane_tests(int count) {
+    uint8_t fcol[GRUNT_NUM_FACES];
+    int8_t nx[GRUNT_NUM_FACES], ny[GRUNT_NUM_FACES], nz[GRUNT_NUM_FACES];
+    int16_t nd[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    TriEdges tris[MESH_MAX_TRIS];
+    int failures = 0;
+    long object_culled = 0, faces = 0;
+
+    printf("\n=== Face Plane Culling Tests (%d cases) ===\n", count);
+
+    compute_face_planes(&grunt, nx, ny, nz, nd);
+    init_mesh_tables();
+
+    for (int t = 0; t < count; t++) {
+        unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+        int wrong = 0;
+
+        grunt.theta = rand() & 255;
+        grunt.px = rand() % 801 - 400;
+        grunt.py = rand() % 401 - 200;
+        grunt.pz = 300 + rand() % 1700;
+
+        double c = rcos[grunt.theta] / 128.0, s = rsin[grunt.theta] / 128.0;
+        for (int f = 0; f < GRUNT_NUM_FACES; f++) {
+            /* One-face view of the mesh, with and without its plane */
+            Mesh face = grunt;
+            face.i += f;
+            face.j += f;
+            face.k += f;
+            face.col += f;
+            face.num_faces = 1;
+            int screen_kept = setup_mesh(&face, tris) > 0;
+            face.nx = nx + f;
+            face.ny = ny + f;
+            face.nz = nz + f;
+            face.nd = nd + f;
+            int plane_kept = setup_mesh(&face, tris) > 0;
+            faces++;
+            if (plane_kept || !screen_kept) continue;
+            object_culled++;
+
+            /* Culled by the plane only: check the unrounded geometry */
+            double w[3][3];
+            int idx[3] = { grunt_faces_i[f], grunt_faces_j[f], grunt_faces_k[f] };
+            for (int v = 0; v < 3; v++) {
+                int lx = grunt_vertices_x[idx[v]], lz = grunt_vertices_z[idx[v]];
+                w[v][0] = c * lx + s * lz + grunt.px;
+                w[v][1] = grunt_vertices_y[idx[v]] + grunt.py;
+                w[v][2] = -s * lx + c * lz + grunt.pz;
+            }
+            double ux = w[1][0] - w[0][0], uy = w[1][1] - w[0][1], uz = w[1][2] - w[0][2];
+            double vx = w[2][0] - w[0][0], vy = w[2][1] - w[0][1], vz = w[2][2] - w[0][2];
+            double n0 = uy * vz - uz * vy, n1 = uz * vx - ux * vz, n2 = ux * vy - uy * vx;
+            if (-(n0 * w[0][0] + n1 * w[0][1] + n2 * w[0][2]) >= 0) wrong = 1;
+        }
+
+        /* Whole frame: only back-face slivers may differ */
+        Mesh culled = grunt;
+        culled.nx = nx;
+        culled.ny = ny;
+        culled.nz = nz;
+        culled.nd = nd;
+        clear_screen(expected, 0);
+        render_mesh(expected, &grunt);
+        clear_screen(actual, 0);
+        render_mesh(actual, &culled);
+        if (compare_pixels(expected, actual) > SCREEN_WIDTH * SCREEN_HEIGHT / 100) {
+            wrong = 1;
+        }
+
+        if (wrong) {
+            failures++;
+            if (failures <= 3) {
+                printf("  theta=%d p=(%d,%d,%d) failed, %d pixels differ\n", grunt.theta,
+                       grunt.px, grunt.py, grunt.pz, compare_pixels(expected, actual));
+            }
+        }
+    }
+
+    printf("Face plane tests: %d/%d passed (%.1f%% of faces culled only in object space)\n",
+           count - failures, count, 100.0 * object_culled / faces);
+    return failures;
+}
+
+/* Potentially visible set tests: inside the box the sets were built for,
+ * adding them to the face plane cull changes nothing, and on their own they
+ * stay within sliver pixels of screen-space-only culling */
+int run_pvs_tests(int count) {
+    static const int16_t lo[3] = { -200, -100, 300 }, hi[3] = { 200, 100, 1500 };
+    static uint8_t pvs[PVS_SECTORS * PVS_BYTES];
+    uint8_t fcol[GRUNT_NUM_FACES];
+    int8_t nx[GRUNT_NUM_FACES], ny[GRUNT_NUM_FACES], nz[GRUNT_NUM_FACES];
+    int16_t nd[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    int failures = 0;
+
+    printf("\n=== Potentially Visible Set Tests (%d cases) ===\n", count);
+
+    init_mesh_tables();
+    compute_face_planes(&grunt, nx, ny, nz, nd);
+    Mesh planes = grunt;
+    planes.nx = nx;
+    planes.ny = ny;
+    planes.nz = nz;
+    planes.nd = nd;
+    memset(pvs, 0, sizeof(pvs));
+    int in_sets = compute_face_pvs(&planes, lo, hi, pvs);
+
+    for (int t = 0; t < count; t++) {
+        unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+        int wrong = 0;
+
+        grunt.theta = rand() & 255;
+        grunt.px = lo[0] + rand() % (hi[0] - lo[0] + 1);
+        grunt.py = lo[1] + rand() % (hi[1] - lo[1] + 1);
+        grunt.pz = lo[2] + rand() % (hi[2] - lo[2] + 1);
+        planes.theta = grunt.theta;
+        planes.px = grunt.px;
+        planes.py = grunt.py;
+        planes.pz = grunt.pz;
+
+        clear_screen(expected, 0);
+        render_mesh(expected, &planes);
+        planes.pvs = pvs;
+        clear_screen(actual, 0);
+        render_mesh(actual, &planes);
+        planes.pvs = NULL;
+        if (compare_screens(expected, actual) != 0) wrong = 1;
+
+        clear_screen(expected, 0);
+        render_mesh(expected, &grunt);
+        grunt.pvs = pvs;
+        clear_screen(actual, 0);
+        render_mesh(actual, &grunt);
+        grunt.pvs = NULL;
+        if (compare_pixels(expected, actual) > SCREEN_WIDTH * SCREEN_HEIGHT / 100) {
+            wrong = 1;
+        }
+
+        if (wrong) {
+            failures++;
+            if (failures <= 3) {
+                printf("  theta=%d p=(%d,%d,%d) failed\n", grunt.theta,
+                       grunt.px, grunt.py, grunt.pz);
+            }
+        }
+    }
+
+    printf("PVS tests: %d/%d passed (%.1f%% of faces outside their sector's set)\n",
+           count - failures, count,
+           100.0 - 100.0 * in_sets / (PVS_SECTORS * GRUNT_NUM_FACES));
+    return failures;
+}
+
+/* Baked set tests: the face sets bake_animation.py wrote for the asm
+ * (grunt_pvs.h, from face_pvs) equal compute_face_pvs() over the same
+ * frames and position box */
+int run_baked_pvs_tests(void) {
+    static uint8_t pvs[PVS_SECTORS * PVS_BYTES];
+    int8_t nx[GRUNT_PVS_FACES], ny[GRUNT_PVS_FACES], nz[GRUNT_PVS_FACES];
+    int16_t nd[GRUNT_PVS_FACES];
+    uint8_t fcol[GRUNT_PVS_FACES] = { 0 };
+    Mesh m = {
+        .i = grunt_pvs_fi, .j = grunt_pvs_fj, .k = grunt_pvs_fk, .col = fcol,
+        .num_faces = GRUNT_PVS_FACES, .num_vertices = GRUNT_PVS_VERTICES,
+        .nx = nx, .ny = ny, .nz = nz, .nd = nd
+    };
+    int failures = 0, tests = 0;
+
+    printf("\n=== Baked PVS Tests ===\n");
+
+    memset(pvs, 0, sizeof(pvs));
+    for (int frame = 0; frame < GRUNT_PVS_FRAMES; frame++) {
+        m.x = grunt_pvs_vx[frame];
+        m.y = grunt_pvs_vy[frame];
+        m.z = grunt_pvs_vz[frame];
+        compute_face_planes(&m, nx, ny, nz, nd);
+        compute_face_pvs(&m, grunt_pvs_lo, grunt_pvs_hi, pvs);
+    }
+
+    if (GRUNT_PVS_SECTOR_SHIFT != PVS_SECTOR_SHIFT) {
+        printf("  sector shift %d, C model uses %d\n", GRUNT_PVS_SECTOR_SHIFT, PVS_SECTOR_SHIFT);
+        failures++;
+    }
+    for (int sector = 0; sector < PVS_SECTORS; sector++) {
+        const uint8_t *set = pvs + sector * PVS_BYTES;
+        for (int f = 0; f < GRUNT_PVS_FACES; f++) {
+            int baked = grunt_pvs_sets[sector][f >> 3] >> (f & 7) & 1;
+            int model = set[f >> 3] >> (f & 7) & 1;
+            if (baked != model) {
+                failures++;
+                if (failures <= 3) {
+                    printf("  sector %d face %d: baked %d, compute_face_pvs %d\n",
+                           sector, f, baked, model);
+                }
+            }
+            tests++;
+        }
+    }
+
+    printf("Baked PVS tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Double-precision reference for a vertex in camera space, using the same
+ * conventions as mesh.c: R = yaw * pitch * roll, camera R_cam^T (p - cam) */
+static void reference_rotation(int yaw, int pitch, int roll, double r[3][3]) {
+    double a = yaw * 2.0 * M_PI / 256.0, b = pitch * 2.0 * M_PI / 256.0;
+    double g = roll * 2.0 * M_PI / 256.0;
+    double ry[3][3] = { { cos(a), 0, sin(a) }, { 0, 1, 0 }, { -sin(a), 0, cos(a) } };
+    double rx[3][3] = { { 1, 0, 0 }, { 0, cos(b), -sin(b) }, { 0, sin(b), cos(b) } };
+    double rz[3][3] = { { cos(g), -sin(g), 0 }, { sin(g), cos(g), 0 }, { 0, 0, 1 } };
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            r[i][j] = 0;
+            for (int k = 0; k < 3; k++) {
+                for (int l = 0; l < 3; l++) r[i][j] += ry[i][k] * rx[k][l] * rz[l][j];
+            }
+        }
+    }
+}
+
+static void reference_camera_space(const Mesh *m, int v, double out[3]) {
+    double rm[3][3], rc[3][3], w[3];
+    const Camera *cam = m->camera;
+    reference_rotation(m->theta, m->pitch, m->roll, rm);
+    reference_rotation(cam ? cam->yaw : 0, cam ? cam->pitch : 0, cam ? cam->roll : 0, rc);
+    double l[3] = { m->x[v], m->y[v], m->z[v] };
+    double p[3] = { m->px - (cam ? cam->x : 0), m->py - (cam ? cam->y : 0),
+                    m->pz - (cam ? cam->z : 0) };
+    for (int i = 0; i < 3; i++) {
+        w[i] = p[i] + rm[i][0] * l[0] + rm[i][1] * l[1] + rm[i][2] * l[2];
+    }
+    for (int i = 0; i < 3; i++) {
+        out[i] = rc[0][i] * w[0] + rc[1][i] * w[1] + rc[2][i] * w[2];
+    }
+}
+
+/* Camera and 3-axis rotation tests */
+int run_camera_tests(int count) {
+    uint8_t fcol[GRUNT_NUM_FACES];
+    int8_t nx[GRUNT_NUM_FACES], ny[GRUNT_NUM_FACES], nz[GRUNT_NUM_FACES];
+    int16_t nd[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    Camera cam = { 0, 0, 0, 0, 0, 0 };
+    TriEdges tris[MESH_MAX_TRIS];
+    int failures = 0;
+    int tests = 0;
+
+    printf("\n=== Camera Tests (%d cases) ===\n", count);
+
+    compute_face_planes(&grunt, nx, ny, nz, nd);
+
+    for (int t = 0; t < count; t++) {
+        unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+        Mesh moved = grunt;
+        int ok = 1;
+
+        /* Yaw-only cameras stay on the table path: bit-exact with moving
+         * and turning the mesh by the inverse camera transform instead */
+        cam.x = rand() % 201 - 100;
+        cam.y = rand() % 201 - 100;
+        cam.z = rand() % 201 - 100;
+        cam.yaw = (t & 1) ? rand() & 255 : 0;
+        cam.pitch = cam.roll = 0;
+        grunt.theta = rand() & 255;
+        grunt.px = rand() % 201 - 100;
+        grunt.pz = 1400;
+
+        double a = cam.yaw * 2.0 * M_PI / 256.0;
+        int dx = grunt.px - cam.x, dz = grunt.pz - cam.z;
+        moved.theta = grunt.theta - cam.yaw;
+        moved.px = (int16_t)lround(cos(a) * dx - sin(a) * dz);
+        moved.py = grunt.py - cam.y;
+        moved.pz = (int16_t)lround(sin(a) * dx + cos(a) * dz);
+        grunt.camera = &cam;
+        clear_screen(expected, 0);
+        render_mesh(expected, &moved);
+        clear_screen(actual, 0);
+        render_mesh(actual, &grunt);
+        if (compare_screens(expected, actual) != 0) ok = 0;
+
+        /* General path: screen positions within rounding of a double
+         * reference, for pitched and rolled meshes and cameras */
+        cam.x = rand() % 201 - 100;
+        cam.y = rand() % 201 - 100;
+        cam.z = rand() % 201 - 100;
+        cam.yaw = rand() % 32 - 16;
+        cam.pitch = rand() % 32 - 16;
+        cam.roll = (t & 1) ? rand() % 32 - 16 : 0;
+        grunt.pitch = rand() & 255;
+        grunt.roll = (t & 2) ? rand() & 255 : 0;
+        grunt.pz = 1400;
+
+        int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+        if (transform_mesh(&grunt, sx, sy) == 0) {
+            for (int v = 0; v < GRUNT_NUM_VERTICES; v++) {
+                double c[3];
+                reference_camera_space(&grunt, v, c);
+                double rx = 40 + 256.0 * c[0] / c[2];
+                double ry = 25 - 256.0 * c[1] / c[2];
+                if (fabs(sx[v] - rx) > 1.5 || fabs(sy[v] - ry) > 1.5) ok = 0;
+            }
+        } else {
+            ok = 0;
+        }
+
+        /* Face planes stay conservative on the general path */
+        for (int f = 0; f < GRUNT_NUM_FACES; f++) {
+            Mesh face = grunt;
+            face.i += f;
+            face.j += f;
+            face.k += f;
+            face.col += f;
+            face.num_faces = 1;
+            int screen_kept = setup_mesh(&face, tris) > 0;
+            face.nx = nx + f;
+            face.ny = ny + f;
+            face.nz = nz + f;
+            face.nd = nd + f;
+            if (setup_mesh(&face, tris) > 0 || !screen_kept) continue;
+
+            double w[3][3];
+            reference_camera_space(&grunt, grunt_faces_i[f], w[0]);
+            reference_camera_space(&grunt, grunt_faces_j[f], w[1]);
+            reference_camera_space(&grunt, grunt_faces_k[f], w[2]);
+            double ux = w[1][0] - w[0][0], uy = w[1][1] - w[0][1], uz = w[1][2] - w[0][2];
+            double vx = w[2][0] - w[0][0], vy = w[2][1] - w[0][1], vz = w[2][2] - w[0][2];
+            double n0 = uy * vz - uz * vy, n1 = uz * vx - ux * vz, n2 = ux * vy - uy * vx;
+            if (-(n0 * w[0][0] + n1 * w[0][1] + n2 * w[0][2]) >= 0) ok = 0;
+        }
+
+        grunt.pitch = grunt.roll = 0;
+        grunt.px = 0;
+        grunt.camera = NULL;
+        if (!ok) {
+            failures++;
+            if (failures <= 3) printf("  case %d failed\n", t);
+        }
+        tests++;
+    }
+
+    /* Mesh and camera more than 32K apart, on both paths: camera-space
+     * coordinates must not wrap to 16 bits (the mesh would land behind the
+     * camera or on the wrong side of the screen) */
+    for (int t = 0; t < count; t++) {
+        static MeshScratch scratch;
+        unsigned char buf[SCREEN_SIZE];
+        int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+        int ok = 1;
+        int far = 20000 + rand() % 12000;
+
+        /* Looking down +z, or down +x with yaw 64 */
+        cam.yaw = (t & 1) ? 64 : 0;
+        cam.pitch = (t & 2) ? rand() % 8 - 4 : 0;
+        cam.roll = 0;
+        cam.x = (t & 1) ? -far : rand() % 201 - 100;
+        cam.y = rand() % 201 - 100;
+        cam.z = (t & 1) ? rand() % 201 - 100 : -far;
+        grunt.px = (t & 1) ? far : rand() % 201 - 100;
+        grunt.pz = (t & 1) ? rand() % 201 - 100 : far;
+        grunt.theta = rand() & 255;
+        grunt.camera = &cam;
+
+        if (transform_mesh(&grunt, sx, sy) == 0) {
+            for (int v = 0; v < GRUNT_NUM_VERTICES; v++) {
+                double c[3];
+                reference_camera_space(&grunt, v, c);
+                double rx = 40 + 256.0 * c[0] / c[2];
+                double ry = 25 - 256.0 * c[1] / c[2];
+                if (fabs(sx[v] - rx) > 1.5 || fabs(sy[v] - ry) > 1.5) ok = 0;
+            }
+        } else {
+            ok = 0;
+        }
+
+        /* setup_mesh() keeps world coordinates for clipping: all vertices
+         * inside the near plane and guard band, projected as above */
+        clear_screen(buf, 0);
+        render_mesh_scratch(buf, &grunt, &scratch);
+        for (int v = 0; v < GRUNT_NUM_VERTICES; v++) {
+            if (scratch.work.outcode[v] != 0 || scratch.work.screen_x[v] != sx[v] ||
+                scratch.work.screen_y[v] != sy[v]) {
+                ok = 0;
+            }
+        }
+
+        grunt.px = 0;
+        grunt.pz = 1400;
+        grunt.camera = NULL;
+        if (!ok) {
+            failures++;
+            if (failures <= 3) printf("  far case %d (distance %d) failed\n", t, 2 * far);
+        }
+        tests++;
+    }
+
+    printf("Camera tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Pixels marked in a span buffer */
+static int coverage_pixels(const Coverage *c) {
+    int n = 0;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        for (int w = 0; w < 2; w++) {
+            for (uint64_t b = c->bits[y][w]; b; b &= b - 1) n++;
+        }
+    }
+    return n;
+}
+
+/* Span buffer tests: front-to-back drawing with raster_triangle_front must
+ * give the painter's-order screen, for random triangle soups over random
+ * backgrounds and for depth-sorted meshes. Reports pixel writes per covered
+ * pixel in painter's order (the span buffer writes each exactly once). */
+int run_span_buffer_tests(int count) {
+    static MeshScratch scratch;
+    static TriEdges tris[64];
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    Mesh steve = {
+        .i = steve_faces_i, .j = steve_faces_j, .k = steve_faces_k,
+        .col = steve_faces_col, .num_faces = STEVE_NUM_FACES,
+        .num_vertices = STEVE_NUM_VERTICES,
+        .pz = 800
+    };
+    int failures = 0;
+    int tests = 0;
+
+    printf("\n=== Span Buffer Tests (%d soups) ===\n", count);
+
+    for (int i = 0; i < count; i++) {
+        unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+        Coverage cover;
+        int n = 0, faces = 1 + rand() % 64;
+
+        /* Some vertices off-screen, within the guard band */
+        for (int f = 0; f < faces; f++) {
+            int v[6];
+            for (int c = 0; c < 6; c++) {
+                int size = (c & 1) ? SCREEN_HEIGHT : SCREEN_WIDTH;
+                v[c] = rand() % (size + 40) - 20;
+            }
+            n += setup_triangle(&tris[n], v[0], v[1], v[2], v[3], v[4], v[5], rand() % 4);
+        }
+        for (int b = 0; b < SCREEN_SIZE; b++) expected[b] = actual[b] = rand() & 0xff;
+
+        for (int t = 0; t < n; t++) raster_triangle(expected, &tris[t]);
+        clear_coverage(&cover);
+        for (int t = n - 1; t >= 0; t--) raster_triangle_front(actual, &tris[t], &cover);
+
+        if (compare_screens(expected, actual) != 0) {
+            failures++;
+            if (failures <= 3) {
+                printf("  Soup %d (%d triangles): %d bytes differ\n", i, n,
+                       compare_screens(expected, actual));
+            }
+        }
+        tests++;
+    }
+
+    for (int model = 0; model < 2; model++) {
+        Mesh *m = model ? &steve : &grunt;
+        long writes = 0, covered = 0;
+
+        for (int sort = DEPTH_SORT_8; sort <= DEPTH_SORT_16; sort++) {
+            for (int theta = 0; theta < 256; theta += 4) {
+                unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+                if (model) {
+                    int frame = theta % STEVE_NUM_FRAMES;
+                    steve.x = steve_vertices_x[frame];
+                    steve.y = steve_vertices_y[frame];
+                    steve.z = steve_vertices_z[frame];
+                }
+                m->theta = theta;
+                m->depth_sort = sort;
+
+                m->span_buffer = 0;
+                clear_screen(expected, 0);
+                render_mesh_scratch(expected, m, &scratch);
+                m->span_buffer = 1;
+                clear_screen(actual, 0);
+                render_mesh_scratch(actual, m, &scratch);
+
+                if (compare_screens(expected, actual) != 0) {
+                    failures++;
+                    if (failures <= 3) {
+                        printf("  %s sort=%d theta=%d: %d bytes differ\n",
+                               model ? "Steve" : "Grunt", sort, theta,
+                               compare_screens(expected, actual));
+                    }
+                }
+                tests++;
+
+                /* Painter's writes: each triangle's pixels on its own */
+                if (sort == DEPTH_SORT_8) {
+                    int n = setup_mesh(m, scratch.tris);
+                    for (int t = 0; t < n; t++) {
+                        Coverage one;
+                        clear_coverage(&one);
+                        raster_triangle_front(actual, &scratch.tris[t], &one);
+                        writes += coverage_pixels(&one);
+                    }
+                    covered += coverage_pixels(&scratch.cover);
+                }
+            }
+        }
+        m->span_buffer = 0;
+        m->depth_sort = DEPTH_SORT_NONE;
+        printf("  %s: painter's order writes each covered pixel %.2f times\n",
+               model ? "Steve" : "Grunt", covered ? (double)writes / covered : 0.0);
+    }
+
+    printf("Span buffer tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Dirty-rectangle clear tests: three buffers drawn in turn, as in the asm
+ * main loop. Each is cleared only over what its previous frame covered, and
+ * must equal a full clear plus render. Modes: the rectangle of the
+ * transformed vertices (mesh_screen_rect, clear_dirty: ~5 cycles per byte
+ * and ~20 per column; collecting the bounds in transform_mesh ~28 per
+ * vertex and ~100 per frame), and the row extents recorded while rasterizing
+ * (clear_extents, painter's order and span buffer; clear_row_extents: ~11
+ * cycles per byte and ~70 per row). Reports the average cleared area and
+ * asm cost of the clear, against 6,413 cycles for clear_screen. The ~35
+ * cycles per span that track_extent_m adds to rasterize_trapezoid are not
+ * included; make profile measures them on the *_extent builds. */
+int run_dirty_clear_tests(void) {
+    static int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+    static int8_t ovx[] = { 120, -120,    0,    0,    0,    0 };
+    static int8_t ovy[] = {   0,    0,  120, -120,    0,    0 };
+    static int8_t ovz[] = {   0,    0,    0,    0,  120, -120 };
+    static uint8_t ofi[] = { 0, 1, 0, 1,  0, 1, 0, 1 };
+    static uint8_t ofj[] = { 4, 3, 3, 5,  2, 4, 5, 2 };
+    static uint8_t ofk[] = { 3, 4, 5, 3,  4, 2, 2, 5 };
+    static uint8_t ocol[] = { 1, 2, 3, 1,  2, 3, 1, 2 };
+    static const char *names[] = { "Octahedron", "Steve", "Grunt" };
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh meshes[3] = {
+        { .i = ofi, .j = ofj, .k = ofk, .col = ocol, .num_faces = 8,
+          .x = ovx, .y = ovy, .z = ovz, .num_vertices = 6, .pz = 1500 },
+        { .i = steve_faces_i, .j = steve_faces_j, .k = steve_faces_k,
+          .col = steve_faces_col, .num_faces = STEVE_NUM_FACES,
+          .num_vertices = STEVE_NUM_VERTICES, .pz = 800 },
+        make_grunt_mesh(fcol)
+    };
+    static const char *modes[] = { "rectangle", "row extents", "row extents, span buffer" };
+    int failures = 0;
+    int tests = 0;
+
+    printf("\n=== Dirty Rectangle Clear Tests ===\n");
+
+    for (int run = 0; run < 9; run++) {
+        int model = run / 3, mode = run % 3;
+        Mesh *m = &meshes[model];
+        unsigned char bufs[3][SCREEN_SIZE];
+        CharRect dirty[3];
+        RowExtents ext[3];
+        long bytes = 0, cycles = 0;
+
+        /* Buffers start with garbage and a whole-screen rectangle/extents */
+        for (int b = 0; b < 3; b++) {
+            for (int i = 0; i < SCREEN_SIZE; i++) bufs[b][i] = rand() & 0xff;
+            dirty[b] = (CharRect){ 0, CHAR_HEIGHT - 1, 0, CHAR_WIDTH - 1 };
+            memset(ext[b].col0, 0, CHAR_HEIGHT);
+            memset(ext[b].col1, CHAR_WIDTH - 1, CHAR_HEIGHT);
+        }
+        m->depth_sort = mode == 2 ? DEPTH_SORT_16 : DEPTH_SORT_NONE;
+        m->span_buffer = mode == 2;
+
+        for (int frame = 0; frame < 256; frame++) {
+            unsigned char expected[SCREEN_SIZE];
+            unsigned char *buf = bufs[frame % 3];
+            CharRect *r = &dirty[frame % 3];
+
+            if (model == 1) {
+                int f = frame % STEVE_NUM_FRAMES;
+                m->x = steve_vertices_x[f];
+                m->y = steve_vertices_y[f];
+                m->z = steve_vertices_z[f];
+            }
+            m->theta = (uint8_t)(frame * 3);
+            m->px = (int16_t)((frame % 64 - 32) * 8);   /* Drift sideways */
+
+            if (mode == 0) {
+                int cols = r->col1 - r->col0 + 1, rows = r->row1 - r->row0 + 1;
+                if (cols > 0 && rows > 0) {
+                    bytes += cols * rows;
+                    cycles += 5 * cols * rows + 20 * cols;
+                }
+                cycles += 28 * m->num_vertices + 100;
+                clear_rect(buf, r, 0);
+                m->extents = NULL;
+            } else {
+                RowExtents *e = &ext[frame % 3];
+                for (int row = 0; row < CHAR_HEIGHT; row++) {
+                    int cols = e->col1[row] - e->col0[row] + 1;
+                    if (cols > 0) bytes += cols;
+                    cycles += cols > 0 ? 11 * cols + 70 : 28;
+                }
+                clear_extents(buf, e, 0);
+                m->extents = e;
+            }
+            render_mesh(buf, m);
+
+            m->extents = NULL;
+            clear_screen(expected, 0);
+            render_mesh(expected, m);
+            if (compare_screens(expected, buf) != 0) {
+                failures++;
+                if (failures <= 3) {
+                    printf("  %s (%s) frame %d: %d bytes differ\n", names[model], modes[mode], frame,
+                           compare_screens(expected, buf));
+                }
+            }
+            tests++;
+
+            if (transform_mesh(m, sx, sy) == 0) {
+                mesh_screen_rect(sx, sy, m->num_vertices, r);
+            } else {
+                *r = (CharRect){ 0, CHAR_HEIGHT - 1, 0, CHAR_WIDTH - 1 };
+            }
+        }
+        printf("  %s (%s): %.0f of %d bytes cleared per frame, ~%.0f cycles in asm\n",
+               names[model], modes[mode], bytes / 256.0, SCREEN_SIZE, cycles / 256.0);
+    }
+
+    printf("Dirty rectangle clear tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Assemble bytes at addr and time a call to them on the simulator */
+static int64_t sim_time(Sim6502 *cpu, uint16_t addr, const uint8_t *code, int len) {
+    memcpy(cpu->mem + addr, code, len);
+    return sim_call(cpu, addr, 100000);
+}
+
+/* 6502 simulator: documented cycle counts, page-crossing and branch
+ * penalties, decimal mode, and the clear_screen count from profile.md */
+int run_sim6502_tests(void) {
+    static Sim6502 cpu;
+    int failures = 0;
+    int tests = 0;
+
+    printf("\n=== 6502 Simulator Tests ===\n");
+
+    /* Each case: code at $1000 ending in RTS, expected cycles including
+     * the JSR and RTS (12) */
+    static const struct {
+        const char *name;
+        uint8_t code[16];
+        int len;
+        uint8_t x;
+        int cycles;
+    } cases[] = {
+        { "lda abs,x same page",   { 0xbd, 0x00, 0x20, 0x60 }, 4, 0x10, 12 + 4 },
+        { "lda abs,x page cross",  { 0xbd, 0xf8, 0x20, 0x60 }, 4, 0x10, 12 + 5 },
+        { "sta abs,x page cross",  { 0x9d, 0xf8, 0x20, 0x60 }, 4, 0x10, 12 + 5 },
+        { "inc abs,x",             { 0xfe, 0x00, 0x20, 0x60 }, 4, 0x10, 12 + 7 },
+        { "lda (zp),y cross",      { 0xa0, 0x10, 0xb1, 0x80, 0x60 }, 5, 0, 12 + 2 + 6 },
+        { "sta (zp),y cross",      { 0xa0, 0x10, 0x91, 0x80, 0x60 }, 5, 0, 12 + 2 + 6 },
+        { "dex/bne loop x10",      { 0xa2, 0x0a, 0xca, 0xd0, 0xfd, 0x60 }, 6, 0,
+                                   12 + 2 + 10 * 2 + 9 * 3 + 2 },
+        { "jmp (ind)",             { 0x6c, 0x82, 0x00 }, 3, 0, 12 + 5 + 0 },
+        { "php/plp/pha/pla",       { 0x08, 0x28, 0x48, 0x68, 0x60 }, 5, 0, 12 + 3 + 4 + 3 + 4 },
+    };
+
+    for (size_t c = 0; c < sizeof(cases) / sizeof(cases[0]); c++) {
+        sim_init(&cpu);
+        cpu.mem[0x80] = 0xf8;           /* ($80) = $20F8 */
+        cpu.mem[0x81] = 0x20;
+        cpu.mem[0x82] = 0x0f;           /* ($82) = $100F: an RTS */
+        cpu.mem[0x83] = 0x10;
+        cpu.mem[0x100f] = 0x60;
+        cpu.x = cases[c].x;
+        int64_t cycles = sim_time(&cpu, 0x1000, cases[c].code, cases[c].len);
+        if (cycles != cases[c].cycles) {
+            failures++;
+            printf("  %s: %lld cycles, expected %d\n", cases[c].name, (long long)cycles,
+                   cases[c].cycles);
+        }
+        tests++;
+    }
+
+    /* A taken branch costs one more cycle when it crosses a page */
+    sim_init(&cpu);
+    cpu.mem[0x10fd] = 0xd0;             /* $10FD: bne +$01 -> $1100 */
+    cpu.mem[0x10fe] = 0x01;
+    cpu.mem[0x1100] = 0x60;
+    int64_t cross = sim_call(&cpu, 0x10fd, 100);
+    if (cross != 12 + 4) {
+        failures++;
+        printf("  bne page cross: %lld cycles, expected %d\n", (long long)cross, 12 + 4);
+    }
+    tests++;
+
+    /* Decimal mode: $19 + $28 = $47, $47 - $28 = $19 */
+    static const uint8_t bcd[] = { 0xf8, 0x18, 0xa9, 0x19, 0x69, 0x28, 0x85, 0x90,
+                                   0x38, 0xe9, 0x28, 0x85, 0x91, 0xd8, 0x60 };
+    sim_init(&cpu);
+    sim_time(&cpu, 0x1000, bcd, sizeof(bcd));
+    if (cpu.mem[0x90] != 0x47 || cpu.mem[0x91] != 0x19) {
+        failures++;
+        printf("  decimal: got $%02x and $%02x\n", cpu.mem[0x90], cpu.mem[0x91]);
+    }
+    tests++;
+
+    /* The shipped Steve build: clear_screen is 6,413 cycles plus the JSR */
+    SimLabels labels;
+    sim_init(&cpu);
+    if (sim_load_prg(&cpu, "../asm/steve.prg") == 0x0801 &&
+        sim_load_labels(&labels, "../asm/steve_labels.txt") == 0) {
+        int clear = sim_label_value(&labels, "clear_screen");
+        cpu.a = 0;
+        int64_t cycles = clear < 0 ? -1 : sim_call(&cpu, (uint16_t)clear, 100000);
+        if (cycles != 6413 + 6) {
+            failures++;
+            printf("  steve.prg clear_screen: %lld cycles, expected %d\n",
+                   (long long)cycles, 6413 + 6);
+        }
+        tests++;
+        sim_free_labels(&labels);
+    } else {
+        printf("  (../asm/steve.prg not found, skipping program check)\n");
+    }
+
+    printf("6502 simulator tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Label address, or -1 */
+static int asm_label(const AsmHarness *h, const char *name) {
+    return sim_label_value(&h->labels, name);
+}
+
+/* Address in the operand of a self-modified absolute load at label */
+static int asm_operand(const AsmHarness *h, int label) {
+    return h->cpu.mem[label] | h->cpu.mem[label + 1] << 8;
+}
+
+/* ANIM_KEYFRAMES vertex coordinate v at step 0-3 (quarters) from
+ * +128-biased keyframe arrays a to b, rounded down as blend_keyframes in
+ * bake_animation.py defines it */
+static int asm_model_blend(const uint8_t *mem, int a, int b, int step, int v) {
+    int ka = mem[a + v], kb = mem[b + v], mid = (ka + kb) >> 1;
+    static const int8_t unbias = -128;
+
+    switch (step) {
+    case 0:  return ka + unbias;
+    case 1:  return ((ka + mid) >> 1) + unbias;
+    case 2:  return mid + unbias;
+    default: return ((kb + mid) >> 1) + unbias;
+    }
+}
+
+/* Vertices of an asm frame at rotation theta, from the state the main
+ * loop drew it with (position, vertex arrays): transform_mesh's arithmetic
+ * (the assembled rcos/rsin and recip_persp tables, 8-bit rotated
+ * coordinates, screen = 40 + highbyte(world_x * recip)). MESH_BLEND
+ * vertices are blended from the keyframes around grunt_frame.
+ * Fills sx/sy/rz (rot_z before SORT_XOR). Returns the number of vertices,
+ * 0 if a vertex was rejected (the asm then draws nothing), -1 if the build
+ * lacks a label it needs. */
+static int asm_model_vertices(const AsmHarness *h, uint8_t theta,
+                              uint8_t *sx, uint8_t *sy, int8_t *rz) {
+    const uint8_t *mem = h->cpu.mem;
+    int rcos_tab = asm_label(h, "rcos"), rsin_tab = asm_label(h, "rsin");
+    int recip = asm_label(h, "recip_persp");
+    int px = asm_label(h, "zp_mesh_px_lo"), py = asm_label(h, "zp_mesh_py_lo");
+    int pz = asm_label(h, "zp_mesh_pz_lo"), nverts = asm_label(h, "zp_mesh_num_verts");
+    int vx = asm_label(h, "mesh_vx"), vy = asm_label(h, "mesh_vy"), vz = asm_label(h, "mesh_vz");
+    int smc_vx = asm_label(h, "smc_mesh_vx"), smc_vy = asm_label(h, "smc_mesh_vy");
+    int smc_vz = asm_label(h, "smc_mesh_vz");
+    int blend = asm_label(h, "smc_mesh_vx_q") >= 0;
+    int key_a[3], key_b[3], step = 0;      /* MESH_BLEND: keyframe arrays per axis */
+
+    if (rcos_tab < 0 || rsin_tab < 0 || recip < 0 || px < 0 || py < 0 || pz < 0 ||
+        nverts < 0) {
+        return -1;
+    }
+    /* Vertex arrays: where transform_mesh's loads point (read in place), the
+     * mesh_vx/vy/vz of a compiled transform, or with MESH_BLEND the two
+     * keyframes around grunt_frame, independent of how load_grunt_frame
+     * patched the blend */
+    if (blend) {
+        static const char *const key_tabs[3][2] = {
+            { "grunt_kx_lo", "grunt_kx_hi" }, { "grunt_ky_lo", "grunt_ky_hi" },
+            { "grunt_kz_lo", "grunt_kz_hi" }
+        };
+        int frame = asm_label(h, "grunt_frame"), keys = asm_label(h, "GRUNT_NUM_KEYS");
+        if (frame < 0 || keys <= 0) return -1;
+        int a = mem[frame] >> 2, b = (a + 1) % keys;
+        step = mem[frame] & 3;
+        for (int axis = 0; axis < 3; axis++) {
+            int lo = asm_label(h, key_tabs[axis][0]), hi = asm_label(h, key_tabs[axis][1]);
+            if (lo < 0 || hi < 0) return -1;
+            key_a[axis] = mem[lo + a] | mem[hi + a] << 8;
+            key_b[axis] = mem[lo + b] | mem[hi + b] << 8;
+        }
+    } else if (smc_vx >= 0 && smc_vy >= 0 && smc_vz >= 0) {
+        vx = asm_operand(h, smc_vx);
+        vy = asm_operand(h, smc_vy);
+        vz = asm_operand(h, smc_vz);
+    } else if (vx < 0 || vy < 0 || vz < 0) {
+        return -1;
+    }
+
+    int c = (int8_t)mem[rcos_tab + theta], s = (int8_t)mem[rsin_tab + theta];
+    int16_t pos_x = (int16_t)(mem[px] | mem[px + 1] << 8);
+    int16_t pos_y = (int16_t)(mem[py] | mem[py + 1] << 8);
+    int16_t pos_z = (int16_t)(mem[pz] | mem[pz + 1] << 8);
+    int num_vertices = mem[nverts];
+
+    for (int v = 0; v < num_vertices; v++) {
+        int lx = blend ? asm_model_blend(mem, key_a[0], key_b[0], step, v) : (int8_t)mem[vx + v];
+        int ly = blend ? asm_model_blend(mem, key_a[1], key_b[1], step, v) : (int8_t)mem[vy + v];
+        int lz = blend ? asm_model_blend(mem, key_a[2], key_b[2], step, v) : (int8_t)mem[vz + v];
+        int8_t rot_x = (int8_t)((c * lx + s * lz) >> 7);
+        rz[v] = (int8_t)((c * lz - s * lx) >> 7);
+        int16_t world_x = (int16_t)(rot_x + pos_x);
+        int16_t world_y = (int16_t)(ly + pos_y);
+        int16_t world_z = (int16_t)(rz[v] + pos_z);
+        int z8 = (world_z & 0x1ff) >> 1;
+        if (world_z <= 0 || z8 < 17) return 0;
+        int r = mem[recip + z8];
+        sx[v] = (uint8_t)(40 + ((world_x * r) >> 8));
+        sy[v] = (uint8_t)(25 - ((world_y * r) >> 8));
+    }
+    return num_vertices;
+}
+
+/* Model of an asm frame, from the state the main loop drew it with
+ * (mesh_theta, asm_model_vertices(), face lists), faces drawn with
+ * asm_reference_triangle(). C's own transform_mesh() and draw_triangle()
+ * cannot be used: they divide by z (focal length 256 vs the table's ~32)
+ * with truncated rotation tables, and step edges with exact slopes.
+ * Both sub-meshes of a DUAL_MESH build are drawn in sort_faces_8() order
+ * over sub-mesh 0's faces followed by sub-mesh 1's (render_mesh's merge and
+ * bucket_faces both draw ties in that order), each sub-mesh through its
+ * MESH_PVS face list if the build has them. With INCREMENTAL_SORT the
+ * asm's face_order_0/1 may order ties differently: they must be
+ * permutations sorted by face key, and are then drawn as they are.
+ * Fills sx/sy/rz (rot_z before SORT_XOR) and buf. Returns 1 if it drew,
+ * 0 if a vertex was rejected (the asm then draws nothing), -1 if the build
+ * lacks a label it needs, -2 if an INCREMENTAL_SORT face order is not a
+ * sorted permutation. */
+static int asm_model_frame(const AsmHarness *h, unsigned char *buf,
+                           uint8_t *sx, uint8_t *sy, int8_t *rz) {
+    const uint8_t *mem = h->cpu.mem;
+    int theta = asm_label(h, "mesh_theta");
+    int subs = asm_label(h, "DUAL_MESH") > 0 ? 2 : 1;
+    int pvs = asm_label(h, "MESH_PVS") > 0;
+    int incremental = asm_label(h, "INCREMENTAL_SORT") > 0;
+    static const char *const names[2][7] = {
+        { "zp_mesh_num_faces_0", "mesh_fi_0", "mesh_fj_0", "mesh_fk_0", "mesh_fcol_0",
+          "smc_pvs_list_0", "face_order_0" },
+        { "zp_mesh_num_faces_1", "mesh_fi_1", "mesh_fj_1", "mesh_fk_1", "mesh_fcol_1",
+          "smc_pvs_list_1", "face_order_1" }
+    };
+
+    if (theta < 0) return -1;
+    int num_vertices = asm_model_vertices(h, mem[theta], sx, sy, rz);
+    if (num_vertices <= 0) return num_vertices;
+
+    /* Faces of both sub-meshes, each in its draw order before the merge */
+    uint8_t fi[MESH_MAX_FACES], fj[MESH_MAX_FACES], fk[MESH_MAX_FACES], fcol[MESH_MAX_FACES];
+    uint8_t sub[MESH_MAX_FACES];
+    int n = 0;
+    for (int m = 0; m < subs; m++) {
+        int lab[7];
+        for (int l = 0; l < 7; l++) lab[l] = asm_label(h, names[m][l]);
+        if (lab[0] < 0 || lab[1] < 0 || lab[2] < 0 || lab[3] < 0 || lab[4] < 0 ||
+            (pvs && lab[5] < 0) || (incremental && lab[6] < 0)) {
+            return -1;
+        }
+        int count = mem[lab[0]];
+        int list = pvs ? asm_operand(h, lab[5]) : -1;
+        uint8_t seen[256] = { 0 };
+        for (int p = 0; p < count; p++) {
+            int pos = p;
+            if (incremental) {
+                pos = mem[lab[6] + p];
+                if (pos >= count || seen[pos]++) return -2;
+            }
+            int f = list >= 0 ? mem[list + pos] : pos;
+            fi[n] = mem[lab[1] + f];
+            fj[n] = mem[lab[2] + f];
+            fk[n] = mem[lab[3] + f];
+            fcol[n] = mem[lab[4] + f];
+            sub[n++] = (uint8_t)m;
+        }
+    }
+
+    /* Stable sort of the concatenation: the merge, ties to sub-mesh 0. A
+     * sorted INCREMENTAL_SORT order keeps its sub-mesh's relative order. */
+    int16_t z[MESH_MAX_VERTICES];
+    uint16_t order[MESH_MAX_FACES];
+    Mesh all = { .i = fi, .j = fj, .k = fk, .num_faces = n, .num_vertices = num_vertices };
+    for (int v = 0; v < num_vertices; v++) z[v] = rz[v];
+    sort_faces_8(&all, z, order);
+    if (incremental) {
+        int last[2] = { -1, -1 };
+        for (int o = 0; o < n; o++) {
+            if (order[o] < last[sub[order[o]]]) return -2;
+            last[sub[order[o]]] = order[o];
+        }
+    }
+    for (int o = 0; o < n; o++) {
+        int f = order[o];
+        asm_reference_triangle(buf, sx[fi[f]], sy[fi[f]], sx[fj[f]], sy[fj[f]],
+                               sx[fk[f]], sy[fk[f]], fcol[f]);
+    }
+    return 1;
+}
+
+/* MESH_PVS: faces the asm would draw front-facing at any theta with this
+ * frame's vertices and position, but leaves out of that theta's sector
+ * list (grunt_pvs0/1). Returns the number of (theta, face) misses, -1 if
+ * the build lacks a label it needs or a vertex is rejected. */
+static int asm_pvs_misses(const AsmHarness *h) {
+    const uint8_t *mem = h->cpu.mem;
+    static const char *const names[2][7] = {
+        { "GRUNT_NUM_FACES_0", "mesh_fi_0", "mesh_fj_0", "mesh_fk_0",
+          "grunt_pvs0_lo", "grunt_pvs0_hi", "grunt_pvs0_n" },
+        { "GRUNT_NUM_FACES_1", "mesh_fi_1", "mesh_fj_1", "mesh_fk_1",
+          "grunt_pvs1_lo", "grunt_pvs1_hi", "grunt_pvs1_n" }
+    };
+    int shift = asm_label(h, "GRUNT_PVS_SHIFT");
+    int misses = 0;
+
+    if (shift < 0) return -1;
+    for (int theta = 0; theta < 256; theta++) {
+        uint8_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+        int8_t rz[MESH_MAX_VERTICES];
+        int sector = theta >> shift;
+        if (asm_model_vertices(h, (uint8_t)theta, sx, sy, rz) <= 0) return -1;
+        for (int m = 0; m < 2; m++) {
+            int lab[7];
+            uint8_t listed[256] = { 0 };
+            for (int l = 0; l < 7; l++) {
+                lab[l] = asm_label(h, names[m][l]);
+                if (lab[l] < 0) return -1;
+            }
+            int list = mem[lab[4] + sector] | mem[lab[5] + sector] << 8;
+            for (int p = 0; p < mem[lab[6] + sector]; p++) listed[mem[list + p]] = 1;
+            for (int f = 0; f < lab[0]; f++) {
+                int a = mem[lab[1] + f], b = mem[lab[2] + f], c = mem[lab[3] + f];
+                int det = (sx[b] - sx[a]) * (sy[c] - sy[a]) - (sy[b] - sy[a]) * (sx[c] - sx[a]);
+                if (det > 0 && !listed[f]) misses++;
+            }
+        }
+    }
+    return misses;
+}
+
+/* Differential tests against the assembled rasterizer: draw_triangle from
+ * rasterizer.asm runs on the 6502 simulator, over random backgrounds, on the
+ * random and exhaustive triangle sets. It must match the reference
+ * rasterizer with the asm's reciprocal-table slopes and degenerate culling
+ * (asm_reference_triangle) byte for byte; how often that differs from the C
+ * draw_triangle is reported.
+ * Whole frames of the demo's main loop are replayed the same way from the
+ * traced draw_triangle calls, and for single-mesh builds without
+ * INCREMENTAL_SORT the face order must match sort_faces_8. Frames are also
+ * rebuilt from the mesh state alone (asm_model_frame): screen_x/screen_y,
+ * mesh_rot_z and the whole screen must match. In MESH_PVS builds, each
+ * frame's vertices are also turned through all 256 thetas: every face the
+ * asm would draw front-facing must be in that theta's face list, so the
+ * lists never change what is drawn (asm_pvs_misses). */
+int run_asm_diff_tests(const char *prg, const char *labels, int count,
+                       int region_size, int frames) {
+    static AsmHarness h;
+    int failures = 0;
+    int tests = 0;
+    int slope_diffs = 0;    /* Cases where the asm output differs from C */
+
+    printf("\n=== 6502 Differential Tests (%s) ===\n", prg);
+
+    if (asm_harness_open(&h, prg, labels) < 0) {
+        printf("  (cannot run %s, skipping)\n", prg);
+        return 0;
+    }
+
+    /* Random triangles over random screen contents */
+    for (int i = 0; i < count; i++) {
+        unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE], c_out[SCREEN_SIZE];
+        int v[6];
+        for (int c = 0; c < 6; c++) v[c] = rand() % ((c & 1) ? SCREEN_HEIGHT : SCREEN_WIDTH);
+        unsigned char color = rand() % 4;
+        for (int b = 0; b < SCREEN_SIZE; b++) expected[b] = rand() & 0xff;
+        memcpy(actual, expected, SCREEN_SIZE);
+        memcpy(c_out, expected, SCREEN_SIZE);
+
+        asm_reference_triangle(expected, v[0], v[1], v[2], v[3], v[4], v[5], color);
+        draw_triangle(c_out, v[0], v[1], v[2], v[3], v[4], v[5], color);
+        if (asm_draw_triangle(&h, actual, v[0], v[1], v[2], v[3], v[4], v[5], color) < 0 ||
+            compare_screens(expected, actual) != 0) {
+            failures++;
+            if (failures <= 3) {
+                printf("  Random failure: (%d,%d)-(%d,%d)-(%d,%d) color=%d\n",
+                       v[0], v[1], v[2], v[3], v[4], v[5], color);
+            }
+        }
+        if (compare_screens(c_out, actual) != 0) slope_diffs++;
+        tests++;
+    }
+
+    /* Same exhaustive region as run_exhaustive_tests() */
+    int ox = 35, oy = 20;
+    int n = region_size;
+    for (int t = 0; t < n * n * n * n * n * n; t++) {
+        unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+        int ax = ox + t % n, ay = oy + t / n % n;
+        int bx = ox + t / (n * n) % n, by = oy + t / (n * n * n) % n;
+        int cx = ox + t / (n * n * n * n) % n, cy = oy + t / (n * n * n * n * n) % n;
+
+        unsigned char c_out[SCREEN_SIZE];
+        clear_screen(expected, 0);
+        clear_screen(actual, 0);
+        clear_screen(c_out, 0);
+        asm_reference_triangle(expected, ax, ay, bx, by, cx, cy, 1);
+        draw_triangle(c_out, ax, ay, bx, by, cx, cy, 1);
+        if (asm_draw_triangle(&h, actual, ax, ay, bx, by, cx, cy, 1) < 0 ||
+            compare_screens(expected, actual) != 0) {
+            failures++;
+            if (failures <= 3) {
+                printf("  Exhaustive failure: (%d,%d)-(%d,%d)-(%d,%d)\n",
+                       ax, ay, bx, by, cx, cy);
+            }
+        }
+        if (compare_screens(c_out, actual) != 0) slope_diffs++;
+        tests++;
+    }
+
+    /* Whole frames of the main loop */
+    int screen_x = sim_label_value(&h.labels, "screen_x");
+    int screen_y = sim_label_value(&h.labels, "screen_y");
+    int rot_z = sim_label_value(&h.labels, "mesh_rot_z");
+    int face_order = sim_label_value(&h.labels, "face_order_0");
+    int fi = sim_label_value(&h.labels, "mesh_fi_0");
+    int fj = sim_label_value(&h.labels, "mesh_fj_0");
+    int fk = sim_label_value(&h.labels, "mesh_fk_0");
+    int nverts = sim_label_value(&h.labels, "zp_mesh_num_verts");
+    int nfaces0 = sim_label_value(&h.labels, "zp_mesh_num_faces_0");
+    int nfaces1 = sim_label_value(&h.labels, "zp_mesh_num_faces_1");
+    int have_sort = screen_x >= 0 && screen_y >= 0 && rot_z >= 0 && face_order >= 0 &&
+                    fi >= 0 && fj >= 0 && fk >= 0 && nverts >= 0 && nfaces0 >= 0;
+
+    if (sim_label_value(&h.labels, "INCREMENTAL_SORT") > 0) have_sort = 0;
+    int have_pvs = sim_label_value(&h.labels, "MESH_PVS") > 0;
+
+    int sort_xor = sim_label_value(&h.labels, "SORT_XOR");
+    int model_frames = 0;
+    for (int f = 0; f < frames; f++) {
+        unsigned char expected[SCREEN_SIZE];
+        int ok = asm_run_frame(&h) >= 0 && h.num_traced <= ASM_MAX_TRACED;
+
+        clear_screen(expected, 0);
+        for (int t = 0; ok && t < h.num_traced; t++) {
+            const AsmTriangle *tri = &h.traced[t];
+            asm_reference_triangle(expected, tri->ax, tri->ay, tri->bx, tri->by,
+                                   tri->cx, tri->cy, tri->color);
+        }
+        if (!ok || compare_screens(expected, asm_frame_screen(&h)) != 0) ok = 0;
+
+        /* Single mesh: the radix sort must order faces like the C port */
+        if (ok && have_sort && (nfaces1 < 0 || h.cpu.mem[nfaces1] == 0)) {
+            const uint8_t *mem = h.cpu.mem;
+            int16_t z[MESH_MAX_VERTICES];
+            uint16_t order[MESH_MAX_FACES];
+            Mesh m = {
+                .i = (uint8_t *)mem + fi, .j = (uint8_t *)mem + fj, .k = (uint8_t *)mem + fk,
+                .num_faces = mem[nfaces0], .num_vertices = mem[nverts]
+            };
+            for (int v = 0; v < m.num_vertices; v++) z[v] = (int8_t)(mem[rot_z + v] ^ 0x7f);
+            sort_faces_8(&m, z, order);
+            for (int face = 0; face < m.num_faces; face++) {
+                if (order[face] != mem[face_order + face]) ok = 0;
+            }
+        }
+
+        /* The frame from the mesh state alone */
+        if (ok) {
+            unsigned char model[SCREEN_SIZE];
+            uint8_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+            int8_t rz[MESH_MAX_VERTICES];
+            const uint8_t *mem = h.cpu.mem;
+
+            clear_screen(model, 0);
+            int drew = asm_model_frame(&h, model, sx, sy, rz);
+            if (drew > 0 && sort_xor >= 0) {
+                for (int v = 0; v < mem[nverts]; v++) {
+                    if (sx[v] != mem[screen_x + v] || sy[v] != mem[screen_y + v] ||
+                        ((uint8_t)rz[v] ^ sort_xor) != mem[rot_z + v]) {
+                        ok = 0;
+                    }
+                }
+            }
+            if (drew >= 0) {
+                if (compare_screens(model, asm_frame_screen(&h)) != 0) ok = 0;
+                model_frames++;
+            } else if (drew == -2) {
+                ok = 0;
+            }
+        }
+
+        /* The face lists at every theta */
+        if (ok && have_pvs) {
+            int misses = asm_pvs_misses(&h);
+            if (misses != 0) {
+                ok = 0;
+                if (failures < 3) printf("  Frame %d: %d faces missing from face lists\n", f, misses);
+            }
+        }
+
+        if (!ok) {
+            failures++;
+            if (failures <= 3) printf("  Frame %d differs (%d triangles)\n", f, h.num_traced);
+        }
+        tests++;
+    }
+
+    asm_harness_close(&h);
+    printf("  %d of %d frames rebuilt from the mesh state\n", model_frames, frames);
+    if (have_pvs) printf("  Face lists checked at all 256 thetas on every frame\n");
+    printf("6502 differential tests: %d/%d passed (%d of %d triangles differ from C "
+           "draw_triangle (reciprocal slopes, degenerate culling))\n", tests - failures, tests,
+           slope_diffs, count + n * n * n * n * n * n);
+    return failures;
+}
+
+/* Two asm builds that must draw the same frames, e.g. a feature build
+ * (ANIM_DELTA, DIRTY_CLEAR, ...) against the plain demo it replaces: run
+ * both main loops side by side and compare every queued screen. */
+int run_asm_same_tests(const char *prg_a, const char *labels_a,
+                       const char *prg_b, const char *labels_b, int frames) {
+    static AsmHarness a, b;
+    int failures = 0;
+
+    printf("\n=== 6502 Same-Frame Tests (%s vs %s) ===\n", prg_b, prg_a);
+
+    if (asm_harness_open(&a, prg_a, labels_a) < 0) {
+        printf("  (cannot run %s, skipping)\n", prg_a);
+        return 0;
+    }
+    if (asm_harness_open(&b, prg_b, labels_b) < 0) {
+        printf("  (cannot run %s, skipping)\n", prg_b);
+        asm_harness_close(&a);
+        return 0;
+    }
+
+    for (int f = 0; f < frames; f++) {
+        if (asm_run_frame(&a) < 0 || asm_run_frame(&b) < 0 ||
+            compare_screens(asm_frame_screen(&a), asm_frame_screen(&b)) != 0) {
+            failures++;
+            if (failures <= 3) printf("  Frame %d differs\n", f);
+        }
+    }
+
+    asm_harness_close(&a);
+    asm_harness_close(&b);
+    printf("6502 same-frame tests: %d/%d passed\n", frames - failures, frames);
+    return failures;
+}
+
+/* Render a mesh frame with the plain pipeline: project every vertex with
+ * transform_mesh() and draw the faces in index order */
+static void render_unclipped(unsigned char *buf, const Mesh *m) {
+    int16_t sx[MESH_MAX_VERTICES], sy[MESH_MAX_VERTICES];
+    clear_screen(buf, 0);
+    transform_mesh(m, sx, sy);
+    for (int f = 0; f < m->num_faces; f++) {
+        int vi = m->i[f], vj = m->j[f], vk = m->k[f];
+        draw_triangle(buf, sx[vi], sy[vi], sx[vj], sy[vj], sx[vk], sy[vk], m->col[f]);
+    }
+}
+
+/* Projection tests: without face planes setup_mesh() matches the plain
+ * pipeline, and lazy projection draws the same frames as eager, with and
+ * without face planes. Reports how many vertices are projected per frame in
+ * each mode (vertices used only by culled faces are skipped), on a
+ * turntable and on a pan that takes the model across the screen edges */
+int run_projection_tests(void) {
+    static MeshScratch scratch;
+    static int8_t nx[MESH_MAX_FACES], ny[MESH_MAX_FACES], nz[MESH_MAX_FACES];
+    static int16_t nd[MESH_MAX_FACES];
+    static const char *config_names[] = { "all", "planes", "lazy", "lazy+planes" };
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    Mesh steve = {
+        .i = steve_faces_i, .j = steve_faces_j, .k = steve_faces_k,
+        .col = steve_faces_col, .num_faces = STEVE_NUM_FACES,
+        .num_vertices = STEVE_NUM_VERTICES,
+        .pz = 800
+    };
     int failures = 0;
     int tests = 0;
 
-    printf("\n=== Exhaustive Tests (region %dx%d) ===\n", region_size, region_size);
-
-    int ox = 35;  /* Offset to center the test region */
-    int oy = 20;
-
-    for (int ay = 0; ay < region_size; ay++) {
-        for (int ax = 0; ax < region_size; ax++) {
-            for (int by = 0; by < region_size; by++) {
-                for (int bx = 0; bx < region_size; bx++) {
-                    for (int cy = 0; cy < region_size; cy++) {
-                        for (int cx = 0; cx < region_size; cx++) {
-                            int fail = test_triangle(
-                                ox + ax, oy + ay,
-                                ox + bx, oy + by,
-                                ox + cx, oy + cy,
-                                1, 0);
-                            if (fail) failures++;
-                            tests++;
+    printf("\n=== Projection Tests ===\n");
+
+    for (int run = 0; run < 4; run++) {
+        int model = run >> 1, pan = run & 1;
+        Mesh *m = model ? &steve : &grunt;
+        long projected[4] = { 0, 0, 0, 0 };
+        int frames = 0;
+
+        for (int theta = 0; theta < 256; theta += 4) {
+            int frame = theta % STEVE_NUM_FRAMES;
+            if (model) {
+                steve.x = steve_vertices_x[frame];
+                steve.y = steve_vertices_y[frame];
+                steve.z = steve_vertices_z[frame];
+            }
+            m->theta = theta;
+            m->px = pan ? (int16_t)((theta - 128) * 3) : 0;
+            compute_face_planes(m, nx, ny, nz, nd);
+
+            for (int config = 0; config < 4; config++) {
+                unsigned char expected[SCREEN_SIZE], actual[SCREEN_SIZE];
+                int planes = config & 1;
+                m->nx = planes ? nx : NULL;
+                m->ny = ny;
+                m->nz = nz;
+                m->nd = nd;
+                m->lazy_projection = config >> 1;
+                clear_screen(actual, 0);
+                render_mesh_scratch(actual, m, &scratch);
+                projected[config] += scratch.work.num_projected;
+
+                /* Screen-space culling only must match the plain pipeline,
+                 * and lazy projection the eager frame */
+                if (config != 1) {
+                    if (config == 0) {
+                        render_unclipped(expected, m);
+                    } else {
+                        m->lazy_projection = 0;
+                        clear_screen(expected, 0);
+                        render_mesh_scratch(expected, m, &scratch);
+                    }
+                    if (compare_screens(expected, actual) != 0) {
+                        failures++;
+                        if (failures <= 3) {
+                            printf("  model %d pan %d theta=%d %s differs\n", model, pan,
+                                   theta, config_names[config]);
                         }
                     }
+                    tests++;
                 }
             }
+            m->nx = NULL;
+            m->lazy_projection = 0;
+            m->px = 0;
+            frames++;
+        }
+
+        printf("  %s (%d vertices, %s) projected per frame:", model ? "Steve" : "Grunt",
+               m->num_vertices, pan ? "pan" : "turntable");
+        for (int config = 0; config < 4; config++) {
+            printf(" %s %.1f%s", config_names[config], (double)projected[config] / frames,
+                   config < 3 ? "," : "\n");
         }
     }
 
-    printf("Exhaustive tests: %d/%d passed\n", tests - failures, tests);
+    printf("Projection tests: %d/%d passed\n", tests - failures, tests);
+    return failures;
+}
+
+/* Grunt turntable: one job per theta, sized to stay on screen */
+static void make_turntable_jobs(const Mesh *grunt, RenderJob *jobs) {
+    for (int theta = 0; theta < 256; theta++) {
+        jobs[theta].mesh = grunt;
+        jobs[theta].theta = theta;
+        jobs[theta].px = 0;
+        jobs[theta].py = 0;
+        jobs[theta].pz = 1000 + theta * 4;
+    }
+}
+
+/* Batch renderer tests: each frame of render_frames() must match a serial
+ * render_mesh() of the same job */
+int run_frame_tests(void) {
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    RenderJob jobs[256];
+    unsigned char *frames = malloc(256 * SCREEN_SIZE);
+    WorkerPool *pool = pool_create(4);
+    int failures = 0;
+
+    printf("\n=== Batch Frame Tests (%d threads) ===\n", pool_size(pool));
+
+    make_turntable_jobs(&grunt, jobs);
+    if (render_frames(pool, jobs, 256, frames, 0) != 0) {
+        printf("  render_frames failed\n");
+        failures = 256;
+    } else {
+        for (int f = 0; f < 256; f++) {
+            unsigned char expected[SCREEN_SIZE];
+            grunt.theta = jobs[f].theta;
+            grunt.pz = jobs[f].pz;
+            clear_screen(expected, 0);
+            render_mesh(expected, &grunt);
+            if (compare_screens(expected, frames + f * SCREEN_SIZE) != 0) {
+                failures++;
+                if (failures <= 3) printf("  frame %d differs\n", f);
+            }
+        }
+    }
+
+    pool_destroy(pool);
+    free(frames);
+    printf("Batch frame tests: %d/%d passed\n", 256 - failures, 256);
     return failures;
 }
 
@@ -280,33 +2280,40 @@ void run_cube_demo(void) {
 /* Demo: render the Quake grunt model */
 void run_grunt_demo(void) {
     unsigned char buf[SCREEN_SIZE];
+    uint8_t fcol[GRUNT_NUM_FACES];
 
     /* Mesh data is already properly oriented by the converter:
      * X = left/right, Y = up/down (screen coords), Z = depth */
-    Mesh grunt = {
-        .i = grunt_faces_i, .j = grunt_faces_j, .k = grunt_faces_k,
-        .col = NULL,
-        .num_faces = GRUNT_NUM_FACES,
-        .x = grunt_vertices_x, .y = grunt_vertices_y, .z = grunt_vertices_z,
-        .num_vertices = GRUNT_NUM_VERTICES,
-        .px = 0, .py = 0, .pz = 1500,
-        .theta = 20  /* Slight rotation to show some depth */
-    };
-
-    /* Allocate colors - alternate */
-    uint8_t *fcol = malloc(GRUNT_NUM_FACES);
-    for (int i = 0; i < GRUNT_NUM_FACES; i++) {
-        fcol[i] = 1 + (i % 3);
-    }
-    grunt.col = fcol;
+    Mesh grunt = make_grunt_mesh(fcol);
 
     clear_screen(buf, 0);
     render_mesh(buf, &grunt);
     save_screen(buf, "grunt.bin");
     printf("Grunt demo saved to grunt.bin (%d vertices, %d faces)\n",
            GRUNT_NUM_VERTICES, GRUNT_NUM_FACES);
+}
+
+/* Demo: render a full grunt turntable (256 frames) on all cores */
+void run_turntable_demo(void) {
+    uint8_t fcol[GRUNT_NUM_FACES];
+    Mesh grunt = make_grunt_mesh(fcol);
+    RenderJob jobs[256];
+    unsigned char *frames = malloc(256 * SCREEN_SIZE);
+    WorkerPool *pool = pool_create(0);
+
+    make_turntable_jobs(&grunt, jobs);
+    if (frames && render_frames(pool, jobs, 256, frames, 0) == 0) {
+        FILE *f = fopen("turntable.bin", "wb");
+        if (f) {
+            fwrite(frames, SCREEN_SIZE, 256, f);
+            fclose(f);
+            printf("Turntable saved to turntable.bin (256 frames, %d threads)\n",
+                   pool_size(pool));
+        }
+    }
 
-    free(fcol);
+    pool_destroy(pool);
+    free(frames);
 }
 
 /* Demo: draw an isometric cube (6 triangles, 3 visible faces) */
@@ -361,11 +2368,55 @@ int main(int argc, char **argv) {
         return 0;
     }
 
+    if (argc > 1 && strcmp(argv[1], "--turntable") == 0) {
+        run_turntable_demo();
+        return 0;
+    }
+
+    /* Bit-exactness gate for another asm build: --asm prog.prg labels.txt */
+    if (argc > 3 && strcmp(argv[1], "--asm") == 0) {
+        srand(time(NULL));
+        return run_asm_diff_tests(argv[2], argv[3], 10000, 5, 256) > 0 ? 1 : 0;
+    }
+
+    /* Same frames from two builds: --asm-same a.prg a.txt b.prg b.txt */
+    if (argc > 5 && strcmp(argv[1], "--asm-same") == 0) {
+        return run_asm_same_tests(argv[2], argv[3], argv[4], argv[5], 256) > 0 ? 1 : 0;
+    }
+
+    /* Larger exhaustive sweep, e.g. --exhaustive 8 (n^6 triangles per origin) */
+    if (argc > 2 && strcmp(argv[1], "--exhaustive") == 0) {
+        int n = atoi(argv[2]);
+        if (n < 1 || n > 16) {
+            fprintf(stderr, "Region size must be 1..16\n");
+            return 1;
+        }
+        return run_exhaustive_tests(n) > 0 ? 1 : 0;
+    }
+
     srand(time(NULL));
 
     failures += run_manual_tests();
     failures += run_random_tests(10000);
-    failures += run_exhaustive_tests(5);
+    failures += run_exhaustive_tests(8);
+    failures += run_guard_band_tests(2000);
+    failures += run_background_tests(10000);
+    failures += run_batch_tests(1000);
+    failures += run_tiled_tests();
+    failures += run_frame_tests();
+    failures += run_depth_sort_tests(1000);
+    failures += run_sort_repair_tests();
+    failures += run_merged_sort_tests(1000);
+    failures += run_clip_tests();
+    failures += run_face_plane_tests(300);
+    failures += run_pvs_tests(300);
+    failures += run_baked_pvs_tests();
+    failures += run_projection_tests();
+    failures += run_camera_tests(300);
+    failures += run_span_buffer_tests(1000);
+    failures += run_dirty_clear_tests();
+    failures += run_sim6502_tests();
+    failures += run_asm_diff_tests(ASM_DEFAULT_PRG, ASM_DEFAULT_LABELS, 2000, 5, 48);
 
     printf("\n=== Summary ===\n");
     if (failures == 0) {